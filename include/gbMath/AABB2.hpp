@@ -72,7 +72,9 @@ public:
         requires(requires(R r) { std::ranges::begin(r); std::ranges::end(r); })
 #endif
     {
-        return std::accumulate(std::ranges::begin(points), std::ranges::end(points), empty_aabb2<T>(), enclose<T>);
+        // enclose is overloaded for boxes, so the point overload has to be selected explicitly
+        return std::accumulate(std::ranges::begin(points), std::ranges::end(points), empty_aabb2<T>(),
+                               [](AABB2 const& b, Point2<T> const& p) { return enclose(b, p); });
     }
 
     [[nodiscard]] static constexpr inline AABB2 from_points(std::initializer_list<Point2<T>> l)
@@ -143,6 +145,27 @@ template<typename T>
     return true;
 }
 
+/** Returns the point inside the volume that is closest to p.
+ * Points inside the volume are returned unchanged.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point2<T> closest_point(AABB2<T> const& b, Point2<T> const& p)
+{
+    return Point2<T>(std::clamp(p.x, b.min.x, b.max.x),
+                     std::clamp(p.y, b.min.y, b.max.y));
+}
+
+/** Squared distance from a point to the volume; 0 for points inside the volume.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline T distance_squared(AABB2<T> const& b, Point2<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const dx = std::max({ b.min.x - p.x, zero, p.x - b.max.x });
+    T const dy = std::max({ b.min.y - p.y, zero, p.y - b.max.y });
+    return dx*dx + dy*dy;
+}
+
 template<typename T>
 [[nodiscard]] constexpr inline AABB2<T> union_aabb(AABB2<T> const& b1, AABB2<T> const& b2)
 {
@@ -70,7 +70,9 @@ public:
         requires(requires(R r) { std::ranges::begin(r); std::ranges::end(r); })
 #endif
     {
-        return std::accumulate(std::ranges::begin(points), std::ranges::end(points), empty_aabb3<T>(), enclose<T>);
+        // enclose is overloaded for boxes, so the point overload has to be selected explicitly
+        return std::accumulate(std::ranges::begin(points), std::ranges::end(points), empty_aabb3<T>(),
+                               [](AABB3 const& b, Point3<T> const& p) { return enclose(b, p); });
     }
 
     [[nodiscard]] static constexpr inline AABB3 from_points(std::initializer_list<Point3<T>> l)
@@ -144,6 +146,58 @@ template<typename T>
     return true;
 }
 
+/** Returns the point inside the volume that is closest to p.
+ * Points inside the volume are returned unchanged.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> closest_point(AABB3<T> const& b, Point3<T> const& p)
+{
+    return Point3<T>(std::clamp(p.x, b.min.x, b.max.x),
+                     std::clamp(p.y, b.min.y, b.max.y),
+                     std::clamp(p.z, b.min.z, b.max.z));
+}
+
+/** Squared distance from a point to the volume; 0 for points inside the volume.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline T distance_squared(AABB3<T> const& b, Point3<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const dx = std::max({ b.min.x - p.x, zero, p.x - b.max.x });
+    T const dy = std::max({ b.min.y - p.y, zero, p.y - b.max.y });
+    T const dz = std::max({ b.min.z - p.z, zero, p.z - b.max.z });
+    return dx*dx + dy*dy + dz*dz;
+}
+
+/** Signed distance from a point to the surface of the volume.
+ * Positive outside the volume, negative inside.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T signed_distance(AABB3<T> const& b, Point3<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    // distance to the slab of each axis; negative inside the slab
+    T const qx = std::max(b.min.x - p.x, p.x - b.max.x);
+    T const qy = std::max(b.min.y - p.y, p.y - b.max.y);
+    T const qz = std::max(b.min.z - p.z, p.z - b.max.z);
+    T const ox = std::max(qx, zero);
+    T const oy = std::max(qy, zero);
+    T const oz = std::max(qz, zero);
+    return std::sqrt(ox*ox + oy*oy + oz*oz) + std::min(std::max({ qx, qy, qz }), zero);
+}
+
+/** Squared distance between two volumes; 0 if the volumes intersect.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline T distance_squared(AABB3<T> const& b1, AABB3<T> const& b2)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const dx = std::max({ b1.min.x - b2.max.x, zero, b2.min.x - b1.max.x });
+    T const dy = std::max({ b1.min.y - b2.max.y, zero, b2.min.y - b1.max.y });
+    T const dz = std::max({ b1.min.z - b2.max.z, zero, b2.min.z - b1.max.z });
+    return dx*dx + dy*dy + dz*dz;
+}
+
 template<typename T>
 [[nodiscard]] constexpr inline AABB3<T> union_aabb(AABB3<T> const& b1, AABB3<T> const& b2)
 {
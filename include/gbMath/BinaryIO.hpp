@@ -0,0 +1,506 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_BINARY_IO_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_BINARY_IO_HPP
+
+/** @file
+ *
+ * @brief Compact binary serialization for vector, matrix and volume types.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB2.hpp>
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Circle2.hpp>
+#include <gbMath/Matrix.hpp>
+#include <gbMath/Matrix2.hpp>
+#include <gbMath/Matrix3.hpp>
+#include <gbMath/Matrix4.hpp>
+#include <gbMath/OBB3.hpp>
+#include <gbMath/Plane3.hpp>
+#include <gbMath/Sphere3.hpp>
+#include <gbMath/Transform2.hpp>
+#include <gbMath/Transform3.hpp>
+#include <gbMath/Triangle3.hpp>
+#include <gbMath/Vector.hpp>
+#include <gbMath/Vector2.hpp>
+#include <gbMath/Vector3.hpp>
+#include <gbMath/Vector4.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* Binary format
+ *
+ * Each value is stored as the sequence of its scalar members, in declaration order, without any padding.
+ * Vectors store their components, matrices their elements in row-major order regardless of their storage order,
+ * and volumes their members, e.g. an AABB3 is stored as min.x min.y min.z max.x max.y max.z.
+ * All scalars are stored with the requested byte order.
+ *
+ * Streams written with a header start with the following 24 bytes, which are always stored little-endian:
+ *   offset  size  content
+ *        0     4  magic 'G' 'B' 'M' 'B'
+ *        4     2  format version, currently 1
+ *        6     1  byte order of the payload: 0 little-endian, 1 big-endian
+ *        7     1  scalar kind: 0 floating point, 1 signed integer, 2 unsigned integer
+ *        8     1  size of a scalar in bytes
+ *        9     3  reserved, 0
+ *       12     4  number of scalars per element
+ *       16     8  number of elements
+ * The header identifies the shape of the elements, not their type, so a file of Point3<float> can be read
+ * as Vector3<float> and vice versa.
+ */
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace BinaryIOTraits
+{
+/** Describes the members of a type for binary serialization.
+ * Specializations provide a static function members() that returns a tuple of references to the members of
+ * an object, which may be scalars, std::arrays or other types with a Layout specialization.
+ * Specializations whose members() does not list the members in the order they are laid out in memory must
+ * define a static constexpr bool in_memory_order = false, which disables bulk memcpy for the type.
+ */
+template<typename T>
+struct Layout;
+
+template<typename T, typename VectorTag_T>
+struct Layout<Vector2Impl<T, VectorTag_T>> {
+    static constexpr auto members(auto& v) { return std::tie(v.x, v.y); }
+};
+
+template<typename T, typename VectorTag_T>
+struct Layout<Vector3Impl<T, VectorTag_T>> {
+    static constexpr auto members(auto& v) { return std::tie(v.x, v.y, v.z); }
+};
+
+template<typename T>
+struct Layout<Vector4<T>> {
+    static constexpr auto members(auto& v) { return std::tie(v.x, v.y, v.z, v.w); }
+};
+
+template<typename T, std::size_t N>
+struct Layout<Vector<T, N>> {
+    static constexpr auto members(auto& v) { return std::tie(v.v); }
+};
+
+template<typename T>
+struct Layout<Matrix2<T>> {
+    static constexpr auto members(auto& m) { return std::tie(m.m11, m.m12, m.m21, m.m22); }
+};
+
+template<typename T>
+struct Layout<Matrix3<T>> {
+    static constexpr auto members(auto& m)
+    {
+        return std::tie(m.m11, m.m12, m.m13, m.m21, m.m22, m.m23, m.m31, m.m32, m.m33);
+    }
+};
+
+template<typename T>
+struct Layout<Matrix4<T>> {
+    static constexpr auto members(auto& m)
+    {
+        return std::tie(m.m11, m.m12, m.m13, m.m14, m.m21, m.m22, m.m23, m.m24,
+                        m.m31, m.m32, m.m33, m.m34, m.m41, m.m42, m.m43, m.m44);
+    }
+};
+
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+struct Layout<Matrix<T, M, N, Order_V>> {
+    static constexpr bool in_memory_order = (Order_V == MatrixPolicies::Order::RowMajor) || (M == 1) || (N == 1);
+
+    static constexpr auto members(auto& m)
+    {
+        if constexpr (in_memory_order) {
+            return std::tie(m.m);
+        } else {
+            return [&m]<std::size_t... I>(std::index_sequence<I...>) {
+                return std::tie(m(I / N, I % N)...);
+            }(std::make_index_sequence<M * N>{});
+        }
+    }
+};
+
+template<typename T>
+struct Layout<Transform2<T>> {
+    static constexpr auto members(auto& t) { return std::tie(t.m); }
+};
+
+template<typename T>
+struct Layout<Transform3<T>> {
+    static constexpr auto members(auto& t) { return std::tie(t.m); }
+};
+
+template<typename T>
+struct Layout<AABB2<T>> {
+    static constexpr auto members(auto& b) { return std::tie(b.min, b.max); }
+};
+
+template<typename T>
+struct Layout<AABB3<T>> {
+    static constexpr auto members(auto& b) { return std::tie(b.min, b.max); }
+};
+
+template<typename T>
+struct Layout<Circle2<T>> {
+    static constexpr auto members(auto& c) { return std::tie(c.center, c.radius); }
+};
+
+template<typename T>
+struct Layout<Sphere3<T>> {
+    static constexpr auto members(auto& s) { return std::tie(s.center, s.radius); }
+};
+
+template<typename T>
+struct Layout<OBB3<T>> {
+    static constexpr auto members(auto& b) { return std::tie(b.center, b.orientation, b.halfwidth); }
+};
+
+template<typename T>
+struct Layout<Plane3<T>> {
+    static constexpr auto members(auto& p) { return std::tie(p.n, p.d); }
+};
+
+template<typename T>
+struct Layout<Triangle3<T>> {
+    static constexpr auto members(auto& t) { return std::tie(t.a, t.b, t.c); }
+};
+}
+
+namespace binary_io_detail
+{
+template<typename T>
+struct IsStdArray : std::false_type {};
+
+template<typename T, std::size_t N>
+struct IsStdArray<std::array<T, N>> : std::true_type {
+    using ElementType = T;
+};
+
+template<typename T>
+concept BinaryScalar = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+/** Invokes f on every scalar member of obj, recursively, in the order given by their Layout.
+ */
+template<typename Type, typename F>
+constexpr void visit_scalars(Type& obj, F& f)
+{
+    using U = std::remove_const_t<Type>;
+    if constexpr (BinaryScalar<U>) {
+        f(obj);
+    } else if constexpr (IsStdArray<U>::value) {
+        for (auto& e : obj) { visit_scalars(e, f); }
+    } else {
+        std::apply([&f](auto&... m) { (visit_scalars(m, f), ...); }, BinaryIOTraits::Layout<U>::members(obj));
+    }
+}
+
+template<typename Tuple_T>
+struct TupleScalars;
+
+template<typename U>
+inline constexpr bool layout_in_memory_order_v = true;
+
+template<typename U>
+    requires requires { BinaryIOTraits::Layout<U>::in_memory_order; }
+inline constexpr bool layout_in_memory_order_v<U> = BinaryIOTraits::Layout<U>::in_memory_order;
+
+template<typename U>
+struct ScalarInfo {
+    using MembersTuple = decltype(BinaryIOTraits::Layout<U>::members(std::declval<U&>()));
+    using ScalarType = typename TupleScalars<MembersTuple>::ScalarType;
+    static constexpr std::size_t count = TupleScalars<MembersTuple>::count;
+    static constexpr bool in_memory_order =
+        layout_in_memory_order_v<U> && TupleScalars<MembersTuple>::in_memory_order;
+};
+
+template<BinaryScalar U>
+struct ScalarInfo<U> {
+    using ScalarType = U;
+    static constexpr std::size_t count = 1;
+    static constexpr bool in_memory_order = true;
+};
+
+template<typename U, std::size_t N>
+struct ScalarInfo<std::array<U, N>> {
+    using ScalarType = typename ScalarInfo<U>::ScalarType;
+    static constexpr std::size_t count = N * ScalarInfo<U>::count;
+    static constexpr bool in_memory_order = ScalarInfo<U>::in_memory_order;
+};
+
+template<typename... Ts>
+struct TupleScalars<std::tuple<Ts&...>> {
+    using ScalarType = typename ScalarInfo<std::remove_const_t<std::tuple_element_t<0, std::tuple<Ts...>>>>::ScalarType;
+    static_assert((std::same_as<typename ScalarInfo<std::remove_const_t<Ts>>::ScalarType, ScalarType> && ...),
+                  "All scalars of a type must be of the same type.");
+    static constexpr std::size_t count = (ScalarInfo<std::remove_const_t<Ts>>::count + ...);
+    static constexpr bool in_memory_order = (ScalarInfo<std::remove_const_t<Ts>>::in_memory_order && ...);
+};
+
+template<typename T>
+concept HasLayout = BinaryScalar<T> || requires(T& t) { BinaryIOTraits::Layout<T>::members(t); };
+
+template<std::size_t N>
+struct UnsignedOfSize;
+template<> struct UnsignedOfSize<1> { using Type = std::uint8_t; };
+template<> struct UnsignedOfSize<2> { using Type = std::uint16_t; };
+template<> struct UnsignedOfSize<4> { using Type = std::uint32_t; };
+template<> struct UnsignedOfSize<8> { using Type = std::uint64_t; };
+
+template<BinaryScalar T>
+inline void store_scalar(T s, std::byte* out, std::endian byte_order)
+{
+    using UInt = typename UnsignedOfSize<sizeof(T)>::Type;
+    UInt bits = std::bit_cast<UInt>(s);
+    if (byte_order != std::endian::native) { bits = std::byteswap(bits); }
+    std::memcpy(out, &bits, sizeof(T));
+}
+
+template<BinaryScalar T>
+[[nodiscard]] inline T load_scalar(std::byte const* in, std::endian byte_order)
+{
+    using UInt = typename UnsignedOfSize<sizeof(T)>::Type;
+    UInt bits;
+    std::memcpy(&bits, in, sizeof(T));
+    if (byte_order != std::endian::native) { bits = std::byteswap(bits); }
+    return std::bit_cast<T>(bits);
+}
+}
+
+/** Types that can be serialized with write_binary() and read_binary().
+ * These are the arithmetic types and all types with a BinaryIOTraits::Layout specialization.
+ */
+template<typename T>
+concept BinarySerializable = binary_io_detail::HasLayout<T>;
+
+/** The type of the scalars that make up a serializable type.
+ */
+template<BinarySerializable T>
+using BinaryScalarType = typename binary_io_detail::ScalarInfo<T>::ScalarType;
+
+/** Number of bytes used by a single value in the binary format.
+ */
+template<BinarySerializable T>
+inline constexpr std::size_t binary_size_v =
+    binary_io_detail::ScalarInfo<T>::count * sizeof(BinaryScalarType<T>);
+
+/** True if the in-memory representation of T with native byte order equals its binary format,
+ * which allows bulk reads and writes with a single memcpy.
+ */
+template<BinarySerializable T>
+inline constexpr bool is_binary_memcpyable_v = std::is_trivially_copyable_v<T> && (sizeof(T) == binary_size_v<T>) &&
+                                               binary_io_detail::ScalarInfo<T>::in_memory_order;
+
+enum class BinaryScalarKind : std::uint8_t {
+    FloatingPoint = 0,
+    SignedInteger = 1,
+    UnsignedInteger = 2
+};
+
+/** Decoded header of a binary stream.
+ */
+struct BinaryHeader {
+    static constexpr std::size_t size = 24;
+    static constexpr std::uint16_t current_version = 1;
+
+    std::uint16_t version;
+    std::endian byte_order;
+    BinaryScalarKind scalar_kind;
+    std::uint8_t scalar_size;
+    std::uint32_t scalars_per_element;
+    std::uint64_t count;
+
+    friend constexpr bool operator==(BinaryHeader const&, BinaryHeader const&) = default;
+};
+
+/** Header describing count values of type T, stored with the given byte order.
+ */
+template<BinarySerializable T>
+[[nodiscard]] constexpr inline BinaryHeader make_binary_header(std::uint64_t count,
+                                                               std::endian byte_order = std::endian::little)
+{
+    using Scalar = BinaryScalarType<T>;
+    BinaryScalarKind const kind = std::is_floating_point_v<Scalar> ? BinaryScalarKind::FloatingPoint :
+                                  (std::is_signed_v<Scalar> ? BinaryScalarKind::SignedInteger :
+                                                              BinaryScalarKind::UnsignedInteger);
+    return BinaryHeader{ BinaryHeader::current_version, byte_order, kind, static_cast<std::uint8_t>(sizeof(Scalar)),
+                         static_cast<std::uint32_t>(binary_io_detail::ScalarInfo<T>::count), count };
+}
+
+/** Checks whether the elements described by a header can be read as values of type T.
+ */
+template<BinarySerializable T>
+[[nodiscard]] constexpr inline bool is_compatible(BinaryHeader const& header)
+{
+    BinaryHeader const expected = make_binary_header<T>(header.count, header.byte_order);
+    return (header.scalar_kind == expected.scalar_kind) && (header.scalar_size == expected.scalar_size) &&
+           (header.scalars_per_element == expected.scalars_per_element);
+}
+
+inline void write_binary_header(BinaryHeader const& header, std::span<std::byte, BinaryHeader::size> out)
+{
+    using binary_io_detail::store_scalar;
+    std::fill(out.begin(), out.end(), std::byte{ 0 });
+    out[0] = std::byte{ 'G' };
+    out[1] = std::byte{ 'B' };
+    out[2] = std::byte{ 'M' };
+    out[3] = std::byte{ 'B' };
+    store_scalar(header.version, out.data() + 4, std::endian::little);
+    out[6] = std::byte{ static_cast<std::uint8_t>((header.byte_order == std::endian::big) ? 1 : 0) };
+    out[7] = std::byte{ static_cast<std::uint8_t>(header.scalar_kind) };
+    out[8] = std::byte{ header.scalar_size };
+    store_scalar(header.scalars_per_element, out.data() + 12, std::endian::little);
+    store_scalar(header.count, out.data() + 16, std::endian::little);
+}
+
+/** Decodes a header.
+ * @return The header, or std::nullopt if the magic number does not match, the version is not supported
+ *         or a field has an invalid value.
+ */
+[[nodiscard]] inline std::optional<BinaryHeader> read_binary_header(std::span<std::byte const, BinaryHeader::size> in)
+{
+    using binary_io_detail::load_scalar;
+    if ((in[0] != std::byte{ 'G' }) || (in[1] != std::byte{ 'B' }) ||
+        (in[2] != std::byte{ 'M' }) || (in[3] != std::byte{ 'B' }))
+    {
+        return std::nullopt;
+    }
+    BinaryHeader ret;
+    ret.version = load_scalar<std::uint16_t>(in.data() + 4, std::endian::little);
+    if ((ret.version == 0) || (ret.version > BinaryHeader::current_version)) { return std::nullopt; }
+    auto const byte_order = static_cast<std::uint8_t>(in[6]);
+    auto const scalar_kind = static_cast<std::uint8_t>(in[7]);
+    if ((byte_order > 1) || (scalar_kind > 2)) { return std::nullopt; }
+    ret.byte_order = (byte_order == 1) ? std::endian::big : std::endian::little;
+    ret.scalar_kind = static_cast<BinaryScalarKind>(scalar_kind);
+    ret.scalar_size = static_cast<std::uint8_t>(in[8]);
+    ret.scalars_per_element = load_scalar<std::uint32_t>(in.data() + 12, std::endian::little);
+    ret.count = load_scalar<std::uint64_t>(in.data() + 16, std::endian::little);
+    return ret;
+}
+
+/** Writes values in the binary format without a header.
+ * @pre out.size() >= values.size() * binary_size_v<T>
+ * @return The number of bytes written.
+ */
+template<BinarySerializable T>
+inline std::size_t write_binary(std::span<T const> values, std::span<std::byte> out,
+                                std::endian byte_order = std::endian::little)
+{
+    std::size_t const n_bytes = values.size() * binary_size_v<T>;
+    assert(out.size() >= n_bytes);
+    if constexpr (is_binary_memcpyable_v<T>) {
+        if (byte_order == std::endian::native) {
+            if (n_bytes > 0) { std::memcpy(out.data(), values.data(), n_bytes); }
+            return n_bytes;
+        }
+    }
+    std::byte* it = out.data();
+    auto store = [&it, byte_order](auto s) {
+        binary_io_detail::store_scalar(s, it, byte_order);
+        it += sizeof(s);
+    };
+    for (T const& v : values) {
+        binary_io_detail::visit_scalars(v, store);
+    }
+    return n_bytes;
+}
+
+/** Reads values in the binary format without a header.
+ * @pre in.size() >= values.size() * binary_size_v<T>
+ * @return The number of bytes read.
+ */
+template<BinarySerializable T>
+inline std::size_t read_binary(std::span<std::byte const> in, std::span<T> values,
+                               std::endian byte_order = std::endian::little)
+{
+    std::size_t const n_bytes = values.size() * binary_size_v<T>;
+    assert(in.size() >= n_bytes);
+    if constexpr (is_binary_memcpyable_v<T>) {
+        if (byte_order == std::endian::native) {
+            if (n_bytes > 0) { std::memcpy(values.data(), in.data(), n_bytes); }
+            return n_bytes;
+        }
+    }
+    std::byte const* it = in.data();
+    auto load = [&it, byte_order]<typename S>(S& s) {
+        s = binary_io_detail::load_scalar<S>(it, byte_order);
+        it += sizeof(S);
+    };
+    for (T& v : values) {
+        binary_io_detail::visit_scalars(v, load);
+    }
+    return n_bytes;
+}
+
+/** Writes a header followed by the values to a binary stream.
+ * With native byte order, memcpy-able types are written directly from values; otherwise values are converted
+ * in chunks through a small buffer.
+ */
+template<BinarySerializable T>
+inline std::ostream& write_binary(std::ostream& os, std::span<T const> values,
+                                  std::endian byte_order = std::endian::little)
+{
+    std::array<std::byte, BinaryHeader::size> header;
+    write_binary_header(make_binary_header<T>(values.size(), byte_order), header);
+    os.write(reinterpret_cast<char const*>(header.data()), header.size());
+    if constexpr (is_binary_memcpyable_v<T>) {
+        if (byte_order == std::endian::native) {
+            return os.write(reinterpret_cast<char const*>(values.data()), values.size() * binary_size_v<T>);
+        }
+    }
+    constexpr std::size_t chunk_elements = std::max<std::size_t>(4096 / binary_size_v<T>, 1);
+    std::vector<std::byte> buffer(chunk_elements * binary_size_v<T>);
+    for (std::size_t i = 0; (i < values.size()) && os; i += chunk_elements) {
+        auto const chunk = values.subspan(i, std::min(chunk_elements, values.size() - i));
+        std::size_t const n_bytes = write_binary(chunk, std::span<std::byte>(buffer), byte_order);
+        os.write(reinterpret_cast<char const*>(buffer.data()), n_bytes);
+    }
+    return os;
+}
+
+/** Reads a header and the values following it from a binary stream, replacing the contents of values.
+ * Sets failbit on the stream if the header is invalid or describes elements that are not compatible with T,
+ * or if the stream ends before all values were read.
+ */
+template<BinarySerializable T>
+inline std::istream& read_binary(std::istream& is, std::vector<T>& values)
+{
+    std::array<std::byte, BinaryHeader::size> header_bytes;
+    if (!is.read(reinterpret_cast<char*>(header_bytes.data()), header_bytes.size())) { return is; }
+    std::optional<BinaryHeader> const header = read_binary_header(header_bytes);
+    if (!header || !is_compatible<T>(*header)) {
+        is.setstate(std::ios_base::failbit);
+        return is;
+    }
+    values.clear();
+    constexpr std::size_t chunk_elements = std::max<std::size_t>(4096 / binary_size_v<T>, 1);
+    std::vector<std::byte> buffer(chunk_elements * binary_size_v<T>);
+    // grow in chunks instead of trusting the element count for a single allocation
+    for (std::uint64_t i = 0; i < header->count; i += chunk_elements) {
+        std::size_t const n = static_cast<std::size_t>(std::min<std::uint64_t>(chunk_elements, header->count - i));
+        if (!is.read(reinterpret_cast<char*>(buffer.data()), n * binary_size_v<T>)) { return is; }
+        std::size_t const offset = values.size();
+        values.resize(offset + n);
+        read_binary(std::span<std::byte const>(buffer), std::span<T>(values).subspan(offset, n), header->byte_order);
+    }
+    return is;
+}
+}
+
+#endif
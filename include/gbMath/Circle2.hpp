@@ -9,6 +9,7 @@
 
 #include <gbMath/config.hpp>
 
+#include <gbMath/AABB2.hpp>
 #include <gbMath/Common.hpp>
 #include <gbMath/Line2.hpp>
 #include <gbMath/NumberTypeTraits.hpp>
@@ -62,6 +63,12 @@ template<typename T>
     return (squared_dist <= radii_sum*radii_sum);
 }
 
+template<typename T>
+[[nodiscard]] constexpr inline bool collides(Circle2<T> const& c, AABB2<T> const& b)
+{
+    return distance_squared(b, c.center) <= c.radius*c.radius;
+}
+
 template<typename T>
 struct Circle2Line2IntersectionParameters
 {
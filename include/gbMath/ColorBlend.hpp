@@ -0,0 +1,254 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_COLOR_BLEND_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_COLOR_BLEND_HPP
+
+/** @file
+ *
+ * @brief Blending and compositing of colors.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Color4.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/PackedColor.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning structure-of-arrays view of a set of colors, with one plane per channel.
+ * T may be const-qualified for read-only views. All spans must have the same size.
+ */
+template<typename T>
+struct Color4SoA {
+    std::span<T> r;
+    std::span<T> g;
+    std::span<T> b;
+    std::span<T> a;
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        assert((g.size() == r.size()) && (b.size() == r.size()) && (a.size() == r.size()));
+        return r.size();
+    }
+
+    [[nodiscard]] constexpr Color4<std::remove_const_t<T>> operator[](std::size_t idx) const
+    {
+        return Color4<std::remove_const_t<T>>(r[idx], g[idx], b[idx], a[idx]);
+    }
+
+    constexpr void set(std::size_t idx, Color4<T> const& c) const requires(!std::is_const_v<T>)
+    {
+        r[idx] = c.r;
+        g[idx] = c.g;
+        b[idx] = c.b;
+        a[idx] = c.a;
+    }
+
+    constexpr operator Color4SoA<T const>() const requires(!std::is_const_v<T>)
+    {
+        return Color4SoA<T const>{ r, g, b, a };
+    }
+};
+
+/** @name Blending of colors with premultiplied alpha.
+ * Each function composites the color src onto the color dst and returns the result.
+ * - Over is the Porter-Duff source-over operator.
+ * - Additive sums all color channels; alpha is clamped to 1. Color channels are not clamped, so this
+ *   can be used for colors with high dynamic range.
+ * - Multiply multiplies the color channels where the two colors overlap and composites the rest with
+ *   source-over, as defined for the multiply blend mode in the W3C Compositing and Blending specification.
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_over_premultiplied(Color4<T> const& src, Color4<T> const& dst)
+{
+    T const inv_src_a = traits::Constants<T>::One() - src.a;
+    return Color4<T>(src.r + dst.r * inv_src_a, src.g + dst.g * inv_src_a, src.b + dst.b * inv_src_a,
+                     src.a + dst.a * inv_src_a);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_additive_premultiplied(Color4<T> const& src, Color4<T> const& dst)
+{
+    T const alpha = src.a + dst.a;
+    T const one = traits::Constants<T>::One();
+    return Color4<T>(src.r + dst.r, src.g + dst.g, src.b + dst.b, (alpha < one) ? alpha : one);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_multiply_premultiplied(Color4<T> const& src, Color4<T> const& dst)
+{
+    T const one = traits::Constants<T>::One();
+    T const inv_src_a = one - src.a;
+    T const inv_dst_a = one - dst.a;
+    return Color4<T>(src.r * inv_dst_a + dst.r * inv_src_a + src.r * dst.r,
+                     src.g * inv_dst_a + dst.g * inv_src_a + src.g * dst.g,
+                     src.b * inv_dst_a + dst.b * inv_src_a + src.b * dst.b,
+                     src.a + dst.a * inv_src_a);
+}
+///@}
+
+/** @name Blending of colors with straight alpha.
+ * These give the same results as the respective functions for premultiplied alpha, with both inputs and the
+ * result converted from and to straight alpha. Fully transparent results convert to (0, 0, 0, 0).
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_over(Color4<T> const& src, Color4<T> const& dst)
+{
+    return unpremultiplied(blend_over_premultiplied(premultiplied(src), premultiplied(dst)));
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_additive(Color4<T> const& src, Color4<T> const& dst)
+{
+    return unpremultiplied(blend_additive_premultiplied(premultiplied(src), premultiplied(dst)));
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> blend_multiply(Color4<T> const& src, Color4<T> const& dst)
+{
+    return unpremultiplied(blend_multiply_premultiplied(premultiplied(src), premultiplied(dst)));
+}
+///@}
+
+namespace color_blend_detail
+{
+template<typename T, typename Kernel_T>
+inline void blend_each(std::span<Color4<T> const> src, std::span<Color4<T>> dst, Kernel_T&& kernel)
+{
+    assert(dst.size() >= src.size());
+    for (std::size_t i = 0; i < src.size(); ++i) { dst[i] = kernel(src[i], dst[i]); }
+}
+
+template<typename T, typename Kernel_T>
+inline void blend_each(Color4SoA<T const> const& src, Color4SoA<T> const& dst, Kernel_T&& kernel)
+{
+    std::size_t const n = src.size();
+    assert(dst.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        Color4<T> const c = kernel(Color4<T>(src.r[i], src.g[i], src.b[i], src.a[i]),
+                                   Color4<T>(dst.r[i], dst.g[i], dst.b[i], dst.a[i]));
+        dst.r[i] = c.r;
+        dst.g[i] = c.g;
+        dst.b[i] = c.b;
+        dst.a[i] = c.a;
+    }
+}
+}
+
+/** @name Bulk blending.
+ * Composite each color of src onto the color with the same index in dst, storing the result in dst.
+ * Colors are given either as spans of Color4 or as structure-of-arrays planes.
+ * The results are identical to those of the respective single color functions. The premultiplied kernels
+ * are branch-free, so the compiler can vectorize the loops; planar data avoids the interleaving shuffles.
+ * @pre dst has at least as many elements as src.
+ */
+///@{
+template<std::floating_point T>
+inline void blend_over_premultiplied(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_over_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_additive_premultiplied(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_additive_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_multiply_premultiplied(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_multiply_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_over(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_over(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_additive(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_additive(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_multiply(std::span<Color4<T> const> src, std::span<Color4<T>> dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_multiply(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_over_premultiplied(std::type_identity_t<Color4SoA<T const>> const& src, Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_over_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_additive_premultiplied(std::type_identity_t<Color4SoA<T const>> const& src,
+                                         Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_additive_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_multiply_premultiplied(std::type_identity_t<Color4SoA<T const>> const& src,
+                                         Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_multiply_premultiplied(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_over(std::type_identity_t<Color4SoA<T const>> const& src, Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_over(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_additive(std::type_identity_t<Color4SoA<T const>> const& src, Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_additive(s, d);
+        });
+}
+
+template<std::floating_point T>
+inline void blend_multiply(std::type_identity_t<Color4SoA<T const>> const& src, Color4SoA<T> const& dst)
+{
+    color_blend_detail::blend_each(src, dst, [](Color4<T> const& s, Color4<T> const& d) {
+            return blend_multiply(s, d);
+        });
+}
+///@}
+}
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_COLOR_SRGB_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_COLOR_SRGB_HPP
+
+/** @file
+ *
+ * @brief Conversion between sRGB encoded and linear colors.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Color4.hpp>
+#include <gbMath/PackedColor.hpp>
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** @name Exact sRGB transfer functions.
+ * Conversions follow the piecewise definition of IEC 61966-2-1.
+ * The Color4 overloads convert the color channels and leave alpha untouched, as alpha is always linear.
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] inline T srgb_to_linear(T v)
+{
+    return (v <= static_cast<T>(0.04045)) ? (v / static_cast<T>(12.92)) :
+                                            std::pow((v + static_cast<T>(0.055)) / static_cast<T>(1.055),
+                                                     static_cast<T>(2.4));
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline T linear_to_srgb(T v)
+{
+    return (v <= static_cast<T>(0.0031308)) ? (v * static_cast<T>(12.92)) :
+                                              (static_cast<T>(1.055) * std::pow(v, static_cast<T>(1.0 / 2.4)) -
+                                               static_cast<T>(0.055));
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline Color4<T> srgb_to_linear(Color4<T> const& c)
+{
+    return Color4<T>(srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b), c.a);
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline Color4<T> linear_to_srgb(Color4<T> const& c)
+{
+    return Color4<T>(linear_to_srgb(c.r), linear_to_srgb(c.g), linear_to_srgb(c.b), c.a);
+}
+///@}
+
+namespace srgb_detail
+{
+/** Table of the linear values for all 8 bit sRGB values, computed on first use.
+ */
+[[nodiscard]] inline std::array<float, 256> const& decode_table()
+{
+    static std::array<float, 256> const table = []() {
+        std::array<float, 256> ret;
+        for (std::size_t i = 0; i < ret.size(); ++i) {
+            ret[i] = static_cast<float>(srgb_to_linear(static_cast<double>(i) / 255.0));
+        }
+        return ret;
+    }();
+    return table;
+}
+}
+
+/** @name Approximate sRGB encoding.
+ * Replaces the power function of the exact encoding with a rational approximation in sqrt(v).
+ * Input values are saturated to [0, 1]; NaN converts to 0.
+ * For inputs in [0, 1], the absolute error compared to linear_to_srgb() is below 4e-6, which is less than
+ * 1/900th of an 8 bit step. The function only uses arithmetic and a square root, so loops over it vectorize well.
+ */
+///@{
+[[nodiscard]] inline float linear_to_srgb_fast(float v)
+{
+    float const s = (v > 0.f) ? ((v < 1.f) ? v : 1.f) : 0.f;
+    float const t = std::sqrt(s);
+    float const p = ((17.9485283f * t + 17.850111f) * t + 1.17468917f) * t - 0.0489380136f;
+    float const q = ((0.885220408f * t + 20.5684509f) * t + 14.4708424f) * t + 1.f;
+    return (s <= 0.0031308f) ? (s * 12.92f) : (p / q);
+}
+
+[[nodiscard]] inline Color4<float> linear_to_srgb_fast(Color4<float> const& c)
+{
+    return Color4<float>(linear_to_srgb_fast(c.r), linear_to_srgb_fast(c.g), linear_to_srgb_fast(c.b), c.a);
+}
+///@}
+
+/** @name Conversion between linear colors and 8 bit sRGB.
+ * Decoding looks up the color channels in a 256 entry table. Encoding uses linear_to_srgb_fast() and rounds
+ * to nearest; the result may differ from rounding the exact value only for values that are within the error
+ * bound of a rounding boundary. Alpha is converted as a linear unsigned normalized value.
+ */
+///@{
+[[nodiscard]] inline float srgb8_to_linear(std::uint8_t v)
+{
+    return srgb_detail::decode_table()[v];
+}
+
+[[nodiscard]] inline Color4<float> srgb_to_linear(ColorRGBA8 const& c)
+{
+    std::array<float, 256> const& table = srgb_detail::decode_table();
+    return Color4<float>(table[c.r], table[c.g], table[c.b], packed_color_detail::from_unorm<255, float>(c.a));
+}
+
+[[nodiscard]] inline ColorRGBA8 linear_to_srgb8(Color4<float> const& c)
+{
+    using packed_color_detail::to_unorm;
+    return ColorRGBA8{ static_cast<std::uint8_t>(to_unorm<255>(linear_to_srgb_fast(c.r))),
+                       static_cast<std::uint8_t>(to_unorm<255>(linear_to_srgb_fast(c.g))),
+                       static_cast<std::uint8_t>(to_unorm<255>(linear_to_srgb_fast(c.b))),
+                       static_cast<std::uint8_t>(to_unorm<255>(c.a)) };
+}
+///@}
+
+/** @name Bulk conversion.
+ * Apply the single color conversions to each element of a span.
+ * The output span must be at least as large as the input span.
+ */
+///@{
+template<std::floating_point T>
+inline void srgb_to_linear(std::span<Color4<T> const> colors, std::span<Color4<T>> out)
+{
+    assert(out.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { out[i] = srgb_to_linear(colors[i]); }
+}
+
+template<std::floating_point T>
+inline void linear_to_srgb(std::span<Color4<T> const> colors, std::span<Color4<T>> out)
+{
+    assert(out.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { out[i] = linear_to_srgb(colors[i]); }
+}
+
+inline void linear_to_srgb_fast(std::span<Color4<float> const> colors, std::span<Color4<float>> out)
+{
+    assert(out.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { out[i] = linear_to_srgb_fast(colors[i]); }
+}
+
+inline void srgb_to_linear(std::span<ColorRGBA8 const> colors, std::span<Color4<float>> out)
+{
+    assert(out.size() >= colors.size());
+    std::array<float, 256> const& table = srgb_detail::decode_table();
+    for (std::size_t i = 0; i < colors.size(); ++i) {
+        ColorRGBA8 const c = colors[i];
+        out[i] = Color4<float>(table[c.r], table[c.g], table[c.b], packed_color_detail::from_unorm<255, float>(c.a));
+    }
+}
+
+inline void linear_to_srgb8(std::span<Color4<float> const> colors, std::span<ColorRGBA8> out)
+{
+    assert(out.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { out[i] = linear_to_srgb8(colors[i]); }
+}
+///@}
+}
+
+#endif
@@ -9,6 +9,12 @@
 
 #include <gbMath/config.hpp>
 
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
 namespace GHULBUS_MATH_NAMESPACE
 {
     /** Tag indicating that an operation will leave certain data members uninitialized.
@@ -16,6 +22,36 @@ namespace GHULBUS_MATH_NAMESPACE
     struct DoNotInitialize_Tag {};
 
     inline constinit const DoNotInitialize_Tag doNotInitialize;
+
+    /** Default for the optional parallel_for parameter of functions that can distribute independent work items.
+     * Runs f(0), ..., f(count - 1) one after another.
+     */
+    struct SequentialFor {
+        template<typename F>
+        void operator()(std::size_t count, F&& f) const
+        {
+            for (std::size_t i = 0; i < count; ++i) { f(i); }
+        }
+    };
+
+    /** Approximates 1 / sqrt(x) for x > 0.
+     * For float, this refines a bit-level initial estimate with two Newton-Raphson steps, avoiding both
+     * the square root and the division. The relative error is below 5e-6 for all positive normal floats.
+     * For all other types, this evaluates 1 / sqrt(x).
+     */
+    template<std::floating_point T>
+    [[nodiscard]] inline T rsqrt_fast(T x)
+    {
+        if constexpr (std::same_as<T, float>) {
+            float const half_x = 0.5f * x;
+            float y = std::bit_cast<float>(std::uint32_t{ 0x5f375a86 } - (std::bit_cast<std::uint32_t>(x) >> 1));
+            y = y * (1.5f - half_x * y * y);
+            y = y * (1.5f - half_x * y * y);
+            return y;
+        } else {
+            return T{ 1 } / std::sqrt(x);
+        }
+    }
 }
 
 #endif
@@ -0,0 +1,183 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_CONJUGATE_GRADIENT_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_CONJUGATE_GRADIENT_HPP
+
+/** @file
+ *
+ * @brief Preconditioned conjugate gradient solver for sparse matrices.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Common.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/SparseMatrix.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+template<typename T>
+struct ConjugateGradientResult {
+    int iterations;         ///< Number of iterations performed.
+    T residual_norm;        ///< Norm of the final residual b - A*x, relative to the norm of b.
+    bool converged;         ///< True if the residual dropped below the requested tolerance.
+};
+
+/** Scratch storage for conjugate_gradient().
+ * The buffers are resized to the size of the system on each solve. Reusing a workspace for repeated solves of
+ * systems of the same size, like once per simulation frame, avoids all allocations after the first solve.
+ */
+template<typename Block_T>
+struct ConjugateGradientWorkspace {
+    using VectorElementType = typename BasicSparseMatrix<Block_T>::VectorElementType;
+
+    std::vector<Block_T> inv_diagonal;
+    std::vector<VectorElementType> r;
+    std::vector<VectorElementType> z;
+    std::vector<VectorElementType> p;
+    std::vector<VectorElementType> q;
+};
+
+namespace conjugate_gradient_detail
+{
+/** Number of rows of the matrix-vector product handled by a single parallel_for task.
+ */
+inline constexpr std::size_t rows_per_task = 1024;
+
+/** Computes y = A * x, distributing blocks of rows_per_task rows with parallel_for.
+ */
+template<typename Block_T, typename ParallelFor_T>
+inline void multiply(BasicSparseMatrix<Block_T> const& a,
+                     std::span<typename BasicSparseMatrix<Block_T>::VectorElementType const> x,
+                     std::span<typename BasicSparseMatrix<Block_T>::VectorElementType> y,
+                     ParallelFor_T&& parallel_for)
+{
+    std::size_t const n = a.rows();
+    parallel_for((n + rows_per_task - 1) / rows_per_task, [&a, x, y, n](std::size_t task) {
+            std::size_t const row_begin = task * rows_per_task;
+            a.multiply(x, y, row_begin, std::min(row_begin + rows_per_task, n));
+        });
+}
+}
+
+/** Solves the system A * x = b for a symmetric positive definite sparse matrix A with the conjugate gradient method,
+ * using the inverses of the diagonal blocks of A as a preconditioner (Jacobi, or block-Jacobi for block matrices).
+ * On entry, x holds the initial guess, which allows warm-starting from the solution of a previous frame.
+ * On exit, x holds the approximate solution.
+ * The matrix-vector products are distributed in blocks of rows with parallel_for. The library does not spawn
+ * threads itself; parallel_for(count, f) is expected to invoke f(i) for all i in [0, count), and may do so
+ * concurrently, e.g. by handing the calls to a thread pool.
+ * @param[in] tolerance Iteration stops once |b - A*x| <= tolerance * |b|.
+ * @param[in] max_iterations Upper limit on the number of iterations.
+ * @param[in,out] workspace Scratch storage, see ConjugateGradientWorkspace.
+ */
+template<typename Block_T, typename ParallelFor_T>
+inline ConjugateGradientResult<typename BasicSparseMatrix<Block_T>::ValueType>
+    conjugate_gradient(BasicSparseMatrix<Block_T> const& a,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType const> b,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType> x,
+                       typename BasicSparseMatrix<Block_T>::ValueType tolerance,
+                       int max_iterations,
+                       ConjugateGradientWorkspace<Block_T>& workspace,
+                       ParallelFor_T&& parallel_for)
+{
+    using std::sqrt;
+    using T = typename BasicSparseMatrix<Block_T>::ValueType;
+    using Element_T = typename BasicSparseMatrix<Block_T>::VectorElementType;
+    using Traits = SparseMatrixTraits::BlockTraits<Block_T>;
+    assert(a.rows() == a.columns());
+    std::size_t const n = a.rows();
+    assert((b.size() == n) && (x.size() == n));
+
+    auto const inner = [n](std::span<Element_T const> lhs, std::span<Element_T const> rhs) {
+        T acc = traits::Constants<T>::Zero();
+        for (std::size_t i = 0; i < n; ++i) {
+            acc += Traits::inner_product(lhs[i], rhs[i]);
+        }
+        return acc;
+    };
+    auto const multiply = [&a, &parallel_for](std::span<Element_T const> v, std::span<Element_T> result) {
+        conjugate_gradient_detail::multiply(a, v, result, parallel_for);
+    };
+
+    T const b_norm = sqrt(inner(b, b));
+    if (b_norm == traits::Constants<T>::Zero()) {
+        for (auto& e : x) { e = Element_T{}; }
+        return ConjugateGradientResult<T>{ 0, traits::Constants<T>::Zero(), true };
+    }
+    T const threshold = tolerance * b_norm;
+
+    workspace.inv_diagonal.resize(n);
+    workspace.r.resize(n);
+    workspace.z.resize(n);
+    workspace.p.resize(n);
+    workspace.q.resize(n);
+    a.inverse_diagonal(workspace.inv_diagonal);
+    std::span<Block_T const> const inv_diagonal(workspace.inv_diagonal);
+    std::span<Element_T> const r(workspace.r);
+    std::span<Element_T> const z(workspace.z);
+    std::span<Element_T> const p(workspace.p);
+    std::span<Element_T> const q(workspace.q);
+
+    // r = b - A*x; z = M^-1 * r; p = z
+    multiply(x, q);
+    for (std::size_t i = 0; i < n; ++i) {
+        r[i] = b[i] - q[i];
+        z[i] = inv_diagonal[i] * r[i];
+        p[i] = z[i];
+    }
+    T rz = inner(r, z);
+    T r_norm = sqrt(inner(r, r));
+
+    int iteration = 0;
+    for (; (iteration < max_iterations) && (r_norm > threshold); ++iteration) {
+        multiply(p, q);
+        T const alpha = rz / inner(p, q);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * q[i];
+            z[i] = inv_diagonal[i] * r[i];
+        }
+        r_norm = sqrt(inner(r, r));
+        T const rz_new = inner(r, z);
+        T const beta = rz_new / rz;
+        rz = rz_new;
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = z[i] + beta * p[i];
+        }
+    }
+    return ConjugateGradientResult<T>{ iteration, r_norm / b_norm, r_norm <= threshold };
+}
+
+template<typename Block_T>
+inline ConjugateGradientResult<typename BasicSparseMatrix<Block_T>::ValueType>
+    conjugate_gradient(BasicSparseMatrix<Block_T> const& a,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType const> b,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType> x,
+                       typename BasicSparseMatrix<Block_T>::ValueType tolerance,
+                       int max_iterations,
+                       ConjugateGradientWorkspace<Block_T>& workspace)
+{
+    return conjugate_gradient(a, b, x, tolerance, max_iterations, workspace, SequentialFor{});
+}
+
+template<typename Block_T>
+inline ConjugateGradientResult<typename BasicSparseMatrix<Block_T>::ValueType>
+    conjugate_gradient(BasicSparseMatrix<Block_T> const& a,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType const> b,
+                       std::span<typename BasicSparseMatrix<Block_T>::VectorElementType> x,
+                       typename BasicSparseMatrix<Block_T>::ValueType tolerance,
+                       int max_iterations)
+{
+    ConjugateGradientWorkspace<Block_T> workspace;
+    return conjugate_gradient(a, b, x, tolerance, max_iterations, workspace, SequentialFor{});
+}
+}
+
+#endif
@@ -0,0 +1,636 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_CONVEX_COLLISION_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_CONVEX_COLLISION_HPP
+
+/** @file
+ *
+ * @brief Collision detection between convex shapes with GJK and EPA.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/OBB3.hpp>
+#include <gbMath/Sphere3.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <utility>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning view of the convex hull of a set of points.
+ * The points do not need to be the vertices of the hull; interior points are allowed, but cost time.
+ */
+template<typename T>
+struct ConvexHull3 {
+    std::span<Point3<T> const> points;
+};
+
+/** @name Support functions.
+ * Return a point of the shape that is furthest along the direction d, i.e. a point p that maximizes dot(p, d).
+ * The direction does not need to be normalized.
+ * Custom convex shapes can be used with gjk_distance() and friends by providing an overload of support() that
+ * can be found by argument-dependent lookup.
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] inline Point3<T> support(Sphere3<T> const& s, Vector3<T> const& d)
+{
+    T const len = length(d);
+    if (len == traits::Constants<T>::Zero()) {
+        return s.center + Vector3<T>(s.radius, traits::Constants<T>::Zero(), traits::Constants<T>::Zero());
+    }
+    return s.center + d * (s.radius / len);
+}
+
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> support(AABB3<T> const& b, Vector3<T> const& d)
+{
+    T const zero = traits::Constants<T>::Zero();
+    return Point3<T>((d.x >= zero) ? b.max.x : b.min.x,
+                     (d.y >= zero) ? b.max.y : b.min.y,
+                     (d.z >= zero) ? b.max.z : b.min.z);
+}
+
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> support(OBB3<T> const& o, Vector3<T> const& d)
+{
+    Point3<T> ret = o.center;
+    for (std::size_t i = 0; i < 3; ++i) {
+        Vector3<T> const axis = o.orientation.row(i);
+        ret += (dot(axis, d) >= traits::Constants<T>::Zero()) ? (axis * o.halfwidth[i]) : (axis * -o.halfwidth[i]);
+    }
+    return ret;
+}
+
+/** @pre The hull contains at least one point.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> support(ConvexHull3<T> const& h, Vector3<T> const& d)
+{
+    assert(!h.points.empty());
+    std::size_t best = 0;
+    T best_dot = dot(h.points[0] - Point3<T>(), d);
+    for (std::size_t i = 1; i < h.points.size(); ++i) {
+        T const p_dot = dot(h.points[i] - Point3<T>(), d);
+        if (p_dot > best_dot) {
+            best = i;
+            best_dot = p_dot;
+        }
+    }
+    return h.points[best];
+}
+///@}
+
+template<typename Shape_T, typename T>
+concept SupportMappedShape3 = requires(Shape_T const& s, Vector3<T> const& d) {
+    { support(s, d) } -> std::convertible_to<Point3<T>>;
+};
+
+/** A vertex of the Minkowski difference A - B, together with the points of A and B that it was built from.
+ */
+template<typename T>
+struct MinkowskiVertex3 {
+    Vector3<T> w;           ///< The vertex a - b.
+    Point3<T> a;            ///< Support point of shape A in direction d.
+    Point3<T> b;            ///< Support point of shape B in direction -d.
+    Vector3<T> d;           ///< Search direction that the vertex was obtained from.
+};
+
+/** Simplex state of the GJK algorithm.
+ * When testing the same pair of shapes in consecutive frames, passing the simplex of the previous frame
+ * warm-starts the search, which typically converges in one or two iterations for slowly moving shapes.
+ * Only the search directions are carried over; the vertices are recomputed from the current shapes.
+ * Use a default-constructed simplex, or call reset(), for a cold start.
+ */
+template<typename T>
+class GjkSimplex {
+public:
+    std::array<MinkowskiVertex3<T>, 4> vertices;
+    std::size_t size = 0;
+
+    constexpr void reset()
+    {
+        size = 0;
+    }
+};
+
+/** Result of a GJK distance query.
+ */
+template<typename T>
+struct GjkResult {
+    bool intersecting;      ///< True if the shapes overlap or touch.
+    T distance;             ///< Distance between the shapes; 0 if they are intersecting.
+    Point3<T> point_a;      ///< Point on A closest to B. Unspecified if intersecting.
+    Point3<T> point_b;      ///< Point on B closest to A. Unspecified if intersecting.
+    int iterations;         ///< Number of iterations performed.
+};
+
+/** Contact information between two convex shapes.
+ * The normal points from A towards B. If the shapes are separated, point_a and point_b are the closest points
+ * and distance is the positive distance between them. If the shapes overlap, distance is the negative
+ * penetration depth, and translating B by -distance * normal resolves the overlap.
+ */
+template<typename T>
+struct ConvexContact {
+    bool intersecting;
+    T distance;
+    Vector3<T> normal;
+    Point3<T> point_a;
+    Point3<T> point_b;
+};
+
+/** Tuning parameters for GJK and EPA.
+ */
+template<std::floating_point T>
+struct ConvexCollisionParameters {
+    /** Relative tolerance of the computed distances and penetration depths.
+     */
+    T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+    int max_iterations = 64;
+};
+
+namespace convex_collision_detail
+{
+template<typename T, typename ShapeA_T, typename ShapeB_T>
+[[nodiscard]] inline MinkowskiVertex3<T> make_vertex(ShapeA_T const& a, ShapeB_T const& b, Vector3<T> const& d)
+{
+    Point3<T> const pa = support(a, d);
+    Point3<T> const pb = support(b, -d);
+    return MinkowskiVertex3<T>{ pa - pb, pa, pb, d };
+}
+
+template<typename T>
+struct Barycentric3 {
+    std::array<T, 3> l;
+    T distance_squared;
+};
+
+/** Closest point to the origin on the segment [a, b], as barycentric coordinates.
+ */
+template<typename T>
+[[nodiscard]] inline Barycentric3<T> closest_on_segment(Vector3<T> const& a, Vector3<T> const& b)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const one = traits::Constants<T>::One();
+    Vector3<T> const ab = b - a;
+    T const denom = dot(ab, ab);
+    T const t = (denom > zero) ? std::clamp(-dot(a, ab) / denom, zero, one) : zero;
+    Vector3<T> const p = a + ab * t;
+    return Barycentric3<T>{ { one - t, t, zero }, dot(p, p) };
+}
+
+/** Closest point to the origin on the triangle [a, b, c], as barycentric coordinates.
+ * See Ericson - Real-Time Collision Detection, Section 5.1.5.
+ */
+template<typename T>
+[[nodiscard]] inline Barycentric3<T> closest_on_triangle(Vector3<T> const& a, Vector3<T> const& b,
+                                                         Vector3<T> const& c)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const one = traits::Constants<T>::One();
+    auto const result = [&](T la, T lb, T lc) {
+        Vector3<T> const p = a * la + b * lb + c * lc;
+        return Barycentric3<T>{ { la, lb, lc }, dot(p, p) };
+    };
+    Vector3<T> const ab = b - a;
+    Vector3<T> const ac = c - a;
+    T const d1 = -dot(ab, a);
+    T const d2 = -dot(ac, a);
+    if ((d1 <= zero) && (d2 <= zero)) { return result(one, zero, zero); }
+    T const d3 = -dot(ab, b);
+    T const d4 = -dot(ac, b);
+    if ((d3 >= zero) && (d4 <= d3)) { return result(zero, one, zero); }
+    T const vc = d1*d4 - d3*d2;
+    if ((vc <= zero) && (d1 >= zero) && (d3 <= zero) && (d1 - d3 > zero)) {
+        T const v = d1 / (d1 - d3);
+        return result(one - v, v, zero);
+    }
+    T const d5 = -dot(ab, c);
+    T const d6 = -dot(ac, c);
+    if ((d6 >= zero) && (d5 <= d6)) { return result(zero, zero, one); }
+    T const vb = d5*d2 - d1*d6;
+    if ((vb <= zero) && (d2 >= zero) && (d6 <= zero) && (d2 - d6 > zero)) {
+        T const w = d2 / (d2 - d6);
+        return result(one - w, zero, w);
+    }
+    T const va = d3*d6 - d5*d4;
+    if ((va <= zero) && ((d4 - d3) >= zero) && ((d5 - d6) >= zero) && ((d4 - d3) + (d5 - d6) > zero)) {
+        T const w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return result(zero, one - w, w);
+    }
+    T const denom = va + vb + vc;
+    if (denom <= zero) {
+        // degenerate triangle: the closest point lies on one of the edges
+        Barycentric3<T> const e_ab = closest_on_segment(a, b);
+        Barycentric3<T> const e_ac = closest_on_segment(a, c);
+        Barycentric3<T> const e_bc = closest_on_segment(b, c);
+        if ((e_ab.distance_squared <= e_ac.distance_squared) && (e_ab.distance_squared <= e_bc.distance_squared)) {
+            return e_ab;
+        } else if (e_ac.distance_squared <= e_bc.distance_squared) {
+            return Barycentric3<T>{ { e_ac.l[0], zero, e_ac.l[1] }, e_ac.distance_squared };
+        }
+        return Barycentric3<T>{ { zero, e_bc.l[0], e_bc.l[1] }, e_bc.distance_squared };
+    }
+    T const v = vb / denom;
+    T const w = vc / denom;
+    return result(one - v - w, v, w);
+}
+
+/** Replaces the simplex by the smallest sub-simplex containing the point closest to the origin.
+ * Returns the closest point. If the origin is contained in a tetrahedron, the simplex is left unchanged
+ * and the zero vector is returned.
+ */
+template<typename T>
+inline Vector3<T> reduce_simplex(GjkSimplex<T>& simplex, std::array<T, 4>& lambda)
+{
+    T const zero = traits::Constants<T>::Zero();
+    auto& v = simplex.vertices;
+    lambda = { zero, zero, zero, zero };
+    if (simplex.size == 1) {
+        lambda[0] = traits::Constants<T>::One();
+    } else if (simplex.size == 2) {
+        Barycentric3<T> const r = closest_on_segment(v[0].w, v[1].w);
+        lambda = { r.l[0], r.l[1], zero, zero };
+    } else if (simplex.size == 3) {
+        Barycentric3<T> const r = closest_on_triangle(v[0].w, v[1].w, v[2].w);
+        lambda = { r.l[0], r.l[1], r.l[2], zero };
+    } else if (simplex.size == 4) {
+        // test each face whose plane separates the origin from the opposite vertex
+        constexpr std::size_t faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+        bool is_inside = true;
+        T best_distance = std::numeric_limits<T>::max();
+        for (auto const& f : faces) {
+            Vector3<T> const& a = v[f[0]].w;
+            Vector3<T> const n = cross(v[f[1]].w - a, v[f[2]].w - a);
+            T const sign_origin = -dot(a, n);
+            T const sign_opposite = dot(v[f[3]].w - a, n);
+            if ((sign_origin * sign_opposite < zero) || (sign_opposite == zero)) {
+                is_inside = false;
+                Barycentric3<T> const r = closest_on_triangle(a, v[f[1]].w, v[f[2]].w);
+                if (r.distance_squared < best_distance) {
+                    best_distance = r.distance_squared;
+                    lambda = { zero, zero, zero, zero };
+                    lambda[f[0]] = r.l[0];
+                    lambda[f[1]] = r.l[1];
+                    lambda[f[2]] = r.l[2];
+                }
+            }
+        }
+        if (is_inside) {
+            lambda = { zero, zero, zero, zero };
+            return Vector3<T>(zero, zero, zero);
+        }
+    }
+    // drop vertices that do not contribute to the closest point
+    std::size_t new_size = 0;
+    Vector3<T> closest(zero, zero, zero);
+    for (std::size_t i = 0; i < simplex.size; ++i) {
+        if (lambda[i] > zero) {
+            closest += v[i].w * lambda[i];
+            v[new_size] = v[i];
+            lambda[new_size] = lambda[i];
+            ++new_size;
+        }
+    }
+    if (new_size == 0) {
+        // can only happen for degenerate input; keep the first vertex
+        new_size = 1;
+        lambda[0] = traits::Constants<T>::One();
+        closest = v[0].w;
+    }
+    simplex.size = new_size;
+    return closest;
+}
+
+template<typename T>
+[[nodiscard]] inline Point3<T> combine(Point3<T> const& p0, std::span<Point3<T> const> points, std::span<T const> l)
+{
+    Point3<T> ret = p0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        ret += (points[i] - p0) * l[i];
+    }
+    return ret;
+}
+
+template<typename T>
+inline void witness_points(GjkSimplex<T> const& simplex, std::array<T, 4> const& lambda,
+                           Point3<T>& point_a, Point3<T>& point_b)
+{
+    std::array<Point3<T>, 4> pa;
+    std::array<Point3<T>, 4> pb;
+    for (std::size_t i = 0; i < simplex.size; ++i) {
+        pa[i] = simplex.vertices[i].a;
+        pb[i] = simplex.vertices[i].b;
+    }
+    std::span<T const> const l(lambda.data(), simplex.size);
+    point_a = combine(pa[0], std::span<Point3<T> const>(pa.data(), simplex.size), l);
+    point_b = combine(pb[0], std::span<Point3<T> const>(pb.data(), simplex.size), l);
+}
+
+template<bool IsBooleanQuery_V, typename T, typename ShapeA_T, typename ShapeB_T>
+inline GjkResult<T> gjk(ShapeA_T const& shape_a, ShapeB_T const& shape_b, GjkSimplex<T>& simplex,
+                        ConvexCollisionParameters<T> const& parameters)
+{
+    T const zero = traits::Constants<T>::Zero();
+    // re-evaluate the vertices of a warm-started simplex for the current shapes
+    for (std::size_t i = 0; i < simplex.size; ++i) {
+        simplex.vertices[i] = make_vertex(shape_a, shape_b, simplex.vertices[i].d);
+    }
+    if (simplex.size == 0) {
+        simplex.vertices[0] = make_vertex(shape_a, shape_b, Vector3<T>(traits::Constants<T>::One(), zero, zero));
+        simplex.size = 1;
+    }
+    std::array<T, 4> lambda;
+    Vector3<T> v = reduce_simplex(simplex, lambda);
+
+    GjkResult<T> ret{ false, zero, Point3<T>(), Point3<T>(), 0 };
+    for (; ret.iterations < parameters.max_iterations; ++ret.iterations) {
+        T const v_squared = dot(v, v);
+        T max_w_squared = zero;
+        for (std::size_t i = 0; i < simplex.size; ++i) {
+            max_w_squared = std::max(max_w_squared, dot(simplex.vertices[i].w, simplex.vertices[i].w));
+        }
+        if ((simplex.size == 4) || (v_squared <= std::numeric_limits<T>::epsilon() * max_w_squared)) {
+            ret.intersecting = true;
+            return ret;
+        }
+        MinkowskiVertex3<T> const vertex = make_vertex(shape_a, shape_b, -v);
+        T const v_dot_w = dot(v, vertex.w);
+        if constexpr (IsBooleanQuery_V) {
+            // v is a separating axis
+            if (v_dot_w > zero) { return ret; }
+        }
+        // no significant progress towards the origin: v is the closest point
+        bool is_converged = (v_squared - v_dot_w <= parameters.tolerance * v_squared);
+        for (std::size_t i = 0; i < simplex.size; ++i) {
+            if (vertex.w == simplex.vertices[i].w) { is_converged = true; }
+        }
+        if (is_converged) { break; }
+        simplex.vertices[simplex.size] = vertex;
+        ++simplex.size;
+        v = reduce_simplex(simplex, lambda);
+    }
+    ret.distance = length(v);
+    witness_points(simplex, lambda, ret.point_a, ret.point_b);
+    return ret;
+}
+
+/** Fixed-capacity polytope for EPA.
+ */
+template<typename T>
+struct EpaPolytope {
+    static constexpr std::size_t max_vertices = 128;
+    static constexpr std::size_t max_faces = 2 * max_vertices;
+
+    struct Face {
+        std::array<std::size_t, 3> v;
+        Vector3<T> normal;
+        T distance;
+    };
+    struct Edge {
+        std::size_t from;
+        std::size_t to;
+    };
+
+    std::array<MinkowskiVertex3<T>, max_vertices> vertices;
+    std::array<Face, max_faces> faces;
+    std::array<Edge, max_faces> horizon;
+    std::size_t vertex_count = 0;
+    std::size_t face_count = 0;
+
+    void add_face(std::size_t a, std::size_t b, std::size_t c)
+    {
+        assert(face_count < max_faces);
+        Vector3<T> const& wa = vertices[a].w;
+        Vector3<T> n = cross(vertices[b].w - wa, vertices[c].w - wa);
+        T const len = length(n);
+        if (len > traits::Constants<T>::Zero()) {
+            n = n / len;
+            faces[face_count] = Face{ { a, b, c }, n, dot(n, wa) };
+        } else {
+            // degenerate face; never selected for expansion
+            faces[face_count] = Face{ { a, b, c }, n, std::numeric_limits<T>::max() };
+        }
+        ++face_count;
+    }
+};
+
+/** Extends the simplex of an intersecting GJK query to a tetrahedron.
+ * Returns false if the Minkowski difference is flat.
+ */
+template<typename T, typename ShapeA_T, typename ShapeB_T>
+[[nodiscard]] inline bool complete_tetrahedron(ShapeA_T const& shape_a, ShapeB_T const& shape_b,
+                                               GjkSimplex<T>& simplex)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const one = traits::Constants<T>::One();
+    auto& v = simplex.vertices;
+    T scale = zero;
+    for (std::size_t i = 0; i < simplex.size; ++i) {
+        scale = std::max(scale, dot(v[i].w, v[i].w));
+    }
+    T const threshold = std::numeric_limits<T>::epsilon() * std::max(scale, std::numeric_limits<T>::min());
+    auto const try_add = [&](Vector3<T> const& d, auto const& is_valid) {
+        for (Vector3<T> const& dir : { d, Vector3<T>(-d) }) {
+            MinkowskiVertex3<T> const vertex = make_vertex(shape_a, shape_b, dir);
+            if (is_valid(vertex.w)) {
+                v[simplex.size] = vertex;
+                ++simplex.size;
+                return true;
+            }
+        }
+        return false;
+    };
+    std::array<Vector3<T>, 3> const axes = { Vector3<T>(one, zero, zero), Vector3<T>(zero, one, zero),
+                                             Vector3<T>(zero, zero, one) };
+    if (simplex.size == 1) {
+        auto const is_distinct = [&](Vector3<T> const& w) {
+            Vector3<T> const d = w - v[0].w;
+            return dot(d, d) > threshold;
+        };
+        bool found = false;
+        for (auto const& axis : axes) {
+            if (try_add(axis, is_distinct)) { found = true; break; }
+        }
+        if (!found) { return false; }
+    }
+    if (simplex.size == 2) {
+        Vector3<T> const u = v[1].w - v[0].w;
+        auto const is_not_collinear = [&](Vector3<T> const& w) {
+            Vector3<T> const c = cross(u, w - v[0].w);
+            return dot(c, c) > threshold * dot(u, u);
+        };
+        bool found = false;
+        for (auto const& axis : axes) {
+            Vector3<T> const perp = cross(u, axis);
+            if ((dot(perp, perp) > zero) && try_add(perp, is_not_collinear)) { found = true; break; }
+        }
+        if (!found) { return false; }
+    }
+    if (simplex.size == 3) {
+        Vector3<T> const n = cross(v[1].w - v[0].w, v[2].w - v[0].w);
+        auto const is_not_coplanar = [&](Vector3<T> const& w) {
+            T const h = dot(n, w - v[0].w);
+            return h * h > threshold * dot(n, n);
+        };
+        if ((dot(n, n) <= zero) || !try_add(n, is_not_coplanar)) { return false; }
+    }
+    return true;
+}
+
+template<typename T, typename ShapeA_T, typename ShapeB_T>
+inline ConvexContact<T> epa(ShapeA_T const& shape_a, ShapeB_T const& shape_b, GjkSimplex<T> const& gjk_simplex,
+                            ConvexCollisionParameters<T> const& parameters)
+{
+    T const zero = traits::Constants<T>::Zero();
+    using Polytope = EpaPolytope<T>;
+    Polytope p;
+    ConvexContact<T> ret{ true, zero, Vector3<T>(zero, zero, traits::Constants<T>::One()), Point3<T>(), Point3<T>() };
+
+    GjkSimplex<T> simplex = gjk_simplex;
+    if ((simplex.size < 4) && !complete_tetrahedron(shape_a, shape_b, simplex)) {
+        // flat contact; report the touching points with zero depth
+        ret.point_a = simplex.vertices[0].a;
+        ret.point_b = simplex.vertices[0].b;
+        return ret;
+    }
+    for (std::size_t i = 0; i < 4; ++i) {
+        p.vertices[i] = simplex.vertices[i];
+    }
+    p.vertex_count = 4;
+    // orient faces of the initial tetrahedron outwards
+    if (dot(cross(p.vertices[1].w - p.vertices[0].w, p.vertices[2].w - p.vertices[0].w),
+            p.vertices[3].w - p.vertices[0].w) > zero) {
+        std::swap(p.vertices[1], p.vertices[2]);
+    }
+    p.add_face(0, 1, 2);
+    p.add_face(0, 3, 1);
+    p.add_face(0, 2, 3);
+    p.add_face(1, 3, 2);
+
+    std::size_t closest = 0;
+    for (int iteration = 0; iteration < parameters.max_iterations; ++iteration) {
+        closest = 0;
+        for (std::size_t i = 1; i < p.face_count; ++i) {
+            if (p.faces[i].distance < p.faces[closest].distance) { closest = i; }
+        }
+        typename Polytope::Face const face = p.faces[closest];
+        if (face.distance == std::numeric_limits<T>::max()) { break; }
+        MinkowskiVertex3<T> const vertex = make_vertex(shape_a, shape_b, face.normal);
+        T const support_distance = dot(vertex.w, face.normal);
+        if ((support_distance - face.distance <= parameters.tolerance * std::max(support_distance, std::numeric_limits<T>::min())) ||
+            (p.vertex_count == Polytope::max_vertices))
+        {
+            break;
+        }
+
+        // remove all faces visible from the new vertex and collect the horizon edges
+        std::size_t horizon_count = 0;
+        for (std::size_t i = 0; i < p.face_count;) {
+            typename Polytope::Face const& f = p.faces[i];
+            if (dot(f.normal, vertex.w - p.vertices[f.v[0]].w) > zero) {
+                for (std::size_t e = 0; e < 3; ++e) {
+                    std::size_t const from = f.v[e];
+                    std::size_t const to = f.v[(e + 1) % 3];
+                    // an edge shared by two visible faces is not on the horizon
+                    auto const it = std::find_if(p.horizon.begin(), p.horizon.begin() + horizon_count,
+                        [from, to](typename Polytope::Edge const& edge) { return (edge.from == to) && (edge.to == from); });
+                    if (it != p.horizon.begin() + horizon_count) {
+                        *it = p.horizon[horizon_count - 1];
+                        --horizon_count;
+                    } else {
+                        p.horizon[horizon_count] = typename Polytope::Edge{ from, to };
+                        ++horizon_count;
+                    }
+                }
+                p.faces[i] = p.faces[p.face_count - 1];
+                --p.face_count;
+            } else {
+                ++i;
+            }
+        }
+        if (p.face_count + horizon_count > Polytope::max_faces) { break; }
+        std::size_t const new_index = p.vertex_count;
+        p.vertices[new_index] = vertex;
+        ++p.vertex_count;
+        for (std::size_t e = 0; e < horizon_count; ++e) {
+            p.add_face(p.horizon[e].from, p.horizon[e].to, new_index);
+        }
+        if (p.face_count == 0) { break; }
+    }
+    if (p.face_count == 0) { return ret; }
+    closest = 0;
+    for (std::size_t i = 1; i < p.face_count; ++i) {
+        if (p.faces[i].distance < p.faces[closest].distance) { closest = i; }
+    }
+    typename Polytope::Face const& face = p.faces[closest];
+    if (face.distance == std::numeric_limits<T>::max()) { return ret; }
+
+    // the contact points are the barycentric combination of the support points at the origin's projection
+    Barycentric3<T> const bary = closest_on_triangle(p.vertices[face.v[0]].w, p.vertices[face.v[1]].w,
+                                                     p.vertices[face.v[2]].w);
+    std::array<Point3<T>, 3> const pa = { p.vertices[face.v[0]].a, p.vertices[face.v[1]].a, p.vertices[face.v[2]].a };
+    std::array<Point3<T>, 3> const pb = { p.vertices[face.v[0]].b, p.vertices[face.v[1]].b, p.vertices[face.v[2]].b };
+    ret.point_a = combine(pa[0], std::span<Point3<T> const>(pa), std::span<T const>(bary.l));
+    ret.point_b = combine(pb[0], std::span<Point3<T> const>(pb), std::span<T const>(bary.l));
+    ret.normal = face.normal;
+    ret.distance = -face.distance;
+    return ret;
+}
+}
+
+/** Computes the distance between two convex shapes with the GJK algorithm.
+ * The simplex is used for warm-starting and holds the final simplex on return.
+ * See van den Bergen - Collision Detection in Interactive 3D Environments.
+ */
+template<std::floating_point T, SupportMappedShape3<T> ShapeA_T, SupportMappedShape3<T> ShapeB_T>
+inline GjkResult<T> gjk_distance(ShapeA_T const& a, ShapeB_T const& b, GjkSimplex<T>& simplex,
+                                 ConvexCollisionParameters<T> const& parameters = ConvexCollisionParameters<T>{})
+{
+    return convex_collision_detail::gjk<false>(a, b, simplex, parameters);
+}
+
+/** Checks whether two convex shapes intersect with the GJK algorithm.
+ * This is faster than gjk_distance(), as the search stops as soon as a separating axis is found.
+ */
+template<std::floating_point T, SupportMappedShape3<T> ShapeA_T, SupportMappedShape3<T> ShapeB_T>
+[[nodiscard]] inline bool gjk_intersects(ShapeA_T const& a, ShapeB_T const& b, GjkSimplex<T>& simplex,
+                                         ConvexCollisionParameters<T> const& parameters = ConvexCollisionParameters<T>{})
+{
+    return convex_collision_detail::gjk<true>(a, b, simplex, parameters).intersecting;
+}
+
+/** Computes contact information for two convex shapes.
+ * Runs GJK to determine the distance of separated shapes, and the expanding polytope algorithm (EPA)
+ * for the penetration depth and contact normal of intersecting shapes.
+ * The simplex is used for warm-starting GJK and holds the final GJK simplex on return.
+ * No dynamic memory is allocated. The EPA polytope is held in fixed-capacity storage on the stack;
+ * if its capacity is exhausted, the best result found so far is returned.
+ */
+template<std::floating_point T, SupportMappedShape3<T> ShapeA_T, SupportMappedShape3<T> ShapeB_T>
+[[nodiscard]] inline ConvexContact<T> collide(ShapeA_T const& a, ShapeB_T const& b, GjkSimplex<T>& simplex,
+                                              ConvexCollisionParameters<T> const& parameters = ConvexCollisionParameters<T>{})
+{
+    GjkResult<T> const r = gjk_distance(a, b, simplex, parameters);
+    if (r.intersecting) {
+        return convex_collision_detail::epa(a, b, simplex, parameters);
+    }
+    T const zero = traits::Constants<T>::Zero();
+    Vector3<T> const d = r.point_b - r.point_a;
+    Vector3<T> const normal = (r.distance > zero) ? (d / r.distance) : Vector3<T>(zero, zero, traits::Constants<T>::One());
+    return ConvexContact<T>{ false, r.distance, normal, r.point_a, r.point_b };
+}
+}
+
+#endif
@@ -0,0 +1,409 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYN_MATRIX_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYN_MATRIX_HPP
+
+/** @file
+ *
+ * @brief Matrix with dimensions determined at runtime.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/DynVector.hpp>
+#include <gbMath/Matrix.hpp>
+#include <gbMath/MatrixPolicies.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Matrix with dimensions determined at runtime, stored in row-major order.
+ * Storage is obtained from an allocator of type Allocator_T. Use the aliases in the pmr namespace together with
+ * a std::pmr::monotonic_buffer_resource to place temporaries of a frame in an arena that is released at once.
+ * Results of arithmetic operations use the allocator of the left-hand operand.
+ * Binary operations require the dimensions of their operands to be compatible.
+ * Products and LU decomposition share their kernels with the fixed-size Matrix.
+ */
+template<typename T, typename Allocator_T = std::allocator<T>>
+class DynMatrix {
+public:
+    using ValueType = T;
+    using AllocatorType = Allocator_T;
+    using VectorType = DynVector<T, Allocator_T>;
+private:
+    std::vector<T, Allocator_T> m_m;
+    std::size_t m_rows;
+    std::size_t m_columns;
+public:
+    constexpr explicit DynMatrix(Allocator_T const& alloc = Allocator_T())
+        :m_m(alloc), m_rows(0), m_columns(0)
+    {}
+
+    /** Constructs a rows x columns matrix with all elements initialized to 0.
+     */
+    constexpr DynMatrix(std::size_t rows, std::size_t columns, Allocator_T const& alloc = Allocator_T())
+        :m_m(rows * columns, traits::Constants<T>::Zero(), alloc), m_rows(rows), m_columns(columns)
+    {}
+
+    constexpr DynMatrix(std::size_t rows, std::size_t columns, T const* arr,
+                        MatrixPolicies::InputOrder_RowMajor, Allocator_T const& alloc = Allocator_T())
+        :m_m(arr, arr + rows * columns, alloc), m_rows(rows), m_columns(columns)
+    {}
+
+    constexpr DynMatrix(std::size_t rows, std::size_t columns, T const* arr,
+                        MatrixPolicies::InputOrder_ColumnMajor, Allocator_T const& alloc = Allocator_T())
+        :DynMatrix(rows, columns, alloc)
+    {
+        for (std::size_t j = 0; j < columns; ++j) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                (*this)(i, j) = arr[j * rows + i];
+            }
+        }
+    }
+
+    template<std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+    constexpr explicit DynMatrix(Matrix<T, M, N, Order_V> const& mat, Allocator_T const& alloc = Allocator_T())
+        :DynMatrix(M, N, alloc)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) = mat(i, j);
+            }
+        }
+    }
+
+    constexpr DynMatrix(DynMatrix const&) = default;
+    constexpr DynMatrix(DynMatrix&&) = default;
+    constexpr DynMatrix& operator=(DynMatrix const&) = default;
+    constexpr DynMatrix& operator=(DynMatrix&&) = default;
+
+    constexpr DynMatrix(DynMatrix const& rhs, Allocator_T const& alloc)
+        :m_m(rhs.m_m, alloc), m_rows(rhs.m_rows), m_columns(rhs.m_columns)
+    {}
+
+    [[nodiscard]] constexpr Allocator_T get_allocator() const
+    {
+        return m_m.get_allocator();
+    }
+
+    [[nodiscard]] constexpr std::size_t rows() const
+    {
+        return m_rows;
+    }
+
+    [[nodiscard]] constexpr std::size_t columns() const
+    {
+        return m_columns;
+    }
+
+    [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> dimension() const
+    {
+        return std::make_pair(m_rows, m_columns);
+    }
+
+    [[nodiscard]] constexpr bool is_square() const
+    {
+        return m_rows == m_columns;
+    }
+
+    [[nodiscard]] constexpr T* data()
+    {
+        return m_m.data();
+    }
+
+    [[nodiscard]] constexpr T const* data() const
+    {
+        return m_m.data();
+    }
+
+    [[nodiscard]] constexpr std::span<T> elements()
+    {
+        return m_m;
+    }
+
+    [[nodiscard]] constexpr std::span<T const> elements() const
+    {
+        return m_m;
+    }
+
+    [[nodiscard]] constexpr T& operator[](std::size_t idx)
+    {
+        return m_m[idx];
+    }
+
+    [[nodiscard]] constexpr T const& operator[](std::size_t idx) const
+    {
+        return m_m[idx];
+    }
+
+    [[nodiscard]] constexpr T& operator()(std::size_t r, std::size_t c)
+    {
+        return m_m[r * m_columns + c];
+    }
+
+    [[nodiscard]] constexpr T const& operator()(std::size_t r, std::size_t c) const
+    {
+        return m_m[r * m_columns + c];
+    }
+
+    [[nodiscard]] constexpr VectorType row(std::size_t idx) const
+    {
+        VectorType ret(m_columns, get_allocator());
+        for (std::size_t j = 0; j < m_columns; ++j) {
+            ret[j] = (*this)(idx, j);
+        }
+        return ret;
+    }
+
+    [[nodiscard]] constexpr VectorType column(std::size_t idx) const
+    {
+        VectorType ret(m_rows, get_allocator());
+        for (std::size_t j = 0; j < m_rows; ++j) {
+            ret[j] = (*this)(j, idx);
+        }
+        return ret;
+    }
+
+    constexpr void set_row(std::size_t idx, VectorType const& r)
+    {
+        assert(r.dimension() == m_columns);
+        for (std::size_t j = 0; j < m_columns; ++j) {
+            (*this)(idx, j) = r[j];
+        }
+    }
+
+    constexpr void set_column(std::size_t idx, VectorType const& c)
+    {
+        assert(c.dimension() == m_rows);
+        for (std::size_t j = 0; j < m_rows; ++j) {
+            (*this)(j, idx) = c[j];
+        }
+    }
+
+    constexpr void swap_rows(std::size_t r1, std::size_t r2)
+    {
+        if (r1 == r2) { return; }
+        std::swap_ranges(begin(m_m) + r1 * m_columns, begin(m_m) + (r1 + 1) * m_columns,
+                         begin(m_m) + r2 * m_columns);
+    }
+
+    constexpr void swap_columns(std::size_t c1, std::size_t c2)
+    {
+        using std::swap;
+        if (c1 == c2) { return; }
+        for (std::size_t i = 0; i < m_rows; ++i) {
+            swap((*this)(i, c1), (*this)(i, c2));
+        }
+    }
+
+    constexpr DynMatrix& operator+=(DynMatrix const& rhs)
+    {
+        assert(dimension() == rhs.dimension());
+        std::transform(begin(m_m), end(m_m), begin(rhs.m_m), begin(m_m), std::plus<T>{});
+        return *this;
+    }
+
+    constexpr DynMatrix& operator-=(DynMatrix const& rhs)
+    {
+        assert(dimension() == rhs.dimension());
+        std::transform(begin(m_m), end(m_m), begin(rhs.m_m), begin(m_m), std::minus<T>{});
+        return *this;
+    }
+
+    constexpr DynMatrix& operator*=(T f)
+    {
+        std::transform(begin(m_m), end(m_m), begin(m_m), [f](T n) { return n * f; });
+        return *this;
+    }
+
+    constexpr DynMatrix& operator/=(T f)
+    {
+        std::transform(begin(m_m), end(m_m), begin(m_m), [f](T n) { return n / f; });
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(DynMatrix const& lhs, DynMatrix const& rhs)
+    {
+        return (lhs.dimension() == rhs.dimension()) && (lhs.m_m == rhs.m_m);
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator+(DynMatrix const& lhs, DynMatrix const& rhs)
+    {
+        DynMatrix ret(lhs, lhs.get_allocator());
+        ret += rhs;
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator-(DynMatrix const& lhs, DynMatrix const& rhs)
+    {
+        DynMatrix ret(lhs, lhs.get_allocator());
+        ret -= rhs;
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator*(DynMatrix const& lhs, T f)
+    {
+        DynMatrix ret(lhs, lhs.get_allocator());
+        ret *= f;
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator*(T f, DynMatrix const& rhs)
+    {
+        DynMatrix ret(rhs.m_rows, rhs.m_columns, rhs.get_allocator());
+        std::transform(begin(rhs.m_m), end(rhs.m_m), begin(ret.m_m), [f](T n) { return f * n; });
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator/(DynMatrix const& lhs, T f)
+    {
+        DynMatrix ret(lhs, lhs.get_allocator());
+        ret /= f;
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynMatrix operator*(DynMatrix const& lhs, DynMatrix const& rhs)
+    {
+        assert(lhs.m_columns == rhs.m_rows);
+        DynMatrix ret(lhs.m_rows, rhs.m_columns, lhs.get_allocator());
+        matrix_detail::multiply<T>(lhs, rhs, ret, lhs.m_rows, lhs.m_columns, rhs.m_columns);
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr VectorType operator*(DynMatrix const& m, VectorType const& v)
+    {
+        assert(m.m_columns == v.dimension());
+        VectorType ret(m.m_rows, m.get_allocator());
+        matrix_detail::multiply_vector<T>(m, v, ret, m.m_rows, m.m_columns);
+        return ret;
+    }
+};
+
+template<typename T, typename Allocator_T>
+[[nodiscard]] constexpr inline DynMatrix<T, Allocator_T> transpose(DynMatrix<T, Allocator_T> const& m)
+{
+    DynMatrix<T, Allocator_T> ret(m.columns(), m.rows(), m.get_allocator());
+    for (std::size_t i = 0; i < m.rows(); ++i) {
+        for (std::size_t j = 0; j < m.columns(); ++j) {
+            ret(j, i) = m(i, j);
+        }
+    }
+    return ret;
+}
+
+template<typename T, typename Allocator_T = std::allocator<T>>
+[[nodiscard]] constexpr inline DynMatrix<T, Allocator_T> dyn_identity(std::size_t n,
+                                                                     Allocator_T const& alloc = Allocator_T())
+{
+    DynMatrix<T, Allocator_T> ret(n, n, alloc);
+    for (std::size_t i = 0; i < n; ++i) {
+        ret(i, i) = traits::Constants<T>::One();
+    }
+    return ret;
+}
+
+template<typename T, typename Allocator_T>
+[[nodiscard]] constexpr inline T trace(DynMatrix<T, Allocator_T> const& m)
+{
+    assert(m.is_square());
+    T ret = traits::Constants<T>::Zero();
+    for (std::size_t i = 0; i < m.rows(); ++i) {
+        ret += m(i, i);
+    }
+    return ret;
+}
+
+/** LU decomposition of a DynMatrix.
+ * @see LUDecomposition
+ */
+template<typename T, typename Allocator_T = std::allocator<T>>
+struct DynLUDecomposition {
+    using IndexAllocator = typename std::allocator_traits<Allocator_T>::template rebind_alloc<std::size_t>;
+
+    DynMatrix<T, Allocator_T> m;
+    std::vector<std::size_t, IndexAllocator> indices;
+    T det_sign;
+
+    constexpr explicit DynLUDecomposition(std::size_t n, Allocator_T const& alloc = Allocator_T())
+        :m(n, n, alloc), indices(n, 0, IndexAllocator(alloc)), det_sign(traits::Constants<T>::Zero())
+    {}
+
+    [[nodiscard]] constexpr explicit operator bool() const {
+        return det_sign != traits::Constants<T>::Zero();
+    }
+
+    [[nodiscard]] constexpr bool operator!() const {
+        return !static_cast<bool>(*this);
+    }
+
+    [[nodiscard]] constexpr T getDeterminant() const {
+        T ret = traits::Constants<T>::One();
+        for (std::size_t i = 0; i < m.rows(); ++i) {
+            ret *= m(i, i);
+        }
+        return det_sign * ret;
+    }
+
+    /** @pre The decomposed matrix is not singular.
+     */
+    [[nodiscard]] constexpr DynVector<T, Allocator_T> solveFor(DynVector<T, Allocator_T> const& r) const {
+        assert(r.dimension() == m.rows());
+        DynVector<T, Allocator_T> ret(m.rows(), r.get_allocator());
+        matrix_detail::lu_solve<T>(m, indices, r, ret, m.rows());
+        return ret;
+    }
+
+    /** @pre The decomposed matrix is not singular.
+     */
+    [[nodiscard]] constexpr DynMatrix<T, Allocator_T> getInverse() const {
+        std::size_t const n = m.rows();
+        DynMatrix<T, Allocator_T> ret(n, n, m.get_allocator());
+        DynVector<T, Allocator_T> v(n, m.get_allocator());
+        DynVector<T, Allocator_T> x(n, m.get_allocator());
+        for (std::size_t k = 0; k < n; ++k) {
+            std::fill(v.elements().begin(), v.elements().end(), traits::Constants<T>::Zero());
+            v[k] = traits::Constants<T>::One();
+            matrix_detail::lu_solve<T>(m, indices, v, x, n);
+            ret.set_column(k, x);
+        }
+        return ret;
+    }
+};
+
+/** Computes the LU decomposition of a square DynMatrix.
+ * All storage for the decomposition is obtained from the allocator of m.
+ * If m is singular, the returned decomposition evaluates to false.
+ */
+template<typename T, typename Allocator_T>
+[[nodiscard]] constexpr inline DynLUDecomposition<T, Allocator_T> lu_decompose(DynMatrix<T, Allocator_T> const& m)
+{
+    assert(m.is_square());
+    std::size_t const n = m.rows();
+    DynLUDecomposition<T, Allocator_T> ret(n, m.get_allocator());
+    if (n == 0) { return ret; }
+    std::copy(m.elements().begin(), m.elements().end(), ret.m.elements().begin());
+    DynVector<T, Allocator_T> row_normalizer(n, m.get_allocator());
+    ret.det_sign = matrix_detail::lu_decompose_in_place<T>(ret.m, ret.indices, row_normalizer, n);
+    return ret;
+}
+
+namespace pmr
+{
+template<typename T>
+using DynMatrix = ::GHULBUS_MATH_NAMESPACE::DynMatrix<T, std::pmr::polymorphic_allocator<T>>;
+
+template<typename T>
+using DynLUDecomposition = ::GHULBUS_MATH_NAMESPACE::DynLUDecomposition<T, std::pmr::polymorphic_allocator<T>>;
+}
+}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYN_VECTOR_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYN_VECTOR_HPP
+
+/** @file
+ *
+ * @brief Vector with dimension determined at runtime.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Vector with dimension determined at runtime.
+ * Storage is obtained from an allocator of type Allocator_T. Use the aliases in the pmr namespace together with
+ * a std::pmr::monotonic_buffer_resource to place temporaries of a frame in an arena that is released at once.
+ * Results of arithmetic operations use the allocator of the left-hand operand.
+ * Binary operations require both operands to have the same dimension.
+ */
+template<typename T, typename Allocator_T = std::allocator<T>>
+class DynVector {
+public:
+    using ValueType = T;
+    using AllocatorType = Allocator_T;
+private:
+    std::vector<T, Allocator_T> m_v;
+public:
+    constexpr explicit DynVector(Allocator_T const& alloc = Allocator_T())
+        :m_v(alloc)
+    {}
+
+    /** Constructs a vector of dimension n with all elements initialized to 0.
+     */
+    constexpr explicit DynVector(std::size_t n, Allocator_T const& alloc = Allocator_T())
+        :m_v(n, traits::Constants<T>::Zero(), alloc)
+    {}
+
+    constexpr DynVector(std::initializer_list<T> values, Allocator_T const& alloc = Allocator_T())
+        :m_v(values, alloc)
+    {}
+
+    template<std::size_t N>
+    constexpr explicit DynVector(Vector<T, N> const& v, Allocator_T const& alloc = Allocator_T())
+        :m_v(begin(v.v), end(v.v), alloc)
+    {}
+
+    constexpr DynVector(DynVector const&) = default;
+    constexpr DynVector(DynVector&&) = default;
+    constexpr DynVector& operator=(DynVector const&) = default;
+    constexpr DynVector& operator=(DynVector&&) = default;
+
+    constexpr DynVector(DynVector const& rhs, Allocator_T const& alloc)
+        :m_v(rhs.m_v, alloc)
+    {}
+
+    [[nodiscard]] constexpr Allocator_T get_allocator() const
+    {
+        return m_v.get_allocator();
+    }
+
+    [[nodiscard]] constexpr std::size_t dimension() const
+    {
+        return m_v.size();
+    }
+
+    [[nodiscard]] constexpr T* data()
+    {
+        return m_v.data();
+    }
+
+    [[nodiscard]] constexpr T const* data() const
+    {
+        return m_v.data();
+    }
+
+    [[nodiscard]] constexpr std::span<T> elements()
+    {
+        return m_v;
+    }
+
+    [[nodiscard]] constexpr std::span<T const> elements() const
+    {
+        return m_v;
+    }
+
+    [[nodiscard]] constexpr T& operator[](std::size_t idx)
+    {
+        return m_v[idx];
+    }
+
+    [[nodiscard]] constexpr T const& operator[](std::size_t idx) const
+    {
+        return m_v[idx];
+    }
+
+    constexpr DynVector& operator+=(DynVector const& rhs)
+    {
+        assert(dimension() == rhs.dimension());
+        std::transform(begin(m_v), end(m_v), begin(rhs.m_v), begin(m_v), std::plus<T>{});
+        return *this;
+    }
+
+    constexpr DynVector& operator-=(DynVector const& rhs)
+    {
+        assert(dimension() == rhs.dimension());
+        std::transform(begin(m_v), end(m_v), begin(rhs.m_v), begin(m_v), std::minus<T>{});
+        return *this;
+    }
+
+    constexpr DynVector& operator*=(T s)
+    {
+        std::transform(begin(m_v), end(m_v), begin(m_v), [s](T n) { return n * s; });
+        return *this;
+    }
+
+    constexpr DynVector& operator/=(T s)
+    {
+        std::transform(begin(m_v), end(m_v), begin(m_v), [s](T n) { return n / s; });
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(DynVector const& lhs, DynVector const& rhs)
+    {
+        return lhs.m_v == rhs.m_v;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator-(DynVector const& lhs)
+    {
+        DynVector ret(lhs.dimension(), lhs.get_allocator());
+        std::transform(begin(lhs.m_v), end(lhs.m_v), begin(ret.m_v), [](T const& n) { return -n; });
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator+(DynVector const& lhs, DynVector const& rhs)
+    {
+        assert(lhs.dimension() == rhs.dimension());
+        DynVector ret(lhs.dimension(), lhs.get_allocator());
+        std::transform(begin(lhs.m_v), end(lhs.m_v), begin(rhs.m_v), begin(ret.m_v), std::plus<T>{});
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator-(DynVector const& lhs, DynVector const& rhs)
+    {
+        assert(lhs.dimension() == rhs.dimension());
+        DynVector ret(lhs.dimension(), lhs.get_allocator());
+        std::transform(begin(lhs.m_v), end(lhs.m_v), begin(rhs.m_v), begin(ret.m_v), std::minus<T>{});
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator*(DynVector const& v, T s)
+    {
+        DynVector ret(v.dimension(), v.get_allocator());
+        std::transform(begin(v.m_v), end(v.m_v), begin(ret.m_v), [s](T n) { return n * s; });
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator*(T s, DynVector const& v)
+    {
+        DynVector ret(v.dimension(), v.get_allocator());
+        std::transform(begin(v.m_v), end(v.m_v), begin(ret.m_v), [s](T n) { return s * n; });
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr DynVector operator/(DynVector const& v, T s)
+    {
+        DynVector ret(v.dimension(), v.get_allocator());
+        std::transform(begin(v.m_v), end(v.m_v), begin(ret.m_v), [s](T n) { return n / s; });
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr T dot(DynVector const& lhs, DynVector const& rhs)
+    {
+        assert(lhs.dimension() == rhs.dimension());
+        return std::inner_product(begin(lhs.m_v), end(lhs.m_v),
+            begin(rhs.m_v), traits::Constants<T>::Zero());
+    }
+};
+
+namespace pmr
+{
+template<typename T>
+using DynVector = ::GHULBUS_MATH_NAMESPACE::DynVector<T, std::pmr::polymorphic_allocator<T>>;
+}
+}
+
+#endif
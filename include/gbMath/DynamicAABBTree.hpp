@@ -0,0 +1,478 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYNAMIC_AABB_TREE_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_DYNAMIC_AABB_TREE_HPP
+
+/** @file
+*
+* @brief Incrementally updated bounding volume hierarchy of axis-aligned bounding boxes.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB2.hpp>
+#include <gbMath/AABB3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector2.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace DynamicAABBTreeTraits
+{
+/** Describes the bounding boxes stored in a BasicDynamicAABBTree.
+ * cost() is the heuristic that insertion minimizes; it is the surface area for 3D boxes and the perimeter
+ * for 2D boxes, both up to a constant factor.
+ */
+template<typename AABB_T>
+struct BoxTraits;
+
+template<typename T>
+struct BoxTraits<AABB3<T>> {
+    using ValueType = T;
+
+    [[nodiscard]] static constexpr AABB3<T> fatten(AABB3<T> const& b, T margin)
+    {
+        Vector3<T> const m(margin, margin, margin);
+        return AABB3<T>(b.min - m, b.max + m);
+    }
+
+    [[nodiscard]] static constexpr T cost(AABB3<T> const& b)
+    {
+        Vector3<T> const d = b.max - b.min;
+        return d.x*d.y + d.y*d.z + d.z*d.x;
+    }
+
+    [[nodiscard]] static constexpr bool contains(AABB3<T> const& outer, AABB3<T> const& inner)
+    {
+        return (outer.min.x <= inner.min.x) && (outer.min.y <= inner.min.y) && (outer.min.z <= inner.min.z) &&
+               (outer.max.x >= inner.max.x) && (outer.max.y >= inner.max.y) && (outer.max.z >= inner.max.z);
+    }
+};
+
+template<typename T>
+struct BoxTraits<AABB2<T>> {
+    using ValueType = T;
+
+    [[nodiscard]] static constexpr AABB2<T> fatten(AABB2<T> const& b, T margin)
+    {
+        Vector2<T> const m(margin, margin);
+        return AABB2<T>(b.min - m, b.max + m);
+    }
+
+    [[nodiscard]] static constexpr T cost(AABB2<T> const& b)
+    {
+        Vector2<T> const d = b.max - b.min;
+        return d.x + d.y;
+    }
+
+    [[nodiscard]] static constexpr bool contains(AABB2<T> const& outer, AABB2<T> const& inner)
+    {
+        return (outer.min.x <= inner.min.x) && (outer.min.y <= inner.min.y) &&
+               (outer.max.x >= inner.max.x) && (outer.max.y >= inner.max.y);
+    }
+};
+}
+
+/** Bounding volume hierarchy that supports inserting, removing and moving boxes without a full rebuild.
+ * Each proxy is stored in a leaf with a fat bounding box, which is the actual box enlarged by a margin.
+ * Moving a proxy only touches the tree if its new box leaves the fat box, so objects that move slowly
+ * are re-inserted only every few frames. Insertion picks the sibling that minimizes the growth of the
+ * bounding boxes along the path, and tree rotations on the way back up keep the tree balanced, so that
+ * insert, remove and move are O(log n).
+ * Nodes are allocated from a pool with a free list; proxy ids are indices into that pool and remain
+ * stable until the proxy is removed.
+ * Queries report proxies whose fat box intersects the query box, so callers that need exact results have
+ * to perform an additional test on their own geometry.
+ */
+template<typename AABB_T, typename UserData_T = std::size_t>
+class BasicDynamicAABBTree {
+public:
+    using BoxType = AABB_T;
+    using ValueType = typename DynamicAABBTreeTraits::BoxTraits<AABB_T>::ValueType;
+    using UserDataType = UserData_T;
+    using ProxyId = std::size_t;
+    static constexpr ProxyId null_proxy = std::numeric_limits<ProxyId>::max();
+private:
+    using Traits = DynamicAABBTreeTraits::BoxTraits<AABB_T>;
+
+    struct Node {
+        AABB_T box;
+        UserData_T data;
+        std::size_t parent;         ///< Parent node for nodes in the tree, next free node for nodes in the free list.
+        std::size_t child1;
+        std::size_t child2;
+        int height;                 ///< 0 for leaves, -1 for nodes in the free list.
+
+        [[nodiscard]] bool is_leaf() const
+        {
+            return child1 == null_proxy;
+        }
+    };
+
+    std::vector<Node> m_nodes;
+    std::size_t m_root;
+    std::size_t m_freeList;
+    std::size_t m_proxyCount;
+    ValueType m_margin;
+public:
+    /** @param[in] margin Amount by which the box of each proxy is enlarged in every direction.
+     */
+    explicit BasicDynamicAABBTree(ValueType margin)
+        :m_root(null_proxy), m_freeList(null_proxy), m_proxyCount(0), m_margin(margin)
+    {}
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_proxyCount;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_proxyCount == 0;
+    }
+
+    [[nodiscard]] ValueType margin() const
+    {
+        return m_margin;
+    }
+
+    /** Height of the tree; 0 for a tree with a single proxy, -1 for an empty tree.
+     */
+    [[nodiscard]] int height() const
+    {
+        return (m_root == null_proxy) ? -1 : m_nodes[m_root].height;
+    }
+
+    void clear()
+    {
+        m_nodes.clear();
+        m_root = null_proxy;
+        m_freeList = null_proxy;
+        m_proxyCount = 0;
+    }
+
+    /** Inserts a new proxy and returns its id.
+     */
+    ProxyId insert(AABB_T const& box, UserData_T data)
+    {
+        std::size_t const leaf = allocate_node();
+        m_nodes[leaf].box = Traits::fatten(box, m_margin);
+        m_nodes[leaf].data = std::move(data);
+        m_nodes[leaf].height = 0;
+        insert_leaf(leaf);
+        ++m_proxyCount;
+        return leaf;
+    }
+
+    void remove(ProxyId id)
+    {
+        assert((id < m_nodes.size()) && m_nodes[id].is_leaf() && (m_nodes[id].height == 0));
+        remove_leaf(id);
+        free_node(id);
+        --m_proxyCount;
+    }
+
+    /** Updates the box of a proxy.
+     * The tree is only modified if box is no longer contained in the fat box of the proxy, or if the fat box
+     * has become much larger than necessary because the object shrunk.
+     * @return True if the proxy was re-inserted into the tree.
+     */
+    bool move(ProxyId id, AABB_T const& box)
+    {
+        assert((id < m_nodes.size()) && m_nodes[id].is_leaf() && (m_nodes[id].height == 0));
+        AABB_T const& fat_box = m_nodes[id].box;
+        if (Traits::contains(fat_box, box) && Traits::contains(Traits::fatten(box, m_margin * 4), fat_box)) {
+            return false;
+        }
+        remove_leaf(id);
+        m_nodes[id].box = Traits::fatten(box, m_margin);
+        insert_leaf(id);
+        return true;
+    }
+
+    [[nodiscard]] AABB_T const& fat_bounds(ProxyId id) const
+    {
+        assert((id < m_nodes.size()) && (m_nodes[id].height == 0));
+        return m_nodes[id].box;
+    }
+
+    [[nodiscard]] UserData_T const& user_data(ProxyId id) const
+    {
+        assert((id < m_nodes.size()) && (m_nodes[id].height == 0));
+        return m_nodes[id].data;
+    }
+
+    [[nodiscard]] UserData_T& user_data(ProxyId id)
+    {
+        assert((id < m_nodes.size()) && (m_nodes[id].height == 0));
+        return m_nodes[id].data;
+    }
+
+    /** Invokes f(ProxyId) for every proxy whose fat box intersects box.
+     * If f returns bool, returning false stops the query.
+     */
+    template<typename F>
+    void query(AABB_T const& box, F&& f) const
+    {
+        with_traversal_stack([this, &box, &f](std::span<std::size_t> stack) { query_impl(box, f, stack); });
+    }
+
+    /** Invokes f(ProxyId, ProxyId) once for every pair of distinct proxies whose fat boxes intersect.
+     * Within each reported pair, the first id is less than the second.
+     */
+    template<typename F>
+    void query_pairs(F&& f) const
+    {
+        with_traversal_stack([this, &f](std::span<std::size_t> stack) {
+                for (std::size_t i = 0; i < m_nodes.size(); ++i) {
+                    if (m_nodes[i].height != 0) { continue; }
+                    auto report = [i, &f](ProxyId other) {
+                        if (other > i) { f(static_cast<ProxyId>(i), other); }
+                    };
+                    query_impl(m_nodes[i].box, report, stack);
+                }
+            });
+    }
+private:
+    /** Capacity of the traversal stack on the call frame.
+     * A depth-first traversal holds at most height() + 1 nodes on its stack. With the tree balanced, this
+     * suffices for well over 10^13 proxies.
+     */
+    static constexpr std::size_t max_stack_size = 64;
+
+    /** Invokes body with a stack that is large enough for a depth-first traversal of the tree.
+     * The stack lives on the call frame, unless the tree is too high for it.
+     */
+    template<typename F>
+    void with_traversal_stack(F&& body) const
+    {
+        std::size_t const required = static_cast<std::size_t>(height() + 1);
+        if (required <= max_stack_size) {
+            std::array<std::size_t, max_stack_size> stack;
+            body(std::span<std::size_t>(stack));
+        } else {
+            std::vector<std::size_t> stack(required);
+            body(std::span<std::size_t>(stack));
+        }
+    }
+
+    template<typename F>
+    void query_impl(AABB_T const& box, F& f, std::span<std::size_t> stack) const
+    {
+        if (m_root == null_proxy) { return; }
+        std::size_t stack_size = 0;
+        stack[stack_size++] = m_root;
+        while (stack_size > 0) {
+            std::size_t const index = stack[--stack_size];
+            Node const& node = m_nodes[index];
+            if (!intersects(node.box, box)) { continue; }
+            if (node.is_leaf()) {
+                if constexpr (std::is_same_v<std::invoke_result_t<F&, ProxyId>, bool>) {
+                    if (!f(static_cast<ProxyId>(index))) { return; }
+                } else {
+                    f(static_cast<ProxyId>(index));
+                }
+            } else {
+                assert(stack_size + 2 <= stack.size());
+                stack[stack_size++] = node.child1;
+                stack[stack_size++] = node.child2;
+            }
+        }
+    }
+
+    std::size_t allocate_node()
+    {
+        std::size_t index;
+        if (m_freeList == null_proxy) {
+            index = m_nodes.size();
+            m_nodes.emplace_back();
+        } else {
+            index = m_freeList;
+            m_freeList = m_nodes[index].parent;
+        }
+        Node& node = m_nodes[index];
+        node.parent = null_proxy;
+        node.child1 = null_proxy;
+        node.child2 = null_proxy;
+        node.height = 0;
+        return index;
+    }
+
+    void free_node(std::size_t index)
+    {
+        m_nodes[index].parent = m_freeList;
+        m_nodes[index].height = -1;
+        m_nodes[index].data = UserData_T{};
+        m_freeList = index;
+    }
+
+    void insert_leaf(std::size_t leaf)
+    {
+        if (m_root == null_proxy) {
+            m_root = leaf;
+            m_nodes[leaf].parent = null_proxy;
+            return;
+        }
+
+        // descend to the sibling that minimizes the cost increase, see Catto - Dynamic Bounding Volume Hierarchies
+        AABB_T const leaf_box = m_nodes[leaf].box;
+        std::size_t index = m_root;
+        while (!m_nodes[index].is_leaf()) {
+            Node const& node = m_nodes[index];
+            ValueType const area = Traits::cost(node.box);
+            ValueType const combined_area = Traits::cost(union_aabb(node.box, leaf_box));
+            // cost of creating a new parent for this node and the new leaf
+            ValueType const cost = combined_area + combined_area;
+            // minimum cost of pushing the leaf further down the tree
+            ValueType const inheritance_cost = (combined_area - area) + (combined_area - area);
+            auto const descend_cost = [this, &leaf_box, inheritance_cost](std::size_t child) {
+                Node const& c = m_nodes[child];
+                ValueType const new_area = Traits::cost(union_aabb(leaf_box, c.box));
+                return (c.is_leaf() ? new_area : (new_area - Traits::cost(c.box))) + inheritance_cost;
+            };
+            ValueType const cost1 = descend_cost(node.child1);
+            ValueType const cost2 = descend_cost(node.child2);
+            if ((cost < cost1) && (cost < cost2)) { break; }
+            index = (cost1 < cost2) ? node.child1 : node.child2;
+        }
+        std::size_t const sibling = index;
+
+        std::size_t const old_parent = m_nodes[sibling].parent;
+        std::size_t const new_parent = allocate_node();
+        m_nodes[new_parent].parent = old_parent;
+        m_nodes[new_parent].box = union_aabb(leaf_box, m_nodes[sibling].box);
+        m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+        m_nodes[new_parent].child1 = sibling;
+        m_nodes[new_parent].child2 = leaf;
+        m_nodes[sibling].parent = new_parent;
+        m_nodes[leaf].parent = new_parent;
+        if (old_parent == null_proxy) {
+            m_root = new_parent;
+        } else if (m_nodes[old_parent].child1 == sibling) {
+            m_nodes[old_parent].child1 = new_parent;
+        } else {
+            m_nodes[old_parent].child2 = new_parent;
+        }
+
+        refit(m_nodes[leaf].parent);
+    }
+
+    void remove_leaf(std::size_t leaf)
+    {
+        if (leaf == m_root) {
+            m_root = null_proxy;
+            return;
+        }
+        std::size_t const parent = m_nodes[leaf].parent;
+        std::size_t const grand_parent = m_nodes[parent].parent;
+        std::size_t const sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+        if (grand_parent == null_proxy) {
+            m_root = sibling;
+            m_nodes[sibling].parent = null_proxy;
+        } else {
+            if (m_nodes[grand_parent].child1 == parent) {
+                m_nodes[grand_parent].child1 = sibling;
+            } else {
+                m_nodes[grand_parent].child2 = sibling;
+            }
+            m_nodes[sibling].parent = grand_parent;
+            refit(grand_parent);
+        }
+        free_node(parent);
+    }
+
+    /** Walks from index to the root, rebalancing and recomputing heights and boxes.
+     */
+    void refit(std::size_t index)
+    {
+        while (index != null_proxy) {
+            index = balance(index);
+            Node& node = m_nodes[index];
+            Node const& c1 = m_nodes[node.child1];
+            Node const& c2 = m_nodes[node.child2];
+            node.height = 1 + std::max(c1.height, c2.height);
+            node.box = union_aabb(c1.box, c2.box);
+            index = node.parent;
+        }
+    }
+
+    /** If the subtrees of a are imbalanced by more than one level, rotates the higher child up.
+     * @return The index of the node that is now at the position of a.
+     */
+    std::size_t balance(std::size_t ia)
+    {
+        Node& a = m_nodes[ia];
+        if (a.is_leaf() || (a.height < 2)) { return ia; }
+        std::size_t const ib = a.child1;
+        std::size_t const ic = a.child2;
+        int const balance_factor = m_nodes[ic].height - m_nodes[ib].height;
+        if (balance_factor > 1) {
+            return rotate_up(ia, ic, ib);
+        } else if (balance_factor < -1) {
+            return rotate_up(ia, ib, ic);
+        }
+        return ia;
+    }
+
+    /** Rotates the higher child ic of ia up into the position of ia.
+     * ia takes the place of the lower of the two children of ic, which in turn becomes a child of ia.
+     */
+    std::size_t rotate_up(std::size_t ia, std::size_t ic, std::size_t ib)
+    {
+        Node& a = m_nodes[ia];
+        Node& c = m_nodes[ic];
+        std::size_t const i_f = c.child1;
+        std::size_t const i_g = c.child2;
+        Node& f = m_nodes[i_f];
+        Node& g = m_nodes[i_g];
+        Node const& b = m_nodes[ib];
+
+        // swap a and c
+        c.child1 = ia;
+        c.parent = a.parent;
+        a.parent = ic;
+        if (c.parent == null_proxy) {
+            m_root = ic;
+        } else if (m_nodes[c.parent].child1 == ia) {
+            m_nodes[c.parent].child1 = ic;
+        } else {
+            m_nodes[c.parent].child2 = ic;
+        }
+
+        // the higher of f and g stays below c, the lower one replaces c below a
+        auto const attach = [&](std::size_t i_keep, Node& keep, std::size_t i_move, Node& moved) {
+            c.child2 = i_keep;
+            if (a.child1 == ic) { a.child1 = i_move; } else { a.child2 = i_move; }
+            moved.parent = ia;
+            a.box = union_aabb(b.box, moved.box);
+            c.box = union_aabb(a.box, keep.box);
+            a.height = 1 + std::max(b.height, moved.height);
+            c.height = 1 + std::max(a.height, keep.height);
+        };
+        if (f.height > g.height) {
+            attach(i_f, f, i_g, g);
+        } else {
+            attach(i_g, g, i_f, f);
+        }
+        return ic;
+    }
+};
+
+template<typename T, typename UserData_T = std::size_t>
+using DynamicAABBTree3 = BasicDynamicAABBTree<AABB3<T>, UserData_T>;
+
+template<typename T, typename UserData_T = std::size_t>
+using DynamicAABBTree2 = BasicDynamicAABBTree<AABB2<T>, UserData_T>;
+}
+
+#endif
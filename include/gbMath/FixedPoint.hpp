@@ -0,0 +1,620 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_FIXED_POINT_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_FIXED_POINT_HPP
+
+/** @file
+ *
+ * @brief Fixed-point number arithmetic.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/NumberTypeTraits.hpp>
+
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace fixed_point_detail
+{
+/** Unsigned 128 bit integer for platforms without a native 128 bit type.
+ * Only supports the operations required for fixed-point multiplication, division, square root and angle
+ * reduction.
+ */
+struct UInt128 {
+    std::uint64_t hi;
+    std::uint64_t lo;
+
+    [[nodiscard]] static constexpr UInt128 multiply(std::uint64_t a, std::uint64_t b)
+    {
+        std::uint64_t const a_lo = a & 0xffffffffu;
+        std::uint64_t const a_hi = a >> 32;
+        std::uint64_t const b_lo = b & 0xffffffffu;
+        std::uint64_t const b_hi = b >> 32;
+        std::uint64_t const lo_lo = a_lo * b_lo;
+        std::uint64_t const hi_lo = a_hi * b_lo;
+        std::uint64_t const lo_hi = a_lo * b_hi;
+        std::uint64_t const hi_hi = a_hi * b_hi;
+        std::uint64_t const cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+        return UInt128{ hi_hi + (hi_lo >> 32) + (cross >> 32), (cross << 32) | (lo_lo & 0xffffffffu) };
+    }
+
+    [[nodiscard]] constexpr UInt128 operator+(std::uint64_t rhs) const
+    {
+        std::uint64_t const sum = lo + rhs;
+        return UInt128{ hi + ((sum < lo) ? 1u : 0u), sum };
+    }
+
+    /** @pre *this >= rhs */
+    [[nodiscard]] constexpr UInt128 operator-(UInt128 const& rhs) const
+    {
+        return UInt128{ hi - rhs.hi - ((lo < rhs.lo) ? 1u : 0u), lo - rhs.lo };
+    }
+
+    [[nodiscard]] constexpr UInt128 operator|(std::uint64_t rhs) const
+    {
+        return UInt128{ hi, lo | rhs };
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(UInt128 const&, UInt128 const&) = default;
+    [[nodiscard]] friend constexpr auto operator<=>(UInt128 const&, UInt128 const&) = default;
+
+    /** @pre 0 < n < 64 */
+    [[nodiscard]] constexpr UInt128 operator>>(int n) const
+    {
+        return UInt128{ hi >> n, (lo >> n) | (hi << (64 - n)) };
+    }
+
+    /** @pre 0 < n < 64 */
+    [[nodiscard]] constexpr UInt128 operator<<(int n) const
+    {
+        return UInt128{ (hi << n) | (lo >> (64 - n)), lo << n };
+    }
+
+    /** Divides by d using restoring long division.
+     * @return False if the quotient does not fit into 64 bits, in which case quotient is not modified.
+     * @pre d != 0
+     */
+    [[nodiscard]] constexpr bool divide(std::uint64_t d, std::uint64_t& quotient) const
+    {
+        if (hi >= d) { return false; }
+        std::uint64_t rem = hi;
+        std::uint64_t q = 0;
+        for (int i = 63; i >= 0; --i) {
+            bool const carry = (rem >> 63) != 0;
+            rem = (rem << 1) | ((lo >> i) & 1u);
+            q <<= 1;
+            if (carry || (rem >= d)) {
+                rem -= d;
+                q |= 1u;
+            }
+        }
+        quotient = q;
+        return true;
+    }
+};
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 NativeUInt128;
+#endif
+
+/** Unsigned arithmetic with twice the width of Rep_T, used for the intermediate results of multiplication and
+ * division. The functions operate on magnitudes and return false if the result does not fit into Rep_T's
+ * unsigned counterpart. WideUnsigned is the unsigned type of twice the width of Rep_T, widen() converts to it.
+ */
+template<typename Rep_T>
+struct WideArithmetic;
+
+template<>
+struct WideArithmetic<std::int32_t> {
+    using WideUnsigned = std::uint64_t;
+
+    [[nodiscard]] static constexpr WideUnsigned widen(std::uint32_t v)
+    {
+        return v;
+    }
+
+    [[nodiscard]] static constexpr bool multiply(std::uint32_t a, std::uint32_t b, int shift, std::uint32_t& ret)
+    {
+        std::uint64_t const r = ((std::uint64_t{ a } * b) + (std::uint64_t{ 1 } << (shift - 1))) >> shift;
+        if (r > std::numeric_limits<std::uint32_t>::max()) { return false; }
+        ret = static_cast<std::uint32_t>(r);
+        return true;
+    }
+
+    [[nodiscard]] static constexpr bool divide(std::uint32_t a, std::uint32_t b, int shift, std::uint32_t& ret)
+    {
+        std::uint64_t const r = ((std::uint64_t{ a } << shift) + (b >> 1)) / b;
+        if (r > std::numeric_limits<std::uint32_t>::max()) { return false; }
+        ret = static_cast<std::uint32_t>(r);
+        return true;
+    }
+};
+
+template<>
+struct WideArithmetic<std::int64_t> {
+#ifdef __SIZEOF_INT128__
+    using WideUnsigned = NativeUInt128;
+
+    [[nodiscard]] static constexpr WideUnsigned widen(std::uint64_t v)
+    {
+        return v;
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t low_bits(WideUnsigned v)
+    {
+        return static_cast<std::uint64_t>(v);
+    }
+
+    [[nodiscard]] static constexpr WideUnsigned wide_product(std::uint64_t a, std::uint64_t b)
+    {
+        return static_cast<NativeUInt128>(a) * b;
+    }
+
+    /** @pre The quotient fits into 64 bits. */
+    [[nodiscard]] static constexpr std::uint64_t narrow_quotient(WideUnsigned a, std::uint64_t d)
+    {
+        return static_cast<std::uint64_t>(a / d);
+    }
+#else
+    using WideUnsigned = UInt128;
+
+    [[nodiscard]] static constexpr WideUnsigned widen(std::uint64_t v)
+    {
+        return UInt128{ 0, v };
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t low_bits(WideUnsigned v)
+    {
+        return v.lo;
+    }
+
+    [[nodiscard]] static constexpr WideUnsigned wide_product(std::uint64_t a, std::uint64_t b)
+    {
+        return UInt128::multiply(a, b);
+    }
+
+    /** @pre The quotient fits into 64 bits. */
+    [[nodiscard]] static constexpr std::uint64_t narrow_quotient(WideUnsigned a, std::uint64_t d)
+    {
+        std::uint64_t q = 0;
+        [[maybe_unused]] bool const fits = a.divide(d, q);
+        return q;
+    }
+#endif
+
+    [[nodiscard]] static constexpr bool multiply(std::uint64_t a, std::uint64_t b, int shift, std::uint64_t& ret)
+    {
+#ifdef __SIZEOF_INT128__
+        NativeUInt128 const r = ((static_cast<NativeUInt128>(a) * b) + (static_cast<NativeUInt128>(1) << (shift - 1)))
+                                >> shift;
+        if (r > std::numeric_limits<std::uint64_t>::max()) { return false; }
+        ret = static_cast<std::uint64_t>(r);
+#else
+        UInt128 const r = (UInt128::multiply(a, b) + (std::uint64_t{ 1 } << (shift - 1))) >> shift;
+        if (r.hi != 0) { return false; }
+        ret = r.lo;
+#endif
+        return true;
+    }
+
+    [[nodiscard]] static constexpr bool divide(std::uint64_t a, std::uint64_t b, int shift, std::uint64_t& ret)
+    {
+#ifdef __SIZEOF_INT128__
+        NativeUInt128 const r = ((static_cast<NativeUInt128>(a) << shift) + (b >> 1)) / b;
+        if (r > std::numeric_limits<std::uint64_t>::max()) { return false; }
+        ret = static_cast<std::uint64_t>(r);
+        return true;
+#else
+        return ((UInt128{ 0, a } << shift) + (b >> 1)).divide(b, ret);
+#endif
+    }
+};
+}
+
+/** Binary fixed-point number with FractionalBits_V fractional bits, stored in the signed integer Rep_T.
+ * All operations are performed in integer arithmetic and give bit-identical results on all platforms.
+ * - Arithmetic saturates to the representable range instead of overflowing.
+ * - Multiplication and division use intermediates of twice the width of Rep_T and round to nearest.
+ * - Division by zero saturates to the largest or lowest value, depending on the sign of the dividend.
+ * Conversion from floating point is deterministic as well, provided the floating point input is.
+ */
+template<typename Rep_T, int FractionalBits_V>
+class FixedPoint {
+    static_assert(std::same_as<Rep_T, std::int32_t> || std::same_as<Rep_T, std::int64_t>,
+                  "FixedPoint requires std::int32_t or std::int64_t as representation type.");
+    static_assert((FractionalBits_V > 0) && (FractionalBits_V < std::numeric_limits<Rep_T>::digits),
+                  "Invalid number of fractional bits.");
+public:
+    using RepType = Rep_T;
+    using UnsignedRepType = std::make_unsigned_t<Rep_T>;
+    static constexpr int fractional_bits = FractionalBits_V;
+private:
+    Rep_T m_raw;
+
+    static constexpr Rep_T max_raw = std::numeric_limits<Rep_T>::max();
+    static constexpr Rep_T min_raw = std::numeric_limits<Rep_T>::min();
+    static constexpr Rep_T one_raw = Rep_T{ 1 } << FractionalBits_V;
+public:
+    constexpr FixedPoint()
+        :m_raw(0)
+    {}
+
+    constexpr FixedPoint(FixedPoint const&) = default;
+    constexpr FixedPoint& operator=(FixedPoint const&) = default;
+
+    /** Converts an integer, saturating if it is outside the representable range.
+     */
+    template<std::integral I>
+    constexpr explicit FixedPoint(I i)
+        :m_raw(0)
+    {
+        constexpr Rep_T max_int = max_raw >> FractionalBits_V;
+        constexpr Rep_T min_int = min_raw >> FractionalBits_V;
+        if (std::cmp_greater(i, max_int)) {
+            m_raw = max_raw;
+        } else if (std::cmp_less(i, min_int)) {
+            m_raw = min_raw;
+        } else {
+            m_raw = static_cast<Rep_T>(i) * one_raw;
+        }
+    }
+
+    /** Converts a floating point value, rounding to nearest and saturating if it is outside the representable
+     * range. NaN converts to 0.
+     */
+    template<std::floating_point F>
+    constexpr explicit FixedPoint(F f)
+        :m_raw(0)
+    {
+        F const scaled = f * static_cast<F>(one_raw);
+        if (scaled >= static_cast<F>(max_raw)) {
+            m_raw = max_raw;
+        } else if (scaled <= static_cast<F>(min_raw)) {
+            m_raw = min_raw;
+        } else if (scaled == scaled) {
+            m_raw = static_cast<Rep_T>((scaled >= F{ 0 }) ? (scaled + F{ 0.5 }) : (scaled - F{ 0.5 }));
+        }
+    }
+
+    [[nodiscard]] static constexpr FixedPoint from_raw(Rep_T raw)
+    {
+        FixedPoint ret;
+        ret.m_raw = raw;
+        return ret;
+    }
+
+    [[nodiscard]] constexpr Rep_T raw() const
+    {
+        return m_raw;
+    }
+
+    template<std::floating_point F>
+    [[nodiscard]] constexpr explicit operator F() const
+    {
+        return static_cast<F>(m_raw) / static_cast<F>(one_raw);
+    }
+
+    /** Converts to integer, rounding toward zero.
+     */
+    template<std::integral I>
+    [[nodiscard]] constexpr explicit operator I() const
+    {
+        return static_cast<I>(m_raw / one_raw);
+    }
+
+    [[nodiscard]] friend constexpr auto operator<=>(FixedPoint const&, FixedPoint const&) = default;
+
+    constexpr FixedPoint& operator+=(FixedPoint const& rhs)
+    {
+        if ((rhs.m_raw > 0) && (m_raw > max_raw - rhs.m_raw)) {
+            m_raw = max_raw;
+        } else if ((rhs.m_raw < 0) && (m_raw < min_raw - rhs.m_raw)) {
+            m_raw = min_raw;
+        } else {
+            m_raw += rhs.m_raw;
+        }
+        return *this;
+    }
+
+    constexpr FixedPoint& operator-=(FixedPoint const& rhs)
+    {
+        if ((rhs.m_raw < 0) && (m_raw > max_raw + rhs.m_raw)) {
+            m_raw = max_raw;
+        } else if ((rhs.m_raw > 0) && (m_raw < min_raw + rhs.m_raw)) {
+            m_raw = min_raw;
+        } else {
+            m_raw -= rhs.m_raw;
+        }
+        return *this;
+    }
+
+    constexpr FixedPoint& operator*=(FixedPoint const& rhs)
+    {
+        bool const negative = (m_raw < 0) != (rhs.m_raw < 0);
+        UnsignedRepType magnitude = 0;
+        bool const fits = fixed_point_detail::WideArithmetic<Rep_T>::multiply(
+            unsigned_abs(m_raw), unsigned_abs(rhs.m_raw), FractionalBits_V, magnitude);
+        m_raw = from_magnitude(negative, fits, magnitude);
+        return *this;
+    }
+
+    constexpr FixedPoint& operator/=(FixedPoint const& rhs)
+    {
+        bool const negative = (m_raw < 0) != (rhs.m_raw < 0);
+        if (rhs.m_raw == 0) {
+            m_raw = (m_raw < 0) ? min_raw : ((m_raw > 0) ? max_raw : 0);
+            return *this;
+        }
+        UnsignedRepType magnitude = 0;
+        bool const fits = fixed_point_detail::WideArithmetic<Rep_T>::divide(
+            unsigned_abs(m_raw), unsigned_abs(rhs.m_raw), FractionalBits_V, magnitude);
+        m_raw = from_magnitude(negative, fits, magnitude);
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr FixedPoint operator+(FixedPoint lhs, FixedPoint const& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    [[nodiscard]] friend constexpr FixedPoint operator-(FixedPoint lhs, FixedPoint const& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+    [[nodiscard]] friend constexpr FixedPoint operator*(FixedPoint lhs, FixedPoint const& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    [[nodiscard]] friend constexpr FixedPoint operator/(FixedPoint lhs, FixedPoint const& rhs)
+    {
+        return lhs /= rhs;
+    }
+
+    [[nodiscard]] friend constexpr FixedPoint operator-(FixedPoint const& v)
+    {
+        return from_raw((v.m_raw == min_raw) ? max_raw : -v.m_raw);
+    }
+
+private:
+    [[nodiscard]] static constexpr UnsignedRepType unsigned_abs(Rep_T v)
+    {
+        return (v < 0) ? (UnsignedRepType{ 0 } - static_cast<UnsignedRepType>(v)) : static_cast<UnsignedRepType>(v);
+    }
+
+    [[nodiscard]] static constexpr Rep_T from_magnitude(bool negative, bool fits, UnsignedRepType magnitude)
+    {
+        constexpr UnsignedRepType max_magnitude = static_cast<UnsignedRepType>(max_raw);
+        if (negative) {
+            return (fits && (magnitude <= max_magnitude + 1u)) ? static_cast<Rep_T>(UnsignedRepType{ 0 } - magnitude) :
+                                                                  min_raw;
+        }
+        return (fits && (magnitude <= max_magnitude)) ? static_cast<Rep_T>(magnitude) : max_raw;
+    }
+};
+
+/** Q16.16 fixed-point number with a range of [-32768, 32768) and a resolution of 2^-16.
+ */
+using Q16_16 = FixedPoint<std::int32_t, 16>;
+/** Q32.32 fixed-point number with a range of [-2^31, 2^31) and a resolution of 2^-32.
+ */
+using Q32_32 = FixedPoint<std::int64_t, 32>;
+
+namespace fixed_point_detail
+{
+/** Pi scaled by 2^60.
+ */
+inline constexpr std::uint64_t pi_q60 = 0x3243F6A8885A308Du;
+
+/** Returns the raw value of pi * 2^(f - shift), rounded to nearest.
+ */
+template<typename Rep_T>
+[[nodiscard]] constexpr Rep_T scaled_pi(int f, int shift)
+{
+    int const s = 60 - f + shift;
+    return static_cast<Rep_T>((pi_q60 + (std::uint64_t{ 1 } << (s - 1))) >> s);
+}
+
+/** Raw values of 1 / n! for n = 0 ... 14, rounded to nearest.
+ */
+template<typename Rep_T, int F>
+inline constexpr std::array<Rep_T, 15> inverse_factorials = []() {
+    std::array<Rep_T, 15> ret;
+    std::uint64_t factorial = 1;
+    for (std::size_t n = 0; n < ret.size(); ++n) {
+        if (n > 1) { factorial *= n; }
+        ret[n] = static_cast<Rep_T>(((std::uint64_t{ 1 } << F) + factorial / 2) / factorial);
+    }
+    return ret;
+}();
+
+/** Evaluates sin(r) (for Odd_V == true) or cos(r) (for Odd_V == false) for |r| <= pi/4 from their Taylor
+ * series up to degree 14, which is accurate to below the resolution of Q32.32.
+ */
+template<bool Odd_V, typename Rep_T, int F>
+[[nodiscard]] constexpr FixedPoint<Rep_T, F> sin_cos_kernel(FixedPoint<Rep_T, F> const& r)
+{
+    using Fixed = FixedPoint<Rep_T, F>;
+    constexpr int first_degree = Odd_V ? 13 : 14;
+    Fixed const r2 = r * r;
+    constexpr std::array<Rep_T, 15> const& c = inverse_factorials<Rep_T, F>;
+    Fixed p = Fixed::from_raw(c[first_degree]);
+    for (int n = first_degree - 2; n >= 0; n -= 2) {
+        p = Fixed::from_raw(c[n]) - r2 * p;
+    }
+    if constexpr (Odd_V) {
+        return r * p;
+    } else {
+        return p;
+    }
+}
+
+/** Reduces x to r = x - k * pi/2 with |r| <= pi/4.
+ * The reduction is carried out in 128 bit arithmetic with pi/2 at 61 fractional bits, so r is accurate to the
+ * resolution of the type for all x.
+ * @return The quadrant k modulo 4.
+ */
+template<typename Rep_T, int F>
+[[nodiscard]] constexpr int reduce_angle(FixedPoint<Rep_T, F> const& x, FixedPoint<Rep_T, F>& r)
+{
+    static_assert(F <= 60, "Angle reduction requires at most 60 fractional bits.");
+    using Unsigned = std::make_unsigned_t<Rep_T>;
+    using Wide = WideArithmetic<std::int64_t>;
+    // pi_q60 is pi/2 with 61 fractional bits; scaled is |x| at the same scale
+    constexpr int s = 61 - F;
+    Rep_T const raw = x.raw();
+    Unsigned const magnitude = (raw < 0) ? (Unsigned{ 0 } - static_cast<Unsigned>(raw)) : static_cast<Unsigned>(raw);
+    Wide::WideUnsigned const scaled = Wide::widen(magnitude) << s;
+    std::uint64_t const k = Wide::narrow_quotient(scaled + (pi_q60 >> 1), pi_q60);
+    Wide::WideUnsigned const multiple = Wide::wide_product(k, pi_q60);
+    bool const below = scaled < multiple;
+    Wide::WideUnsigned const difference = below ? (multiple - scaled) : (scaled - multiple);
+    Rep_T const r_magnitude =
+        static_cast<Rep_T>(Wide::low_bits((difference + (std::uint64_t{ 1 } << (s - 1))) >> s));
+    r = FixedPoint<Rep_T, F>::from_raw(((raw < 0) != below) ? -r_magnitude : r_magnitude);
+    return static_cast<int>(((raw < 0) ? (std::uint64_t{ 0 } - k) : k) & 3u);
+}
+}
+
+/** @name Functions on fixed-point numbers.
+ * These use integer arithmetic only and give bit-identical results on all platforms.
+ */
+///@{
+template<typename Rep_T, int F>
+[[nodiscard]] constexpr inline FixedPoint<Rep_T, F> abs(FixedPoint<Rep_T, F> const& x)
+{
+    return (x.raw() < 0) ? -x : x;
+}
+
+/** Square root, rounded to nearest.
+ * Computed bit by bit from the integer square root of raw * 2^F, so the result is exact up to rounding.
+ * Negative values return 0.
+ */
+template<typename Rep_T, int F>
+[[nodiscard]] constexpr inline FixedPoint<Rep_T, F> sqrt(FixedPoint<Rep_T, F> const& x)
+{
+    using Unsigned = std::make_unsigned_t<Rep_T>;
+    using Wide = fixed_point_detail::WideArithmetic<Rep_T>;
+    if (x.raw() <= 0) { return FixedPoint<Rep_T, F>(); }
+    Unsigned const raw = static_cast<Unsigned>(x.raw());
+    // the operand is raw * 2^F, which may exceed the width of Rep_T; its bits are produced on the fly
+    constexpr int operand_bits = std::numeric_limits<Rep_T>::digits + F;
+    constexpr int pairs = (operand_bits + 1) / 2;
+    auto const operand_bit = [raw](int i) -> Unsigned { return (i >= F) ? ((raw >> (i - F)) & 1u) : 0u; };
+    // the root fits into Unsigned, but the remainder and trial value need up to two more bits
+    Unsigned root = 0;
+    typename Wide::WideUnsigned rem = Wide::widen(0);
+    for (int i = pairs - 1; i >= 0; --i) {
+        rem = (rem << 2) | ((operand_bit(2 * i + 1) << 1) | operand_bit(2 * i));
+        typename Wide::WideUnsigned const trial = (Wide::widen(root) << 2) | 1u;
+        root <<= 1;
+        if (rem >= trial) {
+            rem = rem - trial;
+            root |= 1u;
+        }
+    }
+    if (rem > Wide::widen(root)) { ++root; }
+    return FixedPoint<Rep_T, F>::from_raw(static_cast<Rep_T>(root));
+}
+
+/** Sine of an angle in radians.
+ * The angle is reduced to [-pi/4, pi/4] with a high precision approximation of pi/2, so the absolute error is
+ * within a few units of the resolution of the type, independent of the magnitude of x.
+ */
+template<typename Rep_T, int F>
+[[nodiscard]] constexpr inline FixedPoint<Rep_T, F> sin(FixedPoint<Rep_T, F> const& x)
+{
+    FixedPoint<Rep_T, F> r;
+    int const quadrant = fixed_point_detail::reduce_angle(x, r);
+    switch (quadrant) {
+    case 0: return fixed_point_detail::sin_cos_kernel<true>(r);
+    case 1: return fixed_point_detail::sin_cos_kernel<false>(r);
+    case 2: return -fixed_point_detail::sin_cos_kernel<true>(r);
+    default: return -fixed_point_detail::sin_cos_kernel<false>(r);
+    }
+}
+
+/** Cosine of an angle in radians.
+ * The same accuracy considerations as for sin() apply.
+ */
+template<typename Rep_T, int F>
+[[nodiscard]] constexpr inline FixedPoint<Rep_T, F> cos(FixedPoint<Rep_T, F> const& x)
+{
+    FixedPoint<Rep_T, F> r;
+    int const quadrant = fixed_point_detail::reduce_angle(x, r);
+    switch (quadrant) {
+    case 0: return fixed_point_detail::sin_cos_kernel<false>(r);
+    case 1: return -fixed_point_detail::sin_cos_kernel<true>(r);
+    case 2: return -fixed_point_detail::sin_cos_kernel<false>(r);
+    default: return fixed_point_detail::sin_cos_kernel<true>(r);
+    }
+}
+///@}
+
+namespace traits
+{
+    template<typename Rep_T, int F>
+    struct Constants<FixedPoint<Rep_T, F>>
+    {
+        static inline FixedPoint<Rep_T, F> constexpr Zero()
+        {
+            return FixedPoint<Rep_T, F>::from_raw(0);
+        }
+
+        static inline FixedPoint<Rep_T, F> constexpr One()
+        {
+            return FixedPoint<Rep_T, F>::from_raw(Rep_T{ 1 } << F);
+        }
+    };
+
+    template<typename Rep_T, int F>
+    struct Pi<FixedPoint<Rep_T, F>>
+    {
+        static_assert((F <= 60) && (F <= std::numeric_limits<Rep_T>::digits - 2),
+                      "Pi is not representable with this number of fractional bits.");
+        static constexpr FixedPoint<Rep_T, F> value =
+            FixedPoint<Rep_T, F>::from_raw(fixed_point_detail::scaled_pi<Rep_T>(F, 0));
+    };
+}
+}
+
+namespace std
+{
+template<typename Rep_T, int F>
+class numeric_limits<GHULBUS_MATH_NAMESPACE::FixedPoint<Rep_T, F>> {
+    using Fixed = GHULBUS_MATH_NAMESPACE::FixedPoint<Rep_T, F>;
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = false;
+    static constexpr int radix = 2;
+    static constexpr int digits = std::numeric_limits<Rep_T>::digits;
+    static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+    [[nodiscard]] static constexpr Fixed min() noexcept { return Fixed::from_raw(1); }
+    [[nodiscard]] static constexpr Fixed max() noexcept { return Fixed::from_raw(std::numeric_limits<Rep_T>::max()); }
+    [[nodiscard]] static constexpr Fixed lowest() noexcept
+    {
+        return Fixed::from_raw(std::numeric_limits<Rep_T>::min());
+    }
+    [[nodiscard]] static constexpr Fixed epsilon() noexcept { return Fixed::from_raw(1); }
+    [[nodiscard]] static constexpr Fixed round_error() noexcept { return Fixed::from_raw(Rep_T{ 1 } << (F - 1)); }
+};
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_FORMAT_IO_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_FORMAT_IO_HPP
+
+/** @file
+ *
+ * @brief Common functionality for the formatters of Vector and Matrix types.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace format_detail
+{
+/** Type used for formatting an element of type T. Elements of type char are written as numbers.
+ */
+template<typename T>
+using FormattedElementType = std::conditional_t<std::same_as<T, char>, int, T>;
+
+/** Base class for formatters of types with elements of type T.
+ * The format spec is forwarded to the formatter of T and applied to each element, so {:.3f} formats every
+ * element with three decimals. All output is written directly to the output iterator of the format context.
+ */
+template<typename T, typename Char_T>
+class ElementFormatter {
+private:
+    std::formatter<FormattedElementType<T>, Char_T> m_elementFormatter;
+public:
+    constexpr auto parse(std::basic_format_parse_context<Char_T>& ctx)
+    {
+        return m_elementFormatter.parse(ctx);
+    }
+
+protected:
+    template<typename FormatContext>
+    static void write_literal(std::string_view str, FormatContext& ctx)
+    {
+        auto out = ctx.out();
+        for (char const c : str) {
+            *out++ = static_cast<Char_T>(c);
+        }
+        ctx.advance_to(std::move(out));
+    }
+
+    template<typename FormatContext>
+    void write_element(T const& e, FormatContext& ctx) const
+    {
+        ctx.advance_to(m_elementFormatter.format(static_cast<FormattedElementType<T>>(e), ctx));
+    }
+
+    /** Writes the elements as a bracketed, space separated list: [e0 e1 ...]
+     */
+    template<typename FormatContext>
+    void write_list(std::span<T const> elements, FormatContext& ctx) const
+    {
+        write_literal("[", ctx);
+        for (std::size_t i = 0; i < elements.size(); ++i) {
+            if (i > 0) { write_literal(" ", ctx); }
+            write_element(elements[i], ctx);
+        }
+        write_literal("]", ctx);
+    }
+
+    /** Writes the elements of a row-major matrix as a bracketed list of rows: [ [e00 e01] [e10 e11] ]
+     */
+    template<typename FormatContext>
+    void write_rows(std::span<T const> elements, std::size_t n_columns, FormatContext& ctx) const
+    {
+        write_literal("[", ctx);
+        for (std::size_t i = 0; i < elements.size(); i += n_columns) {
+            write_literal(" ", ctx);
+            write_list(elements.subspan(i, n_columns), ctx);
+        }
+        write_literal(" ]", ctx);
+    }
+};
+
+/** Implementation of operator<< for types with a formatter.
+ * Formats directly into the stream buffer without constructing a temporary string.
+ * The stream's width is applied to the formatted value as a whole, padding with the fill character on the
+ * right for std::left and on the left otherwise. Like all formatted output functions, resets the width to 0.
+ */
+template<typename T>
+inline std::ostream& insert_formatted(std::ostream& os, T const& v)
+{
+    std::ostream::sentry const s(os);
+    if (s) {
+        std::size_t padding = 0;
+        if (os.width() > 0) {
+            std::size_t const width = static_cast<std::size_t>(os.width());
+            std::size_t const size = std::formatted_size("{}", v);
+            padding = (size < width) ? (width - size) : 0;
+        }
+        bool const pad_right = ((os.flags() & std::ios_base::adjustfield) == std::ios_base::left);
+        std::ostreambuf_iterator<char> it(os);
+        if (!pad_right) { it = std::fill_n(it, padding, os.fill()); }
+        it = std::format_to(it, "{}", v);
+        if (pad_right) { it = std::fill_n(it, padding, os.fill()); }
+        if (it.failed()) { os.setstate(std::ios_base::badbit); }
+    }
+    os.width(0);
+    return os;
+}
+}
+
+/** Result of format_to_buffer().
+ */
+struct FormatToBufferResult {
+    std::string_view str;       ///< The part of the buffer that was written to.
+    bool truncated;             ///< True if the formatted output did not fit into the buffer.
+};
+
+/** Formats into a fixed-size buffer, truncating the output if it does not fit.
+ * This performs no allocation, which makes it suitable for high-volume logging into preallocated buffers.
+ */
+template<typename... Args>
+inline FormatToBufferResult format_to_buffer(std::span<char> buffer, std::format_string<Args...> fmt,
+                                             Args&&... args)
+{
+    auto const res = std::format_to_n(buffer.data(), static_cast<std::ptrdiff_t>(buffer.size()), fmt,
+                                      std::forward<Args>(args)...);
+    std::size_t const written = static_cast<std::size_t>(res.out - buffer.data());
+    return FormatToBufferResult{ std::string_view(buffer.data(), written),
+                                 static_cast<std::size_t>(res.size) > buffer.size() };
+}
+}
+#endif
+
+#endif
@@ -4,41 +4,69 @@
 /** @file
 *
 * @brief Convenience header including all headers from the library.
+* MappedArray.hpp is not included, as it pulls in operating system headers; include it explicitly where needed.
 * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
 */
 
 #include <gbMath/AABB2.hpp>
 #include <gbMath/AABB3.hpp>
 #include <gbMath/Basis3.hpp>
+#include <gbMath/BinaryIO.hpp>
 #include <gbMath/Circle2.hpp>
 #include <gbMath/Color4.hpp>
+#include <gbMath/ColorBlend.hpp>
+#include <gbMath/ColorSRGB.hpp>
 #include <gbMath/Common.hpp>
 #include <gbMath/ComponentVector3.hpp>
+#include <gbMath/ConjugateGradient.hpp>
+#include <gbMath/ConvexCollision.hpp>
+#include <gbMath/DynamicAABBTree.hpp>
+#include <gbMath/DynMatrix.hpp>
+#include <gbMath/DynVector.hpp>
+#include <gbMath/FixedPoint.hpp>
+#include <gbMath/Half.hpp>
+#include <gbMath/KdTree3.hpp>
 #include <gbMath/Line2.hpp>
 #include <gbMath/Line3.hpp>
+#include <gbMath/LooseQuadtree.hpp>
 #include <gbMath/Matrix.hpp>
 #include <gbMath/Matrix2.hpp>
 #include <gbMath/Matrix3.hpp>
+#include <gbMath/Matrix3Decomposition.hpp>
 #include <gbMath/Matrix4.hpp>
+#include <gbMath/MatrixBatch.hpp>
 #include <gbMath/MatrixIO.hpp>
 #include <gbMath/MatrixPolicies.hpp>
+#include <gbMath/MatrixView.hpp>
 #include <gbMath/NumberTypeTraits.hpp>
 #include <gbMath/OBB3.hpp>
+#include <gbMath/PackedColor.hpp>
+#include <gbMath/Plane3.hpp>
+#include <gbMath/ProximityBatch.hpp>
+#include <gbMath/QuantizedVector3.hpp>
 #include <gbMath/Rational.hpp>
 #include <gbMath/RationalIO.hpp>
+#include <gbMath/SparseMatrix.hpp>
 #include <gbMath/Sphere3.hpp>
+#include <gbMath/Sphere3Batch.hpp>
+#include <gbMath/SweptCollision.hpp>
 #include <gbMath/Tensor3.hpp>
+#include <gbMath/TextParser.hpp>
 #include <gbMath/Transform2.hpp>
 #include <gbMath/Transform3.hpp>
 #include <gbMath/TransformLine3.hpp>
+#include <gbMath/Triangle3.hpp>
+#include <gbMath/TriangleMesh.hpp>
 #include <gbMath/Vector.hpp>
 #include <gbMath/Vector2.hpp>
 #include <gbMath/Vector2Swizzle.hpp>
 #include <gbMath/Vector3.hpp>
 #include <gbMath/Vector3Swizzle.hpp>
 #include <gbMath/Vector4.hpp>
+#include <gbMath/VectorBatch.hpp>
 #include <gbMath/VectorIO.hpp>
 #include <gbMath/VectorSwizzle.hpp>
 #include <gbMath/VectorTraits.hpp>
+#include <gbMath/VectorView.hpp>
 
 #endif
@@ -0,0 +1,322 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_HALF_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_HALF_HPP
+
+/** @file
+ *
+ * @brief 16 bit floating point number types for compact storage.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Color4.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector3.hpp>
+#include <gbMath/Vector4.hpp>
+
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace half_detail
+{
+/** Converts a float to the bits of the nearest binary16 value, rounding ties to even.
+ * Values too large for binary16 become infinity, NaNs stay NaN.
+ */
+[[nodiscard]] constexpr inline std::uint16_t float_to_half_bits(float f)
+{
+    constexpr std::uint32_t f32_infinity = 255u << 23;
+    constexpr std::uint32_t f16_overflow = (127u + 16u) << 23;
+    constexpr std::uint32_t f16_min_normal = 113u << 23;
+    // adding this value shifts the mantissa of a float below the binary16 normal range into denormal position
+    constexpr std::uint32_t denormal_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    std::uint32_t u = std::bit_cast<std::uint32_t>(f);
+    std::uint32_t const sign = u & 0x80000000u;
+    u ^= sign;
+    std::uint16_t ret;
+    if (u >= f16_overflow) {
+        ret = (u > f32_infinity) ? 0x7e00u : 0x7c00u;
+    } else if (u < f16_min_normal) {
+        float const shifted = std::bit_cast<float>(u) + std::bit_cast<float>(denormal_magic);
+        ret = static_cast<std::uint16_t>(std::bit_cast<std::uint32_t>(shifted) - denormal_magic);
+    } else {
+        std::uint32_t const mantissa_odd = (u >> 13) & 1u;
+        // rebias the exponent and round the mantissa to nearest even
+        u += static_cast<std::uint32_t>(15 - 127) << 23;
+        u += 0xfffu + mantissa_odd;
+        ret = static_cast<std::uint16_t>(u >> 13);
+    }
+    return static_cast<std::uint16_t>(ret | (sign >> 16));
+}
+
+/** Converts the bits of a binary16 value to float. The conversion is exact.
+ */
+[[nodiscard]] constexpr inline float half_bits_to_float(std::uint16_t h)
+{
+    constexpr std::uint32_t shifted_exponent = 0x7c00u << 13;
+    std::uint32_t u = (h & 0x7fffu) << 13;
+    std::uint32_t const exponent = u & shifted_exponent;
+    u += (127u - 15u) << 23;
+    if (exponent == shifted_exponent) {
+        // infinity or NaN
+        u += (128u - 16u) << 23;
+    } else if (exponent == 0) {
+        // zero or denormal: renormalize through a float subtraction
+        u += 1u << 23;
+        u = std::bit_cast<std::uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113u << 23));
+    }
+    return std::bit_cast<float>(u | (static_cast<std::uint32_t>(h & 0x8000u) << 16));
+}
+
+/** Converts a float to the bits of the nearest bfloat16 value, rounding ties to even.
+ * NaNs stay NaN.
+ */
+[[nodiscard]] constexpr inline std::uint16_t float_to_bfloat16_bits(float f)
+{
+    std::uint32_t const u = std::bit_cast<std::uint32_t>(f);
+    if ((u & 0x7fffffffu) > 0x7f800000u) {
+        // quiet the NaN, so it does not turn into infinity when the payload is truncated
+        return static_cast<std::uint16_t>((u >> 16) | 0x40u);
+    }
+    return static_cast<std::uint16_t>((u + 0x7fffu + ((u >> 16) & 1u)) >> 16);
+}
+
+/** Converts the bits of a bfloat16 value to float. The conversion is exact.
+ */
+[[nodiscard]] constexpr inline float bfloat16_bits_to_float(std::uint16_t b)
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(b) << 16);
+}
+
+/** Common implementation of the 16 bit floating point types.
+ * Values are stored as their bit pattern; all arithmetic is performed in float and rounded back to 16 bits.
+ * Construction from float is explicit, as it loses precision. Conversion to float is implicit and exact.
+ */
+template<typename Derived_T, std::uint16_t (*ToBits)(float), float (*FromBits)(std::uint16_t)>
+class Float16Base {
+private:
+    std::uint16_t m_bits;
+public:
+    constexpr Float16Base()
+        :m_bits(0)
+    {}
+
+    constexpr explicit Float16Base(float f)
+        :m_bits(ToBits(f))
+    {}
+
+    [[nodiscard]] static constexpr Derived_T from_bits(std::uint16_t bits)
+    {
+        Derived_T ret;
+        ret.m_bits = bits;
+        return ret;
+    }
+
+    [[nodiscard]] constexpr std::uint16_t bits() const
+    {
+        return m_bits;
+    }
+
+    [[nodiscard]] constexpr operator float() const
+    {
+        return FromBits(m_bits);
+    }
+
+    constexpr Derived_T& operator+=(Derived_T const& rhs)
+    {
+        return derived() = Derived_T(static_cast<float>(*this) + static_cast<float>(rhs));
+    }
+
+    constexpr Derived_T& operator-=(Derived_T const& rhs)
+    {
+        return derived() = Derived_T(static_cast<float>(*this) - static_cast<float>(rhs));
+    }
+
+    constexpr Derived_T& operator*=(Derived_T const& rhs)
+    {
+        return derived() = Derived_T(static_cast<float>(*this) * static_cast<float>(rhs));
+    }
+
+    constexpr Derived_T& operator/=(Derived_T const& rhs)
+    {
+        return derived() = Derived_T(static_cast<float>(*this) / static_cast<float>(rhs));
+    }
+
+    [[nodiscard]] friend constexpr Derived_T operator+(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return Derived_T(static_cast<float>(lhs) + static_cast<float>(rhs));
+    }
+
+    [[nodiscard]] friend constexpr Derived_T operator-(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return Derived_T(static_cast<float>(lhs) - static_cast<float>(rhs));
+    }
+
+    [[nodiscard]] friend constexpr Derived_T operator*(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return Derived_T(static_cast<float>(lhs) * static_cast<float>(rhs));
+    }
+
+    [[nodiscard]] friend constexpr Derived_T operator/(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return Derived_T(static_cast<float>(lhs) / static_cast<float>(rhs));
+    }
+
+    [[nodiscard]] friend constexpr Derived_T operator-(Derived_T const& v)
+    {
+        return from_bits(static_cast<std::uint16_t>(v.m_bits ^ 0x8000u));
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return static_cast<float>(lhs) == static_cast<float>(rhs);
+    }
+
+    [[nodiscard]] friend constexpr std::partial_ordering operator<=>(Derived_T const& lhs, Derived_T const& rhs)
+    {
+        return static_cast<float>(lhs) <=> static_cast<float>(rhs);
+    }
+
+private:
+    constexpr Derived_T& derived()
+    {
+        return static_cast<Derived_T&>(*this);
+    }
+};
+}
+
+/** IEEE 754 binary16 floating point number.
+ * 1 sign bit, 5 exponent bits and 10 mantissa bits; the largest finite value is 65504.
+ */
+class Half : public half_detail::Float16Base<Half, half_detail::float_to_half_bits, half_detail::half_bits_to_float> {
+public:
+    using Float16Base::Float16Base;
+};
+
+/** Brain floating point number.
+ * 1 sign bit, 8 exponent bits and 7 mantissa bits; same range as float at reduced precision.
+ */
+class BFloat16 : public half_detail::Float16Base<BFloat16, half_detail::float_to_bfloat16_bits,
+                                                 half_detail::bfloat16_bits_to_float> {
+public:
+    using Float16Base::Float16Base;
+};
+
+template<typename T>
+struct IsFloat16 : public std::false_type {};
+template<>
+struct IsFloat16<Half> : public std::true_type {};
+template<>
+struct IsFloat16<BFloat16> : public std::true_type {};
+template<typename T>
+inline constexpr bool IsFloat16_v = IsFloat16<T>::value;
+
+namespace traits
+{
+    template<>
+    struct Constants<Half>
+    {
+        static inline Half constexpr Zero()
+        {
+            return Half::from_bits(0x0000);
+        }
+
+        static inline Half constexpr One()
+        {
+            return Half::from_bits(0x3c00);
+        }
+    };
+
+    template<>
+    struct Constants<BFloat16>
+    {
+        static inline BFloat16 constexpr Zero()
+        {
+            return BFloat16::from_bits(0x0000);
+        }
+
+        static inline BFloat16 constexpr One()
+        {
+            return BFloat16::from_bits(0x3f80);
+        }
+    };
+
+    template<>
+    struct Pi<Half>
+    {
+        static constexpr Half value = Half::from_bits(0x4248);
+    };
+
+    template<>
+    struct Pi<BFloat16>
+    {
+        static constexpr BFloat16 value = BFloat16::from_bits(0x4049);
+    };
+}
+
+/** @name Bulk conversion between float and 16 bit floating point types.
+ * Convert each element of a span, rounding to nearest even when converting to a 16 bit type.
+ * Either the source or the destination element type must be Half or BFloat16.
+ * The loop bodies are independent for all elements, which allows the compiler to vectorize them.
+ * The output span must be at least as large as the input span.
+ */
+///@{
+template<typename From_T, typename To_T>
+    requires(IsFloat16_v<From_T> || IsFloat16_v<To_T>)
+inline void convert(std::span<From_T const> in, std::span<To_T> out)
+{
+    assert(out.size() >= in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = static_cast<To_T>(static_cast<float>(in[i]));
+    }
+}
+
+template<typename From_T, typename To_T, typename VectorTag_T>
+    requires(IsFloat16_v<From_T> || IsFloat16_v<To_T>)
+inline void convert(std::span<Vector3Impl<From_T, VectorTag_T> const> in,
+                    std::span<Vector3Impl<To_T, VectorTag_T>> out)
+{
+    assert(out.size() >= in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = Vector3Impl<To_T, VectorTag_T>(static_cast<To_T>(static_cast<float>(in[i].x)),
+                                                static_cast<To_T>(static_cast<float>(in[i].y)),
+                                                static_cast<To_T>(static_cast<float>(in[i].z)));
+    }
+}
+
+template<typename From_T, typename To_T>
+    requires(IsFloat16_v<From_T> || IsFloat16_v<To_T>)
+inline void convert(std::span<Vector4<From_T> const> in, std::span<Vector4<To_T>> out)
+{
+    assert(out.size() >= in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = Vector4<To_T>(static_cast<To_T>(static_cast<float>(in[i].x)),
+                               static_cast<To_T>(static_cast<float>(in[i].y)),
+                               static_cast<To_T>(static_cast<float>(in[i].z)),
+                               static_cast<To_T>(static_cast<float>(in[i].w)));
+    }
+}
+
+template<typename From_T, typename To_T>
+    requires(IsFloat16_v<From_T> || IsFloat16_v<To_T>)
+inline void convert(std::span<Color4<From_T> const> in, std::span<Color4<To_T>> out)
+{
+    assert(out.size() >= in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        out[i] = Color4<To_T>(static_cast<To_T>(static_cast<float>(in[i].r)),
+                              static_cast<To_T>(static_cast<float>(in[i].g)),
+                              static_cast<To_T>(static_cast<float>(in[i].b)),
+                              static_cast<To_T>(static_cast<float>(in[i].a)));
+    }
+}
+///@}
+}
+
+#endif
@@ -0,0 +1,427 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_KD_TREE3_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_KD_TREE3_HPP
+
+/** @file
+*
+* @brief Static k-d tree for nearest neighbour and range queries over 3D points.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Common.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Sphere3.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** A point found by a nearest neighbour query.
+ */
+template<typename T>
+struct KdTree3Neighbor {
+    std::size_t index;          ///< Index of the point in the array that the tree was built from.
+    T distance_squared;         ///< Squared distance from the query point.
+};
+
+namespace kd_tree_detail
+{
+/** Interleaves the lower 21 bits of x, y and z, with x in the lowest bit.
+ */
+[[nodiscard]] constexpr inline std::uint64_t morton_code(std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    auto const spread = [](std::uint64_t v) {
+        v &= 0x1fffffull;
+        v = (v | (v << 32)) & 0x001f00000000ffffull;
+        v = (v | (v << 16)) & 0x001f0000ff0000ffull;
+        v = (v | (v << 8)) & 0x100f00f00f00f00full;
+        v = (v | (v << 4)) & 0x10c30c30c30c30c3ull;
+        v = (v | (v << 2)) & 0x1249249249249249ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1) | (spread(z) << 2);
+}
+}
+
+/** Static k-d tree over a set of points.
+ * The tree is stored in an implicit array layout: it is a complete binary tree in which node i has children
+ * 2i+1 and 2i+2, and the range of points covered by each node follows from halving the point range at each
+ * level, so internal nodes only store their split axis and split value. Each leaf holds a bucket of at most
+ * leaf_size points. The points are stored in tree order, so that the points of each leaf are contiguous.
+ * Query results refer to points by their index in the array that the tree was built from.
+ */
+template<std::floating_point T>
+class KdTree3 {
+public:
+    using ValueType = T;
+    using Neighbor = KdTree3Neighbor<T>;
+    static constexpr std::size_t null_index = std::numeric_limits<std::size_t>::max();
+private:
+    std::vector<Point3<T>> m_points;
+    std::vector<std::size_t> m_indices;
+    std::vector<T> m_splitValues;
+    std::vector<std::uint8_t> m_splitAxes;
+    std::size_t m_leafSize;
+    AABB3<T> m_bounds;
+public:
+    KdTree3()
+        :m_leafSize(1), m_bounds(empty_aabb3<T>())
+    {}
+
+    explicit KdTree3(std::span<Point3<T> const> points, std::size_t leaf_size = 16)
+        :KdTree3(points, leaf_size, SequentialFor{})
+    {}
+
+    /** Builds the tree, distributing the construction of independent subtrees with parallel_for.
+     * The library does not spawn threads itself; parallel_for(count, f) is expected to invoke f(i) for all
+     * i in [0, count), and may do so concurrently, e.g. by handing the calls to a thread pool.
+     */
+    template<typename ParallelFor_T>
+    KdTree3(std::span<Point3<T> const> points, std::size_t leaf_size, ParallelFor_T&& parallel_for)
+        :m_points(points.begin(), points.end()), m_indices(points.size()), m_leafSize(leaf_size),
+         m_bounds(AABB3<T>::from_points(points))
+    {
+        assert(leaf_size > 0);
+        std::iota(begin(m_indices), end(m_indices), std::size_t{ 0 });
+        std::size_t const n = m_points.size();
+        std::size_t const leaf_count = std::bit_ceil(std::max<std::size_t>((n + leaf_size - 1) / leaf_size, 1));
+        m_splitValues.resize(leaf_count - 1);
+        m_splitAxes.resize(leaf_count - 1);
+
+        // split the upper levels sequentially, then hand out the subtrees below as independent tasks
+        int const task_depth = std::min(std::countr_zero(leaf_count), 4);
+        struct Task { std::size_t node; std::size_t begin; std::size_t end; };
+        std::vector<Task> tasks;
+        auto const split_top = [&](auto const& self, std::size_t node, std::size_t b, std::size_t e, int depth) -> void {
+            if (depth == task_depth) {
+                tasks.push_back(Task{ node, b, e });
+                return;
+            }
+            std::size_t const mid = split(node, b, e);
+            self(self, 2*node + 1, b, mid, depth + 1);
+            self(self, 2*node + 2, mid, e, depth + 1);
+        };
+        split_top(split_top, 0, 0, n, 0);
+        parallel_for(tasks.size(), [this, &tasks](std::size_t i) { build(tasks[i].node, tasks[i].begin, tasks[i].end); });
+
+        // the build only permutes the indices; bring the points into tree order afterwards
+        std::vector<Point3<T>> ordered_points;
+        ordered_points.reserve(n);
+        for (std::size_t const i : m_indices) { ordered_points.push_back(m_points[i]); }
+        m_points = std::move(ordered_points);
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_points.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_points.empty();
+    }
+
+    [[nodiscard]] std::size_t leaf_size() const
+    {
+        return m_leafSize;
+    }
+
+    /** Bounding box of all points in the tree.
+     */
+    [[nodiscard]] AABB3<T> const& bounds() const
+    {
+        return m_bounds;
+    }
+
+    /** Finds the result.size() points closest to q.
+     * @param[out] result Receives the neighbors, sorted by ascending distance. If the tree contains fewer
+     *                    points than requested, the remaining entries are set to {null_index, infinity}.
+     * @return The number of neighbors found, which is the smaller of result.size() and size().
+     */
+    std::size_t nearest(Point3<T> const& q, std::span<Neighbor> result) const
+    {
+        std::size_t count = 0;
+        if (!result.empty() && !m_points.empty()) {
+            std::array<T, 3> offsets{};
+            nearest_recurse(0, 0, m_points.size(), q, traits::Constants<T>::Zero(), offsets, result, count);
+            std::sort_heap(result.begin(), result.begin() + count, heap_compare);
+        }
+        for (std::size_t i = count; i < result.size(); ++i) {
+            result[i] = Neighbor{ null_index, std::numeric_limits<T>::infinity() };
+        }
+        return count;
+    }
+
+    /** Finds the point closest to q, or {null_index, infinity} if the tree is empty.
+     */
+    [[nodiscard]] Neighbor nearest(Point3<T> const& q) const
+    {
+        Neighbor ret{ null_index, std::numeric_limits<T>::infinity() };
+        if (!m_points.empty()) {
+            std::array<T, 3> offsets{};
+            nearest_single_recurse(0, 0, m_points.size(), q, traits::Constants<T>::Zero(), offsets, ret);
+        }
+        return ret;
+    }
+
+    /** Invokes f(index, distance_squared) for every point within the sphere, in no particular order.
+     */
+    template<typename F>
+    void query(Sphere3<T> const& s, F&& f) const
+    {
+        if (m_points.empty()) { return; }
+        std::array<T, 3> offsets{};
+        radius_recurse(0, 0, m_points.size(), s.center, s.radius * s.radius, traits::Constants<T>::Zero(),
+                       offsets, f);
+    }
+
+    /** Invokes f(index) for every point inside the box, in no particular order.
+     */
+    template<typename F>
+    void query(AABB3<T> const& box, F&& f) const
+    {
+        if (m_points.empty()) { return; }
+        box_recurse(0, 0, m_points.size(), box, f);
+    }
+
+    /** Finds the k nearest neighbors for each of the query points.
+     * Queries are processed in Morton order of their positions, so that consecutive queries visit mostly
+     * the same nodes and points. Results are still written in the order of the queries.
+     * @param[out] results The k neighbors of queries[i] are written to results[i*k, (i+1)*k), as by nearest().
+     */
+    void nearest(std::span<Point3<T> const> queries, std::size_t k, std::span<Neighbor> results) const
+    {
+        assert(results.size() == queries.size() * k);
+        for (std::size_t const i : morton_order(queries)) {
+            nearest(queries[i], results.subspan(i * k, k));
+        }
+    }
+
+    /** Invokes f(query_index, index, distance_squared) for every point within radius of each of the queries.
+     * Queries are processed in Morton order of their positions.
+     */
+    template<typename F>
+    void query(std::span<Point3<T> const> queries, T radius, F&& f) const
+    {
+        for (std::size_t const i : morton_order(queries)) {
+            query(Sphere3<T>(queries[i], radius), [i, &f](std::size_t index, T d2) { f(i, index, d2); });
+        }
+    }
+private:
+    [[nodiscard]] static bool heap_compare(Neighbor const& lhs, Neighbor const& rhs)
+    {
+        return lhs.distance_squared < rhs.distance_squared;
+    }
+
+    [[nodiscard]] bool is_leaf(std::size_t node) const
+    {
+        return node >= m_splitAxes.size();
+    }
+
+    [[nodiscard]] static std::size_t midpoint(std::size_t b, std::size_t e)
+    {
+        return b + (e - b) / 2;
+    }
+
+    /** Partitions the index range [b, e) at its median along the axis of largest extent.
+     * During the build, m_points is still in input order and only m_indices is permuted.
+     * @return The start of the right half.
+     */
+    std::size_t split(std::size_t node, std::size_t b, std::size_t e)
+    {
+        AABB3<T> range_bounds = empty_aabb3<T>();
+        for (std::size_t i = b; i < e; ++i) { range_bounds = enclose(range_bounds, m_points[m_indices[i]]); }
+        Vector3<T> const extent = (b == e) ? Vector3<T>{} : diagonal(range_bounds);
+        std::uint8_t const axis = (extent.x >= extent.y) ? ((extent.x >= extent.z) ? 0 : 2) :
+                                                           ((extent.y >= extent.z) ? 1 : 2);
+        std::size_t const mid = midpoint(b, e);
+        if (mid < e) {
+            std::nth_element(begin(m_indices) + b, begin(m_indices) + mid, begin(m_indices) + e,
+                [this, axis](std::size_t lhs, std::size_t rhs) { return m_points[lhs][axis] < m_points[rhs][axis]; });
+            m_splitValues[node] = m_points[m_indices[mid]][axis];
+        } else {
+            m_splitValues[node] = traits::Constants<T>::Zero();
+        }
+        m_splitAxes[node] = axis;
+        return mid;
+    }
+
+    void build(std::size_t node, std::size_t b, std::size_t e)
+    {
+        if (is_leaf(node)) { return; }
+        std::size_t const mid = split(node, b, e);
+        build(2*node + 1, b, mid);
+        build(2*node + 2, mid, e);
+    }
+
+    [[nodiscard]] std::vector<std::size_t> morton_order(std::span<Point3<T> const> queries) const
+    {
+        std::size_t const n = queries.size();
+        std::vector<std::uint64_t> keys(n);
+        Vector3<T> const extent = m_points.empty() ? Vector3<T>{} : diagonal(m_bounds);
+        T const grid = static_cast<T>((1u << 21) - 1);
+        auto const quantize = [grid](T v, T min, T ext) -> std::uint32_t {
+            if (!(ext > traits::Constants<T>::Zero())) { return 0; }
+            T const f = std::clamp((v - min) / ext, traits::Constants<T>::Zero(), traits::Constants<T>::One());
+            return static_cast<std::uint32_t>(f * grid);
+        };
+        for (std::size_t i = 0; i < n; ++i) {
+            keys[i] = kd_tree_detail::morton_code(quantize(queries[i].x, m_bounds.min.x, extent.x),
+                                                  quantize(queries[i].y, m_bounds.min.y, extent.y),
+                                                  quantize(queries[i].z, m_bounds.min.z, extent.z));
+        }
+        std::vector<std::size_t> order(n);
+        std::iota(begin(order), end(order), std::size_t{ 0 });
+        std::sort(begin(order), end(order), [&keys](std::size_t lhs, std::size_t rhs) { return keys[lhs] < keys[rhs]; });
+        return order;
+    }
+
+    /** Descends into the child containing q first, then into the other child if the squared distance from q
+     * to its cell is below the current k-th best distance. The distance to a cell is tracked incrementally
+     * through the per-axis offsets from q to the cell (Arya, Mount - Algorithms for fast vector quantization).
+     */
+    void nearest_recurse(std::size_t node, std::size_t b, std::size_t e, Point3<T> const& q, T cell_distance,
+                         std::array<T, 3>& offsets, std::span<Neighbor> heap, std::size_t& count) const
+    {
+        if (is_leaf(node)) {
+            for (std::size_t i = b; i < e; ++i) {
+                Vector3<T> const d = m_points[i] - q;
+                T const d2 = dot(d, d);
+                if (count < heap.size()) {
+                    heap[count++] = Neighbor{ m_indices[i], d2 };
+                    std::push_heap(heap.begin(), heap.begin() + count, heap_compare);
+                } else if (d2 < heap[0].distance_squared) {
+                    std::pop_heap(heap.begin(), heap.begin() + count, heap_compare);
+                    heap[count - 1] = Neighbor{ m_indices[i], d2 };
+                    std::push_heap(heap.begin(), heap.begin() + count, heap_compare);
+                }
+            }
+            return;
+        }
+        std::size_t const axis = m_splitAxes[node];
+        std::size_t const mid = midpoint(b, e);
+        T const diff = q[axis] - m_splitValues[node];
+        bool const left_first = (diff <= traits::Constants<T>::Zero());
+        if (left_first) {
+            nearest_recurse(2*node + 1, b, mid, q, cell_distance, offsets, heap, count);
+        } else {
+            nearest_recurse(2*node + 2, mid, e, q, cell_distance, offsets, heap, count);
+        }
+        T const old_offset = offsets[axis];
+        T const far_distance = cell_distance - old_offset*old_offset + diff*diff;
+        if ((count < heap.size()) || (far_distance < heap[0].distance_squared)) {
+            offsets[axis] = diff;
+            if (left_first) {
+                nearest_recurse(2*node + 2, mid, e, q, far_distance, offsets, heap, count);
+            } else {
+                nearest_recurse(2*node + 1, b, mid, q, far_distance, offsets, heap, count);
+            }
+            offsets[axis] = old_offset;
+        }
+    }
+
+    /** Same traversal as nearest_recurse(), tracking only the best candidate instead of a heap.
+     */
+    void nearest_single_recurse(std::size_t node, std::size_t b, std::size_t e, Point3<T> const& q, T cell_distance,
+                                std::array<T, 3>& offsets, Neighbor& best) const
+    {
+        if (is_leaf(node)) {
+            for (std::size_t i = b; i < e; ++i) {
+                Vector3<T> const d = m_points[i] - q;
+                T const d2 = dot(d, d);
+                if ((best.index == null_index) || (d2 < best.distance_squared)) {
+                    best = Neighbor{ m_indices[i], d2 };
+                }
+            }
+            return;
+        }
+        std::size_t const axis = m_splitAxes[node];
+        std::size_t const mid = midpoint(b, e);
+        T const diff = q[axis] - m_splitValues[node];
+        bool const left_first = (diff <= traits::Constants<T>::Zero());
+        if (left_first) {
+            nearest_single_recurse(2*node + 1, b, mid, q, cell_distance, offsets, best);
+        } else {
+            nearest_single_recurse(2*node + 2, mid, e, q, cell_distance, offsets, best);
+        }
+        T const old_offset = offsets[axis];
+        T const far_distance = cell_distance - old_offset*old_offset + diff*diff;
+        if ((best.index == null_index) || (far_distance < best.distance_squared)) {
+            offsets[axis] = diff;
+            if (left_first) {
+                nearest_single_recurse(2*node + 2, mid, e, q, far_distance, offsets, best);
+            } else {
+                nearest_single_recurse(2*node + 1, b, mid, q, far_distance, offsets, best);
+            }
+            offsets[axis] = old_offset;
+        }
+    }
+
+    template<typename F>
+    void radius_recurse(std::size_t node, std::size_t b, std::size_t e, Point3<T> const& q, T r2, T cell_distance,
+                        std::array<T, 3>& offsets, F& f) const
+    {
+        if (is_leaf(node)) {
+            for (std::size_t i = b; i < e; ++i) {
+                Vector3<T> const d = m_points[i] - q;
+                T const d2 = dot(d, d);
+                if (d2 <= r2) { f(m_indices[i], d2); }
+            }
+            return;
+        }
+        std::size_t const axis = m_splitAxes[node];
+        std::size_t const mid = midpoint(b, e);
+        T const diff = q[axis] - m_splitValues[node];
+        bool const left_first = (diff <= traits::Constants<T>::Zero());
+        if (left_first) {
+            radius_recurse(2*node + 1, b, mid, q, r2, cell_distance, offsets, f);
+        } else {
+            radius_recurse(2*node + 2, mid, e, q, r2, cell_distance, offsets, f);
+        }
+        T const old_offset = offsets[axis];
+        T const far_distance = cell_distance - old_offset*old_offset + diff*diff;
+        if (far_distance <= r2) {
+            offsets[axis] = diff;
+            if (left_first) {
+                radius_recurse(2*node + 2, mid, e, q, r2, far_distance, offsets, f);
+            } else {
+                radius_recurse(2*node + 1, b, mid, q, r2, far_distance, offsets, f);
+            }
+            offsets[axis] = old_offset;
+        }
+    }
+
+    template<typename F>
+    void box_recurse(std::size_t node, std::size_t b, std::size_t e, AABB3<T> const& box, F& f) const
+    {
+        if (is_leaf(node)) {
+            for (std::size_t i = b; i < e; ++i) {
+                if (intersects(box, m_points[i])) { f(m_indices[i]); }
+            }
+            return;
+        }
+        std::size_t const axis = m_splitAxes[node];
+        std::size_t const mid = midpoint(b, e);
+        T const split_value = m_splitValues[node];
+        if (box.min[axis] <= split_value) { box_recurse(2*node + 1, b, mid, box, f); }
+        if (box.max[axis] >= split_value) { box_recurse(2*node + 2, mid, e, box, f); }
+    }
+};
+}
+
+#endif
@@ -10,8 +10,11 @@
 #include <gbMath/config.hpp>
 
 #include <gbMath/Common.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
 #include <gbMath/Vector3.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <concepts>
 
 namespace GHULBUS_MATH_NAMESPACE
@@ -49,6 +52,39 @@ template<std::floating_point T>
     return Line3<T>(l.p, normalized(l.v));
 }
 
+/** A line whose direction vector is known to have unit length.
+ * Queries that depend on the normalized direction, like the ray-sphere intersection tests, have overloads
+ * taking a NormalizedLine3. When testing the same ray against many objects, construct a NormalizedLine3 once
+ * to avoid recomputing the normalized direction for every test.
+ */
+template<std::floating_point T>
+class NormalizedLine3 {
+public:
+    Point3<T> p;
+    Vector3<T> v;
+public:
+    constexpr NormalizedLine3() = default;
+    constexpr explicit NormalizedLine3(DoNotInitialize_Tag)
+        :p(doNotInitialize), v(doNotInitialize)
+    {}
+    constexpr NormalizedLine3(NormalizedLine3 const&) = default;
+    constexpr NormalizedLine3& operator=(NormalizedLine3 const&) = default;
+
+    constexpr explicit NormalizedLine3(Line3<T> const& l)
+        :p(l.p), v(normalized(l.v))
+    {}
+
+    [[nodiscard]] constexpr operator Line3<T>() const
+    {
+        return Line3<T>(p, v);
+    }
+
+    [[nodiscard]] constexpr Point3<T> evaluate_at_parameter(T t) const
+    {
+        return p + v * t;
+    }
+};
+
 template<typename T>
 [[nodiscard]] constexpr inline T distance_squared_unit(Line3<T> const& l, Point3<T> const& p)
 {
@@ -98,5 +134,53 @@ template<>
     return std::sqrt(distance_squared_unit(l, p));
 }
 
+/** Parameters of the closest points of two segments.
+ * The closest points are s1.evaluate_at_parameter(s) and s2.evaluate_at_parameter(t).
+ */
+template<typename T>
+struct Line3SegmentClosestParameters {
+    T s;
+    T t;
+};
+
+/** Computes the closest points of two segments, where each line is interpreted as the segment from p to p + v.
+ * Segments degenerating to a single point are handled. If the closest points are not unique, as for parallel
+ * segments, one of the closest pairs is returned.
+ * The computation uses selects instead of branches, so it can be vectorized when applied to many segments.
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Line3SegmentClosestParameters<T> closest_parameters_segment(Line3<T> const& s1,
+                                                                                           Line3<T> const& s2)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const one = traits::Constants<T>::One();
+    Vector3<T> const r = s1.p - s2.p;
+    T const a = dot(s1.v, s1.v);
+    T const b = dot(s1.v, s2.v);
+    T const c = dot(s1.v, r);
+    T const e = dot(s2.v, s2.v);
+    T const f = dot(s2.v, r);
+    T const denom = a*e - b*b;
+    // closest point on the infinite lines, clamped to the first segment; for parallel segments, start at s1.p
+    T s = (denom != zero) ? std::clamp((b*f - c*e) / denom, zero, one) : zero;
+    // second segment degenerates to a point: project onto first segment
+    s = ((e == zero) && (a != zero)) ? std::clamp(-c / a, zero, one) : s;
+    T const t_unclamped = (e != zero) ? ((b*s + f) / e) : zero;
+    T const t = std::clamp(t_unclamped, zero, one);
+    // if the closest point on the second segment was clamped, recompute the closest point on the first segment
+    s = ((t != t_unclamped) && (a != zero)) ? std::clamp((t*b - c) / a, zero, one) : s;
+    return Line3SegmentClosestParameters<T>{ s, t };
+}
+
+/** Squared distance between two segments, where each line is interpreted as the segment from p to p + v.
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr inline T distance_squared_segment(Line3<T> const& s1, Line3<T> const& s2)
+{
+    auto const [s, t] = closest_parameters_segment(s1, s2);
+    Vector3<T> const d = s1.evaluate_at_parameter(s) - s2.evaluate_at_parameter(t);
+    return dot(d, d);
+}
+
 }
 #endif
@@ -0,0 +1,504 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_LOOSE_QUADTREE_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_LOOSE_QUADTREE_HPP
+
+/** @file
+*
+* @brief Loose quadtree for spatial queries over 2D bounding boxes.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB2.hpp>
+#include <gbMath/Circle2.hpp>
+#include <gbMath/Line2.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace loose_quadtree_detail
+{
+/** Entry parameter of the ray l.p + t * l.v, t >= 0, into the box, or infinity if the ray misses the box.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T ray_entry(AABB2<T> const& b, Line2<T> const& l, Vector2<T> const& inv_v)
+{
+    T const inf = std::numeric_limits<T>::infinity();
+    T t_min = traits::Constants<T>::Zero();
+    T t_max = inf;
+    for (std::size_t i = 0; i < 2; ++i) {
+        if (l.v[i] == traits::Constants<T>::Zero()) {
+            if ((l.p[i] < b.min[i]) || (l.p[i] > b.max[i])) { return inf; }
+        } else {
+            T t1 = (b.min[i] - l.p[i]) * inv_v[i];
+            T t2 = (b.max[i] - l.p[i]) * inv_v[i];
+            if (t1 > t2) { std::swap(t1, t2); }
+            t_min = std::max(t_min, t1);
+            t_max = std::min(t_max, t2);
+            if (t_min > t_max) { return inf; }
+        }
+    }
+    return t_min;
+}
+
+/** Interleaves the bits of x and y, with x in the even bits.
+ */
+[[nodiscard]] constexpr inline std::uint64_t morton_code(std::uint32_t x, std::uint32_t y)
+{
+    auto const spread = [](std::uint64_t v) {
+        v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+        v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+        v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
+}
+}
+
+/** Loose quadtree over axis-aligned boxes.
+ * Each element is stored in exactly one node: the deepest node whose cell contains the center of the element
+ * and is at least as large as the element along each axis. The loose bounds of a node are its
+ * cell enlarged by half the cell size on each side, which is guaranteed to contain all elements of the node.
+ * Since the node for an element can be computed directly from its center and size, insertion and updates
+ * are O(depth) without any splitting or merging, and elements never straddle node boundaries.
+ * Elements that do not fit into the world bounds are kept in the root node, which is always searched.
+ * Nodes and elements are stored in flat arrays with free lists; element ids are indices into the element
+ * array and remain stable until the element is removed. Nodes that become empty are returned to the pool.
+ */
+template<std::floating_point T, typename UserData_T = std::size_t>
+class LooseQuadtree {
+public:
+    using ValueType = T;
+    using UserDataType = UserData_T;
+    using ElementId = std::size_t;
+    static constexpr std::size_t null_index = std::numeric_limits<std::size_t>::max();
+private:
+    struct Location {
+        int depth;
+        std::uint32_t x;
+        std::uint32_t y;
+
+        friend constexpr bool operator==(Location const&, Location const&) = default;
+    };
+
+    struct Node {
+        AABB2<T> loose_bounds;
+        std::size_t parent;                     ///< Parent node, or next free node for nodes in the free list.
+        std::array<std::size_t, 4> children;
+        std::size_t first_element;
+        Location location;
+    };
+
+    struct Element {
+        AABB2<T> box;
+        UserData_T data;
+        std::size_t node;                       ///< null_index for elements in the free list.
+        std::size_t next;                       ///< Next element in the same node, or next free element.
+        std::size_t previous;
+    };
+
+    AABB2<T> m_world;
+    Vector2<T> m_worldSize;
+    int m_maxDepth;
+    std::vector<Node> m_nodes;
+    std::vector<Element> m_elements;
+    std::size_t m_freeNodes;
+    std::size_t m_freeElements;
+    std::size_t m_elementCount;
+public:
+    /** @param[in] world Region covered by the tree. Elements outside of it are still supported, but not
+     *                   subdivided.
+     * @param[in] max_depth Maximum number of subdivisions below the root, at most 24.
+     */
+    explicit LooseQuadtree(AABB2<T> const& world, int max_depth = 8)
+        :m_world(world), m_worldSize(world.max - world.min), m_maxDepth(max_depth),
+         m_freeNodes(null_index), m_freeElements(null_index), m_elementCount(0)
+    {
+        assert((max_depth >= 0) && (max_depth <= 24));
+        assert((m_worldSize.x > traits::Constants<T>::Zero()) && (m_worldSize.y > traits::Constants<T>::Zero()));
+        clear();
+    }
+
+    [[nodiscard]] AABB2<T> const& world() const
+    {
+        return m_world;
+    }
+
+    [[nodiscard]] int max_depth() const
+    {
+        return m_maxDepth;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_elementCount;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_elementCount == 0;
+    }
+
+    /** Number of nodes currently in use, including the root.
+     */
+    [[nodiscard]] std::size_t node_count() const
+    {
+        std::size_t free_count = 0;
+        for (std::size_t i = m_freeNodes; i != null_index; i = m_nodes[i].parent) { ++free_count; }
+        return m_nodes.size() - free_count;
+    }
+
+    void clear()
+    {
+        m_nodes.clear();
+        m_elements.clear();
+        m_freeNodes = null_index;
+        m_freeElements = null_index;
+        m_elementCount = 0;
+        allocate_node(null_index, Location{ 0, 0, 0 });
+    }
+
+    void reserve(std::size_t n_elements)
+    {
+        m_elements.reserve(n_elements);
+    }
+
+    ElementId insert(AABB2<T> const& box, UserData_T data)
+    {
+        std::size_t const id = allocate_element(box, std::move(data));
+        link_element(id, find_or_create_node(locate(box)));
+        return id;
+    }
+
+    /** Inserts many elements at once.
+     * Elements are sorted by their target node before insertion, so that each node is looked up only once
+     * and, unless previously removed elements leave holes in the element pool, the elements of each node
+     * end up adjacent in memory.
+     * @return The ids of the inserted elements, in the order of boxes.
+     */
+    std::vector<ElementId> insert(std::span<AABB2<T> const> boxes, std::span<UserData_T const> data)
+    {
+        assert(boxes.size() == data.size());
+        std::size_t const n = boxes.size();
+        std::vector<Location> locations(n);
+        std::vector<std::uint64_t> keys(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            locations[i] = locate(boxes[i]);
+            // group by node, ordering the nodes of each level along a Z-order curve
+            keys[i] = (static_cast<std::uint64_t>(locations[i].depth) << 58) |
+                      loose_quadtree_detail::morton_code(locations[i].x, locations[i].y);
+        }
+        std::vector<std::size_t> order(n);
+        std::iota(begin(order), end(order), std::size_t{ 0 });
+        std::sort(begin(order), end(order), [&keys](std::size_t lhs, std::size_t rhs) { return keys[lhs] < keys[rhs]; });
+
+        m_elements.reserve(m_elements.size() + n);
+        std::vector<ElementId> ids(n);
+        std::size_t node = null_index;
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t const i = order[k];
+            if ((k == 0) || (locations[i] != locations[order[k - 1]])) {
+                node = find_or_create_node(locations[i]);
+            }
+            ids[i] = allocate_element(boxes[i], data[i]);
+            link_element(ids[i], node);
+        }
+        return ids;
+    }
+
+    void remove(ElementId id)
+    {
+        assert((id < m_elements.size()) && (m_elements[id].node != null_index));
+        std::size_t const node = m_elements[id].node;
+        unlink_element(id);
+        m_elements[id].data = UserData_T{};
+        m_elements[id].node = null_index;
+        m_elements[id].next = m_freeElements;
+        m_freeElements = id;
+        --m_elementCount;
+        prune(node);
+    }
+
+    /** Changes the box of an element.
+     * The element only moves to a different node if its center leaves the cell of its current node or its
+     * size changes such that it fits a different level.
+     */
+    void update(ElementId id, AABB2<T> const& box)
+    {
+        assert((id < m_elements.size()) && (m_elements[id].node != null_index));
+        m_elements[id].box = box;
+        Location const target = locate(box);
+        std::size_t const node = m_elements[id].node;
+        if (m_nodes[node].location == target) { return; }
+        unlink_element(id);
+        link_element(id, find_or_create_node(target));
+        prune(node);
+    }
+
+    [[nodiscard]] AABB2<T> const& bounds(ElementId id) const
+    {
+        assert((id < m_elements.size()) && (m_elements[id].node != null_index));
+        return m_elements[id].box;
+    }
+
+    [[nodiscard]] UserData_T const& user_data(ElementId id) const
+    {
+        assert((id < m_elements.size()) && (m_elements[id].node != null_index));
+        return m_elements[id].data;
+    }
+
+    [[nodiscard]] UserData_T& user_data(ElementId id)
+    {
+        assert((id < m_elements.size()) && (m_elements[id].node != null_index));
+        return m_elements[id].data;
+    }
+
+    /** Invokes f(ElementId) for every element whose box intersects range.
+     * If f returns bool, returning false stops the query.
+     */
+    template<typename F>
+    void query(AABB2<T> const& range, F&& f) const
+    {
+        traverse([&range](AABB2<T> const& b) { return intersects(b, range); },
+                 [&range, &f](ElementId id, AABB2<T> const& b) {
+                     return (!intersects(b, range)) || invoke_callback(f, id);
+                 });
+    }
+
+    /** Invokes f(ElementId) for every element whose box intersects the circle.
+     * If f returns bool, returning false stops the query.
+     */
+    template<typename F>
+    void query(Circle2<T> const& circle, F&& f) const
+    {
+        traverse([&circle](AABB2<T> const& b) { return collides(circle, b); },
+                 [&circle, &f](ElementId id, AABB2<T> const& b) {
+                     return (!collides(circle, b)) || invoke_callback(f, id);
+                 });
+    }
+
+    /** Invokes f(ElementId, T t) for every element whose box is hit by the ray l.p + t * l.v with
+     * 0 <= t <= t_max, where t is the parameter at which the ray enters the box.
+     * Elements are not reported in order of t.
+     * If f returns bool, returning false stops the query.
+     */
+    template<typename F>
+    void query(Line2<T> const& ray, T t_max, F&& f) const
+    {
+        using loose_quadtree_detail::ray_entry;
+        T const one = traits::Constants<T>::One();
+        Vector2<T> const inv_v(one / ray.v.x, one / ray.v.y);
+        traverse([&](AABB2<T> const& b) { return ray_entry(b, ray, inv_v) <= t_max; },
+                 [&](ElementId id, AABB2<T> const& b) {
+                     T const t = ray_entry(b, ray, inv_v);
+                     if (t > t_max) { return true; }
+                     if constexpr (std::is_same_v<std::invoke_result_t<F&, ElementId, T>, bool>) {
+                         return f(id, t);
+                     } else {
+                         f(id, t);
+                         return true;
+                     }
+                 });
+    }
+
+    /** Returns the element hit first by the ray l.p + t * l.v with 0 <= t <= t_max, together with the
+     * parameter at which the ray enters its box, or {null_index, infinity} if no element is hit.
+     * Nodes are skipped once their loose bounds are entered after the closest hit found so far.
+     */
+    [[nodiscard]] std::pair<ElementId, T> query_nearest(Line2<T> const& ray, T t_max) const
+    {
+        using loose_quadtree_detail::ray_entry;
+        T const one = traits::Constants<T>::One();
+        Vector2<T> const inv_v(one / ray.v.x, one / ray.v.y);
+        std::pair<ElementId, T> best{ null_index, std::numeric_limits<T>::infinity() };
+        T t_limit = t_max;
+        traverse([&](AABB2<T> const& b) { return ray_entry(b, ray, inv_v) <= t_limit; },
+                 [&](ElementId id, AABB2<T> const& b) {
+                     T const t = ray_entry(b, ray, inv_v);
+                     if (t <= t_limit) {
+                         t_limit = t;
+                         best = { id, t };
+                     }
+                     return true;
+                 });
+        return best;
+    }
+private:
+    template<typename F, typename... Args>
+    static bool invoke_callback(F& f, Args... args)
+    {
+        if constexpr (std::is_same_v<std::invoke_result_t<F&, Args...>, bool>) {
+            return f(args...);
+        } else {
+            f(args...);
+            return true;
+        }
+    }
+
+    /** Depth-first traversal of all nodes whose loose bounds pass node_test.
+     * The root is always visited. Traversal stops once element_visitor returns false.
+     */
+    template<typename NodeTest_T, typename ElementVisitor_T>
+    void traverse(NodeTest_T const& node_test, ElementVisitor_T const& element_visitor) const
+    {
+        std::array<std::size_t, 4 * 25 + 1> stack;
+        std::size_t stack_size = 0;
+        stack[stack_size++] = 0;
+        while (stack_size > 0) {
+            Node const& node = m_nodes[stack[--stack_size]];
+            for (std::size_t e = node.first_element; e != null_index; e = m_elements[e].next) {
+                if (!element_visitor(e, m_elements[e].box)) { return; }
+            }
+            for (std::size_t const c : node.children) {
+                if ((c != null_index) && node_test(m_nodes[c].loose_bounds)) {
+                    stack[stack_size++] = c;
+                }
+            }
+        }
+    }
+
+    /** Determines the node an element with the given box belongs to.
+     */
+    [[nodiscard]] Location locate(AABB2<T> const& box) const
+    {
+        T const half = static_cast<T>(0.5);
+        Point2<T> const center = box.min + (box.max - box.min) * half;
+        if (!intersects(m_world, center)) { return Location{ 0, 0, 0 }; }
+        Vector2<T> const size = box.max - box.min;
+        // an element fits into a level if it is no larger than the cell, as its center lies within the cell
+        // and the loose bounds extend half a cell beyond it
+        int depth = 0;
+        Vector2<T> cell = m_worldSize;
+        while ((depth < m_maxDepth) && (size.x * 2 <= cell.x) && (size.y * 2 <= cell.y)) {
+            cell = cell * half;
+            ++depth;
+        }
+        std::uint32_t const cells = std::uint32_t{ 1 } << depth;
+        auto const cell_index = [cells](T offset, T cell_size) {
+            return std::min(static_cast<std::uint32_t>(offset / cell_size), cells - 1);
+        };
+        return Location{ depth,
+                         cell_index(center.x - m_world.min.x, cell.x),
+                         cell_index(center.y - m_world.min.y, cell.y) };
+    }
+
+    [[nodiscard]] std::size_t find_or_create_node(Location const& loc)
+    {
+        std::size_t node = 0;
+        for (int d = 1; d <= loc.depth; ++d) {
+            int const shift = loc.depth - d;
+            std::size_t const quadrant = ((loc.x >> shift) & 1u) | (((loc.y >> shift) & 1u) << 1);
+            std::size_t child = m_nodes[node].children[quadrant];
+            if (child == null_index) {
+                child = allocate_node(node, Location{ d, loc.x >> shift, loc.y >> shift });
+                m_nodes[node].children[quadrant] = child;
+            }
+            node = child;
+        }
+        return node;
+    }
+
+    std::size_t allocate_node(std::size_t parent, Location const& loc)
+    {
+        std::size_t index;
+        if (m_freeNodes == null_index) {
+            index = m_nodes.size();
+            m_nodes.emplace_back();
+        } else {
+            index = m_freeNodes;
+            m_freeNodes = m_nodes[index].parent;
+        }
+        Node& node = m_nodes[index];
+        node.parent = parent;
+        node.children.fill(null_index);
+        node.first_element = null_index;
+        node.location = loc;
+        // loose bounds are the cell enlarged by half a cell on each side
+        T const scale = traits::Constants<T>::One() / static_cast<T>(std::uint32_t{ 1 } << loc.depth);
+        Vector2<T> const cell = m_worldSize * scale;
+        Vector2<T> const half_cell = cell * static_cast<T>(0.5);
+        Point2<T> const cell_min(m_world.min.x + cell.x * static_cast<T>(loc.x),
+                                 m_world.min.y + cell.y * static_cast<T>(loc.y));
+        node.loose_bounds = AABB2<T>(cell_min - half_cell, cell_min + cell + half_cell);
+        return index;
+    }
+
+    std::size_t allocate_element(AABB2<T> const& box, UserData_T data)
+    {
+        std::size_t index;
+        if (m_freeElements == null_index) {
+            index = m_elements.size();
+            m_elements.emplace_back();
+        } else {
+            index = m_freeElements;
+            m_freeElements = m_elements[index].next;
+        }
+        Element& e = m_elements[index];
+        e.box = box;
+        e.data = std::move(data);
+        ++m_elementCount;
+        return index;
+    }
+
+    void link_element(std::size_t id, std::size_t node)
+    {
+        Element& e = m_elements[id];
+        e.node = node;
+        e.previous = null_index;
+        e.next = m_nodes[node].first_element;
+        if (e.next != null_index) { m_elements[e.next].previous = id; }
+        m_nodes[node].first_element = id;
+    }
+
+    void unlink_element(std::size_t id)
+    {
+        Element const& e = m_elements[id];
+        if (e.previous != null_index) {
+            m_elements[e.previous].next = e.next;
+        } else {
+            m_nodes[e.node].first_element = e.next;
+        }
+        if (e.next != null_index) { m_elements[e.next].previous = e.previous; }
+    }
+
+    /** Returns empty leaf nodes to the pool, starting at node and walking up towards the root.
+     */
+    void prune(std::size_t node)
+    {
+        while (node != 0) {
+            Node const& n = m_nodes[node];
+            if ((n.first_element != null_index) ||
+                std::any_of(begin(n.children), end(n.children), [](std::size_t c) { return c != null_index; }))
+            {
+                return;
+            }
+            std::size_t const parent = n.parent;
+            for (auto& c : m_nodes[parent].children) {
+                if (c == node) { c = null_index; }
+            }
+            m_nodes[node].parent = m_freeNodes;
+            m_freeNodes = node;
+            node = parent;
+        }
+    }
+};
+}
+
+#endif
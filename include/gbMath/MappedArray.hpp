@@ -0,0 +1,284 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MAPPED_ARRAY_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MAPPED_ARRAY_HPP
+
+/** @file
+ *
+ * @brief Read-only memory-mapped arrays of binary serialized values.
+ * This header includes the operating system's file mapping headers and is therefore not part of GhulbusMath.hpp.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/BinaryIO.hpp>
+#include <gbMath/Transform3.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#define GHULBUS_MATH_MAPPED_ARRAY_UNDEF_NOMINMAX
+#endif
+#include <Windows.h>
+#ifdef GHULBUS_MATH_MAPPED_ARRAY_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef GHULBUS_MATH_MAPPED_ARRAY_UNDEF_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Read-only memory mapping of a complete file.
+ * The contents are paged in on access, so files larger than the physical memory can be mapped;
+ * the pages are backed by the file and only consume page cache.
+ */
+class MappedFile {
+private:
+    std::byte const* m_data = nullptr;
+    std::size_t m_size = 0;
+public:
+    MappedFile() = default;
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    MappedFile(MappedFile&& rhs) noexcept
+        :m_data(std::exchange(rhs.m_data, nullptr)), m_size(std::exchange(rhs.m_size, 0))
+    {}
+
+    MappedFile& operator=(MappedFile&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            unmap();
+            m_data = std::exchange(rhs.m_data, nullptr);
+            m_size = std::exchange(rhs.m_size, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    /** Maps the file at path.
+     * @return The mapping, or std::nullopt if the file could not be opened or mapped.
+     */
+    [[nodiscard]] static std::optional<MappedFile> open(std::filesystem::path const& path)
+    {
+        MappedFile ret;
+#ifdef _WIN32
+        HANDLE const file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) { return std::nullopt; }
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file, &file_size) ||
+            (static_cast<std::uint64_t>(file_size.QuadPart) > std::numeric_limits<std::size_t>::max()))
+        {
+            ::CloseHandle(file);
+            return std::nullopt;
+        }
+        ret.m_size = static_cast<std::size_t>(file_size.QuadPart);
+        if (ret.m_size > 0) {
+            HANDLE const mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                ret.m_data = static_cast<std::byte const*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                ::CloseHandle(mapping);
+            }
+        }
+        ::CloseHandle(file);
+#else
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) { return std::nullopt; }
+        struct stat file_stat;
+        if ((::fstat(fd, &file_stat) != 0) ||
+            (static_cast<std::uint64_t>(file_stat.st_size) > std::numeric_limits<std::size_t>::max()))
+        {
+            ::close(fd);
+            return std::nullopt;
+        }
+        ret.m_size = static_cast<std::size_t>(file_stat.st_size);
+        if (ret.m_size > 0) {
+            void* const p = ::mmap(nullptr, ret.m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) { ret.m_data = static_cast<std::byte const*>(p); }
+        }
+        ::close(fd);
+#endif
+        if ((ret.m_size > 0) && (ret.m_data == nullptr)) {
+            ret.m_size = 0;
+            return std::nullopt;
+        }
+        return ret;
+    }
+
+    [[nodiscard]] std::span<std::byte const> bytes() const
+    {
+        return std::span<std::byte const>(m_data, m_size);
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /** Hints that the mapping will be accessed sequentially, which enables more aggressive read-ahead and
+     * earlier eviction of pages that were already processed. Has no effect on platforms without such a hint.
+     */
+    void advise_sequential() const
+    {
+#ifndef _WIN32
+        if (m_data) { ::posix_madvise(const_cast<std::byte*>(m_data), m_size, POSIX_MADV_SEQUENTIAL); }
+#endif
+    }
+
+private:
+    void unmap()
+    {
+        if (m_data) {
+#ifdef _WIN32
+            ::UnmapViewOfFile(m_data);
+#else
+            ::munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+};
+
+/** Read-only array of values backed by a memory-mapped file in the format written by write_binary().
+ * The file must start with a header describing values that are compatible with T, stored in native byte order.
+ * The values are accessed in place without copying.
+ */
+template<BinarySerializable T>
+class MappedArray {
+    static_assert(is_binary_memcpyable_v<T>, "MappedArray requires a type whose layout matches the binary format.");
+public:
+    using ValueType = T;
+private:
+    MappedFile m_file;
+    BinaryHeader m_header{};
+    std::span<T const> m_elements;
+public:
+    MappedArray() = default;
+
+    MappedArray(MappedArray&& rhs) noexcept
+        :m_file(std::move(rhs.m_file)), m_header(rhs.m_header), m_elements(std::exchange(rhs.m_elements, {}))
+    {}
+
+    MappedArray& operator=(MappedArray&& rhs) noexcept
+    {
+        m_file = std::move(rhs.m_file);
+        m_header = rhs.m_header;
+        m_elements = std::exchange(rhs.m_elements, {});
+        return *this;
+    }
+
+    /** Maps the file at path.
+     * @return The array, or std::nullopt if the file could not be mapped or does not contain an array of T.
+     */
+    [[nodiscard]] static std::optional<MappedArray> open(std::filesystem::path const& path)
+    {
+        std::optional<MappedFile> file = MappedFile::open(path);
+        if (!file) { return std::nullopt; }
+        return from_file(std::move(*file));
+    }
+
+    /** Takes ownership of a mapping and validates its contents.
+     * @return The array, or std::nullopt if the header is invalid or not compatible with T, if the values
+     *         are not stored in native byte order, if the file is too small for the number of values given
+     *         in the header, or if the values are not suitably aligned for T.
+     */
+    [[nodiscard]] static std::optional<MappedArray> from_file(MappedFile&& file)
+    {
+        std::span<std::byte const> const bytes = file.bytes();
+        if (bytes.size() < BinaryHeader::size) { return std::nullopt; }
+        std::optional<BinaryHeader> const header = read_binary_header(bytes.first<BinaryHeader::size>());
+        if (!header || !is_compatible<T>(*header) || (header->byte_order != std::endian::native)) {
+            return std::nullopt;
+        }
+        std::size_t const available = (bytes.size() - BinaryHeader::size) / binary_size_v<T>;
+        if (header->count > available) { return std::nullopt; }
+        std::byte const* const payload = bytes.data() + BinaryHeader::size;
+        if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) { return std::nullopt; }
+        MappedArray ret;
+        ret.m_header = *header;
+        ret.m_elements = std::span<T const>(reinterpret_cast<T const*>(payload),
+                                            static_cast<std::size_t>(header->count));
+        ret.m_file = std::move(file);
+        return ret;
+    }
+
+    [[nodiscard]] BinaryHeader const& header() const
+    {
+        return m_header;
+    }
+
+    [[nodiscard]] MappedFile const& file() const
+    {
+        return m_file;
+    }
+
+    [[nodiscard]] std::span<T const> elements() const
+    {
+        return m_elements;
+    }
+
+    [[nodiscard]] T const* data() const
+    {
+        return m_elements.data();
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_elements.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_elements.empty();
+    }
+
+    [[nodiscard]] T const& operator[](std::size_t i) const
+    {
+        return m_elements[i];
+    }
+
+    [[nodiscard]] auto begin() const
+    {
+        return m_elements.begin();
+    }
+
+    [[nodiscard]] auto end() const
+    {
+        return m_elements.end();
+    }
+};
+
+template<typename T>
+using MappedPointCloud3 = MappedArray<Point3<T>>;
+
+template<typename T>
+using MappedTransforms3 = MappedArray<Transform3<T>>;
+}
+
+#endif
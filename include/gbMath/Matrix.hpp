@@ -21,13 +21,57 @@
 #include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <utility>
 
 namespace GHULBUS_MATH_NAMESPACE
 {
-template<typename T, std::size_t M, std::size_t N>
+namespace matrix_detail
+{
+/** Computes the matrix product ret = lhs * rhs for an MxN lhs and an NxQ rhs.
+ * This kernel is shared by all matrix types that provide (row, column) element access.
+ */
+template<typename T, typename Lhs_T, typename Rhs_T, typename Result_T>
+constexpr inline void multiply(Lhs_T const& lhs, Rhs_T const& rhs, Result_T& ret,
+                               std::size_t m, std::size_t n, std::size_t q)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        for (std::size_t j = 0; j < q; ++j) {
+            T acc = traits::Constants<T>::Zero();
+            for (std::size_t k = 0; k < n; ++k) {
+                acc += lhs(i, k) * rhs(k, j);
+            }
+            ret(i, j) = acc;
+        }
+    }
+}
+
+/** Computes the matrix-vector product ret = mat * v for an MxN matrix.
+ */
+template<typename T, typename Matrix_T, typename Vector_T, typename Result_T>
+constexpr inline void multiply_vector(Matrix_T const& mat, Vector_T const& v, Result_T& ret,
+                                      std::size_t m, std::size_t n)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        T acc = traits::Constants<T>::Zero();
+        for (std::size_t k = 0; k < n; ++k) {
+            acc += mat(i, k) * v[k];
+        }
+        ret[i] = acc;
+    }
+}
+}
+
+/** MxN Matrix.
+ * The storage order determines the layout of the elements in the underlying array `m`. A column-major matrix
+ * can be passed to and from APIs that expect column-major buffers without having to transpose the data.
+ * Independent of the storage order, all constructors taking individual elements expect them in row-major order
+ * and all indexing functions other than operator[] take a (row, column) pair.
+ */
+template<typename T, std::size_t M, std::size_t N,
+         MatrixPolicies::Order Order_V = MatrixPolicies::Order::RowMajor>
 class Matrix
 {
 public:
@@ -36,9 +80,21 @@ public:
     static_assert(N > 0, "Matrix must have at least one column.");
     using Rows = std::integral_constant<std::size_t, M>;
     using Columns = std::integral_constant<std::size_t, N>;
+    using StorageOrder = std::integral_constant<MatrixPolicies::Order, Order_V>;
 
     std::array<T, M*N> m;
 
+    /** Index into the underlying array `m` of the element at row r and column c.
+     */
+    [[nodiscard]] static constexpr std::size_t storage_index(std::size_t r, std::size_t c)
+    {
+        if constexpr (Order_V == MatrixPolicies::Order::RowMajor) {
+            return r * N + c;
+        } else {
+            return c * M + r;
+        }
+    }
+
     constexpr Matrix()
         :m{}
     {}
@@ -48,53 +104,82 @@ public:
 
     template<typename... Args>
     constexpr explicit Matrix(Args... args)
-        requires((sizeof...(args) == M*N) && (std::same_as<Args, T> && ...))
+        requires((sizeof...(args) == M*N) && (std::same_as<Args, T> && ...) &&
+                 (Order_V == MatrixPolicies::Order::RowMajor))
     : m{args...}
     {}
 
+    template<typename... Args>
+    constexpr explicit Matrix(Args... args)
+        requires((sizeof...(args) == M*N) && (std::same_as<Args, T> && ...) &&
+                 (Order_V == MatrixPolicies::Order::ColumnMajor))
+    : Matrix(std::array<T, M*N>{args...}.data(), MatrixPolicies::InputOrder_RowMajor{})
+    {}
+
     constexpr Matrix(Matrix const&) = default;
     constexpr Matrix& operator=(Matrix const&) = default;
 
-    template<std::convertible_to<T> U>
-    constexpr explicit Matrix(Matrix<U, M, N> const& other)
+    template<std::convertible_to<T> U, MatrixPolicies::Order OtherOrder_V>
+    constexpr explicit Matrix(Matrix<U, M, N, OtherOrder_V> const& other)
     {
-        std::transform(begin(other.m), end(other.m), begin(m),
-            [](U const& u) -> T { return static_cast<T>(u); });
+        if constexpr (OtherOrder_V == Order_V) {
+            std::transform(begin(other.m), end(other.m), begin(m),
+                [](U const& u) -> T { return static_cast<T>(u); });
+        } else {
+            for (std::size_t i = 0; i < M; ++i) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    (*this)(i, j) = static_cast<T>(other(i, j));
+                }
+            }
+        }
     }
 
     constexpr explicit Matrix(T const* arr, MatrixPolicies::InputOrder_RowMajor)
     {
-        std::copy(arr, arr + M * N, begin(m));
+        if constexpr (Order_V == MatrixPolicies::Order::RowMajor) {
+            std::copy(arr, arr + M * N, begin(m));
+        } else {
+            for (std::size_t i = 0; i < M; ++i) {
+                for (std::size_t j = 0; j < N; ++j) {
+                    (*this)(i, j) = arr[i * N + j];
+                }
+            }
+        }
     }
 
     constexpr explicit Matrix(T const* arr, MatrixPolicies::InputOrder_ColumnMajor)
     {
-        for (std::size_t j = 0; j < N; ++j) {
-            for (std::size_t i = 0; i < M; ++i) {
-                m[i * N + j] = arr[j * M + i];
+        if constexpr (Order_V == MatrixPolicies::Order::ColumnMajor) {
+            std::copy(arr, arr + M * N, begin(m));
+        } else {
+            for (std::size_t j = 0; j < N; ++j) {
+                for (std::size_t i = 0; i < M; ++i) {
+                    (*this)(i, j) = arr[j * M + i];
+                }
             }
         }
     }
 
     constexpr explicit Matrix(Matrix2<T> const& other)
-        : m{ other.m11, other.m12, other.m21, other.m22 }
+        : Matrix(other.m11, other.m12,
+                 other.m21, other.m22)
     {
         static_assert((M == 2) && (N == 2), "Dimensions must match.");
     }
 
     constexpr explicit Matrix(Matrix3<T> const& other)
-        : m{ other.m11, other.m12, other.m13,
-             other.m21, other.m22, other.m23,
-             other.m31, other.m32, other.m33 }
+        : Matrix(other.m11, other.m12, other.m13,
+                 other.m21, other.m22, other.m23,
+                 other.m31, other.m32, other.m33)
     {
         static_assert((M == 3) && (N == 3), "Dimensions must match.");
     }
 
     constexpr explicit Matrix(Matrix4<T> const& other)
-        : m{ other.m11, other.m12, other.m13, other.m14,
-             other.m21, other.m22, other.m23, other.m24,
-             other.m31, other.m32, other.m33, other.m34,
-             other.m41, other.m42, other.m43, other.m44 }
+        : Matrix(other.m11, other.m12, other.m13, other.m14,
+                 other.m21, other.m22, other.m23, other.m24,
+                 other.m31, other.m32, other.m33, other.m34,
+                 other.m41, other.m42, other.m43, other.m44)
     {
         static_assert((M == 4) && (N == 4), "Dimensions must match.");
     }
@@ -121,19 +206,19 @@ public:
 
     [[nodiscard]] constexpr T& operator()(std::size_t r, std::size_t c)
     {
-        return m[r * N + c];
+        return m[storage_index(r, c)];
     }
 
     [[nodiscard]] constexpr T const& operator()(std::size_t r, std::size_t c) const
     {
-        return m[r * N + c];
+        return m[storage_index(r, c)];
     }
 
     [[nodiscard]] constexpr Vector<T, N> row(std::size_t idx) const
     {
         Vector<T, N> ret(doNotInitialize);
         for (std::size_t j = 0; j < N; ++j) {
-            ret[j] = m[idx * N + j];
+            ret[j] = (*this)(idx, j);
         }
         return ret;
     }
@@ -142,7 +227,7 @@ public:
     {
         Vector<T, M> ret(doNotInitialize);
         for (std::size_t j = 0; j < M; ++j) {
-            ret[j] = m[j * N + idx];
+            ret[j] = (*this)(j, idx);
         }
         return ret;
     }
@@ -150,14 +235,14 @@ public:
     constexpr void set_row(std::size_t idx, Vector<T, N> const& r)
     {
         for (std::size_t j = 0; j < N; ++j) {
-            m[idx * N + j] = r[j];
+            (*this)(idx, j) = r[j];
         }
     }
 
     constexpr void set_column(std::size_t idx, Vector<T, M> const& c)
     {
         for (std::size_t j = 0; j < M; ++j) {
-            m[j * N + idx] = c[j];
+            (*this)(j, idx) = c[j];
         }
     }
 
@@ -281,16 +366,24 @@ public:
     }
 
     template<std::size_t Q>
-    [[nodiscard]] friend constexpr Matrix<T, M, Q> operator*(Matrix<T, M, N> const& lhs, Matrix<T, N, Q>  const& rhs)
-    {
-        Matrix<T, M, Q> ret(doNotInitialize);
-        for (std::size_t i = 0; i < M; ++i) {
+    [[nodiscard]] friend constexpr Matrix<T, M, Q, Order_V> operator*(Matrix<T, M, N, Order_V> const& lhs,
+                                                                      Matrix<T, N, Q, Order_V> const& rhs)
+    {
+        Matrix<T, M, Q, Order_V> ret(doNotInitialize);
+        if constexpr (Order_V == MatrixPolicies::Order::RowMajor) {
+            matrix_detail::multiply<T>(lhs, rhs, ret, M, N, Q);
+        } else {
+            // accumulate each result column as a linear combination of the contiguous columns of lhs
             for (std::size_t j = 0; j < Q; ++j) {
-                T acc = traits::Constants<T>::Zero();
+                for (std::size_t i = 0; i < M; ++i) {
+                    ret(i, j) = traits::Constants<T>::Zero();
+                }
                 for (std::size_t k = 0; k < N; ++k) {
-                    acc += lhs(i, k) * rhs(k, j);
+                    T const r = rhs(k, j);
+                    for (std::size_t i = 0; i < M; ++i) {
+                        ret(i, j) += lhs(i, k) * r;
+                    }
                 }
-                ret(i, j) = acc;
             }
         }
         return ret;
@@ -299,12 +392,17 @@ public:
     [[nodiscard]] friend constexpr Vector<T, M> operator*(Matrix const& m, Vector<T, N> const& v)
     {
         Vector<T, M> ret(doNotInitialize);
-        for (std::size_t i = 0; i < M; ++i) {
-            T acc = traits::Constants<T>::Zero();
+        if constexpr (Order_V == MatrixPolicies::Order::RowMajor) {
+            matrix_detail::multiply_vector<T>(m, v, ret, M, N);
+        } else {
+            for (std::size_t i = 0; i < M; ++i) {
+                ret[i] = traits::Constants<T>::Zero();
+            }
             for (std::size_t k = 0; k < N; ++k) {
-                acc += m(i, k) * v[k];
+                for (std::size_t i = 0; i < M; ++i) {
+                    ret[i] += m(i, k) * v[k];
+                }
             }
-            ret[i] = acc;
         }
         return ret;
     }
@@ -335,7 +433,7 @@ template<typename T, std::size_t M, std::size_t N, typename... Args>
     Matrix<T, M, N> ret(doNotInitialize);
     for (std::size_t i = 0; i < M; ++i) {
         for (std::size_t j = 0; j < N; ++j) {
-            ret.m[i * N + j] = varr[i][j];
+            ret(i, j) = varr[i][j];
         }
     }
     return ret;
@@ -349,16 +447,16 @@ template<typename T, std::size_t M, std::size_t N, typename... Args>
     Matrix<T, M, N> ret(doNotInitialize);
     for (std::size_t i = 0; i < M; ++i) {
         for (std::size_t j = 0; j < N; ++j) {
-            ret.m[i * N + j] = varr[j][i];
+            ret(i, j) = varr[j][i];
         }
     }
     return ret;
 }
 
-template<typename T, std::size_t M, std::size_t N>
-[[nodiscard]] constexpr inline Matrix<T, N, M> transpose(Matrix<T, M, N> const& m)
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+[[nodiscard]] constexpr inline Matrix<T, N, M, Order_V> transpose(Matrix<T, M, N, Order_V> const& m)
 {
-    Matrix<T, N, M> ret(doNotInitialize);
+    Matrix<T, N, M, Order_V> ret(doNotInitialize);
     for (std::size_t i = 0; i < M; ++i) {
         for (std::size_t j = 0; j < N; ++j) {
             ret(j, i) = m(i, j);
@@ -367,11 +465,11 @@ template<typename T, std::size_t M, std::size_t N>
     return ret;
 }
 
-template<typename T, std::size_t N>
-[[nodiscard]] constexpr inline Matrix<T, N, N> identityN()
+template<typename T, std::size_t N, MatrixPolicies::Order Order_V = MatrixPolicies::Order::RowMajor>
+[[nodiscard]] constexpr inline Matrix<T, N, N, Order_V> identityN()
 {
     using ::GHULBUS_MATH_NAMESPACE::traits::Constants;
-    Matrix<T, N, N> ret(doNotInitialize);
+    Matrix<T, N, N, Order_V> ret(doNotInitialize);
     for (std::size_t i = 0; i < N; ++i) {
         for (std::size_t j = 0; j < N; ++j) {
             ret(i, j) = (i == j) ? Constants<T>::One() : Constants<T>::Zero();
@@ -380,8 +478,8 @@ template<typename T, std::size_t N>
     return ret;
 }
 
-template<typename T, std::size_t N>
-[[nodiscard]] constexpr inline T trace(Matrix<T, N, N> const& m)
+template<typename T, std::size_t N, MatrixPolicies::Order Order_V>
+[[nodiscard]] constexpr inline T trace(Matrix<T, N, N, Order_V> const& m)
 {
     T ret = traits::Constants<T>::Zero();
     for (std::size_t i = 0; i < N; ++i) {
@@ -390,6 +488,114 @@ template<typename T, std::size_t N>
     return ret;
 }
 
+namespace matrix_detail
+{
+/** LU decomposition kernel shared by all square matrix types that provide (row, column) element access
+ * and swap_rows().
+ * Decomposes the NxN matrix lu in place (Doolittle's method with implicit partial pivoting) and stores
+ * the row permutation in indices. row_normalizer is scratch storage for N elements.
+ * @return The sign of the row permutation, or 0 if the matrix is singular.
+ */
+template<typename T, typename Matrix_T, typename Indices_T, typename Scratch_T>
+constexpr inline T lu_decompose_in_place(Matrix_T& lu, Indices_T& indices, Scratch_T& row_normalizer,
+                                         std::size_t n)
+{
+    using std::abs;
+    using std::swap;
+    T det_sign = traits::Constants<T>::One();
+
+    // take as a normalizer the max element from each row
+    for (std::size_t i = 0; i < n; ++i) {
+        T max_value = traits::Constants<T>::Zero();
+        for (std::size_t j = 0; j < n; ++j) {
+            T const v = abs(lu(i, j));
+            if (v > max_value) { max_value = v; }
+        }
+        if (max_value == traits::Constants<T>::Zero()) {
+            // matrix is singular
+            return traits::Constants<T>::Zero();
+        }
+        row_normalizer[i] =  traits::Constants<T>::One() / max_value;
+        indices[i] = i;
+    }
+
+    // perform decomposition (doolittle's method)
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 1; i < j; ++i) {
+            T sum = lu(i, j);
+            for (std::size_t k = 0; k < i; ++k) {
+                sum -= lu(i, k) * lu(k, j);
+            }
+            lu(i, j) = sum;
+        }
+
+        // find pivot
+        std::size_t pivot_row = n;
+        T max_value = traits::Constants<T>::Zero();
+        for (std::size_t i = j; i < n; ++i) {
+            T sum = lu(i, j);
+            for (std::size_t k = 0; k < j; ++k) {
+                sum -= lu(i, k) * lu(k, j);
+            }
+            lu(i, j) = sum;
+
+            sum = abs(sum) * row_normalizer[i];
+            if (sum > max_value) {
+                max_value = sum;
+                pivot_row = i;
+            }
+        }
+
+        // swap rows with pivot
+        if (pivot_row != j) {
+            if (pivot_row == n) {
+                return traits::Constants<T>::Zero();
+            }
+            lu.swap_rows(pivot_row, j);
+            swap(indices[pivot_row], indices[j]);
+            row_normalizer[pivot_row] = row_normalizer[j];
+            det_sign = -det_sign;
+        }
+
+        // divide by pivot
+        if (j != n - 1) {
+            T denom = traits::Constants<T>::One() / lu(j, j);
+            for (std::size_t i = j + 1; i < n; ++i) {
+                lu(i, j) *= denom;
+            }
+        }
+    }
+
+    return det_sign;
+}
+
+/** Solves lu * ret = r for an in-place LU decomposition obtained from lu_decompose_in_place().
+ */
+template<typename T, typename Matrix_T, typename Indices_T, typename Vector_T, typename Result_T>
+constexpr inline void lu_solve(Matrix_T const& lu, Indices_T const& indices, Vector_T const& r, Result_T& ret,
+                               std::size_t n)
+{
+    // forward substitution for Ly = r
+    for (std::size_t i = 0; i < n; ++i) {
+        T sum = r[indices[i]];
+        for (std::size_t k = 0; k < i; ++k) {
+            sum -= lu(i, k) * ret[k];
+        }
+        ret[i] = sum;
+    }
+
+    // backward substitution for Ux = y
+    for (std::size_t i = n - 1; ; --i) {
+        T sum = ret[i];
+        for (std::size_t k = i + 1; k < n; ++k) {
+            sum -= lu(i, k) * ret[k];
+        }
+        ret[i] = sum / lu(i, i);
+        if (i == 0) { break; }
+    }
+}
+}
+
 template<typename T, std::size_t N>
 struct LUDecomposition {
     Matrix<T, N, N> m;
@@ -457,25 +663,7 @@ struct LUDecomposition {
 
     [[nodiscard]] constexpr Vector<T, N> solveFor(Vector<T, N> const& r) const {
         Vector<T, N> ret(doNotInitialize);
-
-        // forward substitution for Ly = r
-        for (std::size_t i = 0; i < N; ++i) {
-            T sum = r[indices[i]];
-            for (std::size_t k = 0; k < i; ++k) {
-                sum -= m(i, k) * ret[k];
-            }
-            ret[i] = sum;
-        }
-
-        // backward substitution for Ux = y
-        for (std::size_t i = N - 1; ; --i) {
-            T sum = ret[i];
-            for (std::size_t k = i + 1; k < N; ++k) {
-                sum -= m(i, k) * ret[k];
-            }
-            ret[i] = sum / m(i, i);
-            if (i == 0) { break; }
-        }
+        matrix_detail::lu_solve<T>(m, indices, r, ret, N);
         return ret;
     }
 
@@ -490,80 +678,205 @@ struct LUDecomposition {
     }
 };
 
-template<typename T, std::size_t N>
-[[nodiscard]] constexpr inline LUDecomposition<T, N> lu_decompose(Matrix<T, N, N> const& m)
+/** Computes the LU decomposition of a square matrix.
+ * The decomposition is always stored in row-major order, as the factorization works on whole rows.
+ */
+template<typename T, std::size_t N, MatrixPolicies::Order Order_V>
+[[nodiscard]] constexpr inline LUDecomposition<T, N> lu_decompose(Matrix<T, N, N, Order_V> const& m)
 {
-    using std::abs;
-    using std::swap;
     LUDecomposition<T, N> ret;
     Vector<T, N> row_normalizer(doNotInitialize);
-    ret.det_sign = traits::Constants<T>::One();
+    ret.m = Matrix<T, N, N>(m);
+    ret.det_sign = matrix_detail::lu_decompose_in_place<T>(ret.m, ret.indices, row_normalizer, N);
+    if (ret.det_sign == traits::Constants<T>::Zero()) {
+        ret.mark_singular();
+    }
+    return ret;
+}
 
-    // take as a normalizer the max element from each row
-    for (std::size_t i = 0; i < N; ++i) {
-        T max_value = traits::Constants<T>::Zero();
-        for (std::size_t j = 0; j < N; ++j) {
-            T const v = abs(m(i, j));
-            if (v > max_value) { max_value = v; }
-        }
-        if (max_value == traits::Constants<T>::Zero()) {
-            // matrix is singular
-            ret.mark_singular();
-            return ret;
+/** Result of a singular value decomposition A = U * diag(singular_values) * transpose(V).
+ * For an MxN matrix A and K = min(M, N), U is an MxK matrix and V is an NxK matrix, both with orthonormal columns.
+ * For rank deficient matrices, the columns belonging to zero singular values are an arbitrary orthonormal
+ * completion.
+ * The singular values are non-negative and sorted in descending order.
+ */
+template<typename T, std::size_t M, std::size_t N>
+struct SingularValueDecomposition {
+    static constexpr std::size_t K = (M < N) ? M : N;
+    Matrix<T, M, K> u;
+    Vector<T, K> singular_values;
+    Matrix<T, N, K> v;
+
+    constexpr SingularValueDecomposition()
+        :u(doNotInitialize), singular_values(doNotInitialize), v(doNotInitialize)
+    {}
+
+    /** Computes the Moore-Penrose pseudo-inverse V * diag(1/singular_values) * transpose(U).
+     * Singular values less than or equal to the tolerance are treated as zero.
+     * The default tolerance is `max(M, N) * epsilon * largest singular value`.
+     */
+    [[nodiscard]] constexpr Matrix<T, N, M> getPseudoInverse(T tolerance) const {
+        Matrix<T, N, M> ret;
+        for (std::size_t k = 0; k < K; ++k) {
+            if (singular_values[k] <= tolerance) { continue; }
+            T const inv_sigma = traits::Constants<T>::One() / singular_values[k];
+            for (std::size_t i = 0; i < N; ++i) {
+                T const vik = v(i, k) * inv_sigma;
+                for (std::size_t j = 0; j < M; ++j) {
+                    ret(i, j) += vik * u(j, k);
+                }
+            }
         }
-        row_normalizer[i] =  traits::Constants<T>::One() / max_value;
-        ret.indices[i] = i;
+        return ret;
     }
 
-    // perform decomposition (doolittle's method)
-    ret.m = m;
-    for (std::size_t j = 0; j < N; ++j) {
-        for (std::size_t i = 1; i < j; ++i) {
-            T sum = ret.m(i, j);
-            for (std::size_t k = 0; k < i; ++k) {
-                sum -= ret.m(i, k) * ret.m(k, j);
+    [[nodiscard]] constexpr Matrix<T, N, M> getPseudoInverse() const {
+        T const max_dim = static_cast<T>((M < N) ? N : M);
+        return getPseudoInverse(max_dim * std::numeric_limits<T>::epsilon() * singular_values[0]);
+    }
+
+    [[nodiscard]] constexpr Matrix<T, M, N> getReconstruction() const {
+        Matrix<T, M, N> ret;
+        for (std::size_t k = 0; k < K; ++k) {
+            for (std::size_t i = 0; i < M; ++i) {
+                T const uik = u(i, k) * singular_values[k];
+                for (std::size_t j = 0; j < N; ++j) {
+                    ret(i, j) += uik * v(j, k);
+                }
             }
-            ret.m(i, j) = sum;
         }
+        return ret;
+    }
+};
 
-        // find pivot
-        std::size_t pivot_row = N;
-        T max_value = traits::Constants<T>::Zero();
-        for (std::size_t i = j; i < N; ++i) {
-            T sum = ret.m(i, j);
-            for (std::size_t k = 0; k < j; ++k) {
-                sum -= ret.m(i, k) * ret.m(k, j);
+/** Computes the singular value decomposition of an MxN matrix.
+ * This uses one-sided (Hestenes) Jacobi rotations, which orthogonalize the columns of the matrix
+ * (or of its transpose, if M < N) directly without forming transpose(A) * A, preserving accuracy
+ * for small singular values.
+ * @param[in] max_sweeps Upper limit on the number of full sweeps over all column pairs.
+ *                       Convergence is usually reached after less than 10 sweeps.
+ */
+template<std::floating_point T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+[[nodiscard]] inline SingularValueDecomposition<T, M, N> sv_decompose(Matrix<T, M, N, Order_V> const& m,
+                                                                      int max_sweeps = 64)
+{
+    using std::abs;
+    using std::sqrt;
+    using std::swap;
+    using ::GHULBUS_MATH_NAMESPACE::traits::Constants;
+    constexpr std::size_t K = SingularValueDecomposition<T, M, N>::K;
+    // we always orthogonalize the columns of an RxK matrix with R >= K
+    constexpr std::size_t R = (M < N) ? N : M;
+    Matrix<T, R, K> a(doNotInitialize);
+    if constexpr (M < N) { a = Matrix<T, R, K>(transpose(m)); } else { a = Matrix<T, R, K>(m); }
+    Matrix<T, K, K> w = identityN<T, K>();
+
+    T const eps = std::numeric_limits<T>::epsilon();
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        bool converged = true;
+        for (std::size_t p = 0; p + 1 < K; ++p) {
+            for (std::size_t q = p + 1; q < K; ++q) {
+                T alpha = Constants<T>::Zero();
+                T beta = Constants<T>::Zero();
+                T gamma = Constants<T>::Zero();
+                for (std::size_t i = 0; i < R; ++i) {
+                    alpha += a(i, p) * a(i, p);
+                    beta += a(i, q) * a(i, q);
+                    gamma += a(i, p) * a(i, q);
+                }
+                if (abs(gamma) <= eps * sqrt(alpha * beta)) { continue; }
+                converged = false;
+                // rotation angle that zeroes the (p, q) entry of transpose(a) * a
+                T const zeta = (beta - alpha) / (2 * gamma);
+                T const t = ((zeta < Constants<T>::Zero()) ? -Constants<T>::One() : Constants<T>::One()) /
+                            (abs(zeta) + sqrt(Constants<T>::One() + zeta * zeta));
+                T const c = Constants<T>::One() / sqrt(Constants<T>::One() + t * t);
+                T const s = c * t;
+                for (std::size_t i = 0; i < R; ++i) {
+                    T const ap = a(i, p);
+                    T const aq = a(i, q);
+                    a(i, p) = c * ap - s * aq;
+                    a(i, q) = s * ap + c * aq;
+                }
+                for (std::size_t i = 0; i < K; ++i) {
+                    T const wp = w(i, p);
+                    T const wq = w(i, q);
+                    w(i, p) = c * wp - s * wq;
+                    w(i, q) = s * wp + c * wq;
+                }
             }
-            ret.m(i, j) = sum;
+        }
+        if (converged) { break; }
+    }
 
-            sum = abs(sum) * row_normalizer[i];
-            if (sum > max_value) {
-                max_value = sum;
-                pivot_row = i;
+    // singular values are the norms of the orthogonalized columns
+    Vector<T, K> sigma(doNotInitialize);
+    for (std::size_t k = 0; k < K; ++k) {
+        T acc = Constants<T>::Zero();
+        for (std::size_t i = 0; i < R; ++i) {
+            acc += a(i, k) * a(i, k);
+        }
+        sigma[k] = sqrt(acc);
+        if (sigma[k] != Constants<T>::Zero()) {
+            T const inv_sigma = Constants<T>::One() / sigma[k];
+            for (std::size_t i = 0; i < R; ++i) {
+                a(i, k) *= inv_sigma;
             }
         }
+    }
 
-        // swap rows with pivot
-        if (pivot_row != j) {
-            if (pivot_row == N) {
-                ret.mark_singular();
-                return ret;
-            }
-            ret.m.swap_rows(pivot_row, j);
-            swap(ret.indices[pivot_row], ret.indices[j]);
-            row_normalizer[pivot_row] = row_normalizer[j];
-            ret.det_sign = -ret.det_sign;
+    // sort descending (selection sort; K is small)
+    for (std::size_t k = 0; k + 1 < K; ++k) {
+        std::size_t max_idx = k;
+        for (std::size_t j = k + 1; j < K; ++j) {
+            if (sigma[j] > sigma[max_idx]) { max_idx = j; }
+        }
+        if (max_idx != k) {
+            swap(sigma[k], sigma[max_idx]);
+            a.swap_columns(k, max_idx);
+            w.swap_columns(k, max_idx);
         }
+    }
 
-        // divide by pivot
-        if (j != N - 1) {
-            T denom = traits::Constants<T>::One() / ret.m(j, j);
-            for (std::size_t i = j + 1; i < N; ++i) {
-                ret.m(i, j) *= denom;
+    // columns for zero singular values are sorted to the end and completed to an orthonormal set by
+    // Gram-Schmidt, starting from the unit vector that is least aligned with the preceding columns
+    for (std::size_t k = 0; k < K; ++k) {
+        if (sigma[k] != Constants<T>::Zero()) { continue; }
+        std::array<T, R> best{};
+        T best_norm2 = -Constants<T>::One();
+        for (std::size_t j = 0; j < R; ++j) {
+            std::array<T, R> c{};
+            c[j] = Constants<T>::One();
+            // orthogonalize twice for numerical stability
+            for (int pass = 0; pass < 2; ++pass) {
+                for (std::size_t l = 0; l < k; ++l) {
+                    T d = Constants<T>::Zero();
+                    for (std::size_t i = 0; i < R; ++i) { d += a(i, l) * c[i]; }
+                    for (std::size_t i = 0; i < R; ++i) { c[i] -= d * a(i, l); }
+                }
+            }
+            T norm2 = Constants<T>::Zero();
+            for (std::size_t i = 0; i < R; ++i) { norm2 += c[i] * c[i]; }
+            if (norm2 > best_norm2) {
+                best_norm2 = norm2;
+                best = c;
             }
         }
+        T const inv_norm = Constants<T>::One() / sqrt(best_norm2);
+        for (std::size_t i = 0; i < R; ++i) {
+            a(i, k) = best[i] * inv_norm;
+        }
     }
 
+    SingularValueDecomposition<T, M, N> ret;
+    ret.singular_values = sigma;
+    if constexpr (M < N) {
+        ret.u = w;
+        ret.v = a;
+    } else {
+        ret.u = a;
+        ret.v = w;
+    }
     return ret;
 }
 }
@@ -0,0 +1,354 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MATRIX_BATCH_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MATRIX_BATCH_HPP
+
+/** @file
+ *
+ * @brief Batched operations over arrays of Matrix3 and Matrix4.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Common.hpp>
+#include <gbMath/Matrix3.hpp>
+#include <gbMath/Matrix4.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** A fixed-width pack of W values of type T, with all arithmetic applied lane-wise.
+ * BatchLanes is a regular number type, so the existing scalar kernels (like determinant() or adjugate())
+ * can be instantiated with it to evaluate W matrices at once from a structure-of-arrays layout.
+ * The lane loops have a fixed trip count and are straightforward for the compiler to vectorize.
+ */
+template<typename T, std::size_t W>
+class BatchLanes {
+public:
+    using ValueType = T;
+    using Width = std::integral_constant<std::size_t, W>;
+
+    std::array<T, W> l;
+
+    constexpr BatchLanes()
+        :l{}
+    {}
+    constexpr BatchLanes(DoNotInitialize_Tag)
+    {}
+    constexpr BatchLanes(BatchLanes const&) = default;
+    constexpr BatchLanes& operator=(BatchLanes const&) = default;
+
+    /** Broadcast a single value to all lanes.
+     */
+    constexpr BatchLanes(T v)
+    {
+        l.fill(v);
+    }
+
+    [[nodiscard]] constexpr T& operator[](std::size_t idx)
+    {
+        return l[idx];
+    }
+
+    [[nodiscard]] constexpr T const& operator[](std::size_t idx) const
+    {
+        return l[idx];
+    }
+
+    constexpr BatchLanes& operator+=(BatchLanes const& rhs)
+    {
+        for (std::size_t i = 0; i < W; ++i) { l[i] += rhs.l[i]; }
+        return *this;
+    }
+
+    constexpr BatchLanes& operator-=(BatchLanes const& rhs)
+    {
+        for (std::size_t i = 0; i < W; ++i) { l[i] -= rhs.l[i]; }
+        return *this;
+    }
+
+    constexpr BatchLanes& operator*=(BatchLanes const& rhs)
+    {
+        for (std::size_t i = 0; i < W; ++i) { l[i] *= rhs.l[i]; }
+        return *this;
+    }
+
+    constexpr BatchLanes& operator/=(BatchLanes const& rhs)
+    {
+        for (std::size_t i = 0; i < W; ++i) { l[i] /= rhs.l[i]; }
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr BatchLanes operator-(BatchLanes const& v)
+    {
+        BatchLanes ret(doNotInitialize);
+        for (std::size_t i = 0; i < W; ++i) { ret.l[i] = -v.l[i]; }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr BatchLanes operator+(BatchLanes const& lhs, BatchLanes const& rhs)
+    {
+        BatchLanes ret(doNotInitialize);
+        for (std::size_t i = 0; i < W; ++i) { ret.l[i] = lhs.l[i] + rhs.l[i]; }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr BatchLanes operator-(BatchLanes const& lhs, BatchLanes const& rhs)
+    {
+        BatchLanes ret(doNotInitialize);
+        for (std::size_t i = 0; i < W; ++i) { ret.l[i] = lhs.l[i] - rhs.l[i]; }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr BatchLanes operator*(BatchLanes const& lhs, BatchLanes const& rhs)
+    {
+        BatchLanes ret(doNotInitialize);
+        for (std::size_t i = 0; i < W; ++i) { ret.l[i] = lhs.l[i] * rhs.l[i]; }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr BatchLanes operator/(BatchLanes const& lhs, BatchLanes const& rhs)
+    {
+        BatchLanes ret(doNotInitialize);
+        for (std::size_t i = 0; i < W; ++i) { ret.l[i] = lhs.l[i] / rhs.l[i]; }
+        return ret;
+    }
+};
+
+/** Default number of lanes used by the batched functions: The number of elements of T that fit into 256 bits.
+ */
+template<typename T>
+struct DefaultBatchWidth : public std::integral_constant<std::size_t, (sizeof(T) < 32) ? (32 / sizeof(T)) : 1> {};
+
+namespace batch_detail
+{
+/** Gathers up to W matrices into structure-of-arrays layout.
+ * Unused lanes are filled with copies of the first matrix, so that they do not produce spurious
+ * floating point exceptions.
+ */
+template<std::size_t W, typename Matrix_T, typename MatrixLanes_T>
+constexpr inline void gather(Matrix_T const* matrices, std::size_t count, MatrixLanes_T& soa)
+{
+    constexpr std::size_t n_elements = sizeof(Matrix_T) / sizeof(typename Matrix_T::ValueType);
+    for (std::size_t e = 0; e < n_elements; ++e) {
+        for (std::size_t i = 0; i < W; ++i) {
+            soa[e][i] = matrices[(i < count) ? i : 0][e];
+        }
+    }
+}
+
+template<std::size_t W, typename Matrix_T, typename MatrixLanes_T>
+constexpr inline void scatter(MatrixLanes_T const& soa, std::size_t count, Matrix_T* matrices)
+{
+    constexpr std::size_t n_elements = sizeof(Matrix_T) / sizeof(typename Matrix_T::ValueType);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t e = 0; e < n_elements; ++e) {
+            matrices[i][e] = soa[e][i];
+        }
+    }
+}
+
+/** Number of blocks of W elements needed to cover n elements.
+ */
+template<std::size_t W>
+[[nodiscard]] constexpr inline std::size_t block_count(std::size_t n)
+{
+    return (n + W - 1) / W;
+}
+
+template<typename T, std::size_t W, template<typename> class Matrix_T, typename Kernel_T, typename ParallelFor_T>
+inline void transform_batched(std::span<Matrix_T<T> const> in, std::span<Matrix_T<T>> out, Kernel_T const& kernel,
+                              ParallelFor_T&& parallel_for)
+{
+    assert(out.size() >= in.size());
+    std::size_t const n = in.size();
+    parallel_for(block_count<W>(n), [n, in, out, &kernel](std::size_t block) {
+            std::size_t const base = block * W;
+            std::size_t const count = std::min(W, n - base);
+            Matrix_T<BatchLanes<T, W>> soa(doNotInitialize);
+            gather<W>(in.data() + base, count, soa);
+            soa = kernel(soa);
+            scatter<W>(soa, count, out.data() + base);
+        });
+}
+
+template<typename T, std::size_t W, template<typename> class Matrix_T, typename Kernel_T, typename ParallelFor_T>
+inline void transform_batched(std::span<Matrix_T<T> const> lhs, std::span<Matrix_T<T> const> rhs,
+                              std::span<Matrix_T<T>> out, Kernel_T const& kernel, ParallelFor_T&& parallel_for)
+{
+    assert(rhs.size() >= lhs.size());
+    assert(out.size() >= lhs.size());
+    std::size_t const n = lhs.size();
+    parallel_for(block_count<W>(n), [n, lhs, rhs, out, &kernel](std::size_t block) {
+            std::size_t const base = block * W;
+            std::size_t const count = std::min(W, n - base);
+            Matrix_T<BatchLanes<T, W>> soa_lhs(doNotInitialize);
+            Matrix_T<BatchLanes<T, W>> soa_rhs(doNotInitialize);
+            gather<W>(lhs.data() + base, count, soa_lhs);
+            gather<W>(rhs.data() + base, count, soa_rhs);
+            soa_lhs = kernel(soa_lhs, soa_rhs);
+            scatter<W>(soa_lhs, count, out.data() + base);
+        });
+}
+
+template<typename T, std::size_t W, template<typename> class Matrix_T, typename ParallelFor_T>
+inline void determinant_batched(std::span<Matrix_T<T> const> in, std::span<T> out, ParallelFor_T&& parallel_for)
+{
+    assert(out.size() >= in.size());
+    std::size_t const n = in.size();
+    parallel_for(block_count<W>(n), [n, in, out](std::size_t block) {
+            std::size_t const base = block * W;
+            std::size_t const count = std::min(W, n - base);
+            Matrix_T<BatchLanes<T, W>> soa(doNotInitialize);
+            gather<W>(in.data() + base, count, soa);
+            BatchLanes<T, W> const det = determinant(soa);
+            std::copy(det.l.begin(), det.l.begin() + count, out.begin() + base);
+        });
+}
+}
+
+/** @name Batched matrix operations.
+ * Each of these functions processes a span of matrices in blocks of W, by transposing each block into
+ * structure-of-arrays layout and evaluating the respective scalar function with BatchLanes.
+ * The results are computed with the same expressions as the respective scalar functions.
+ * When a span is processed in parts, the part boundaries should be a multiple of W for best throughput.
+ * The output span must be at least as large as the input span. Input and output may alias.
+ *
+ * The overloads taking a parallel_for distribute the blocks with it, each call f(i) processing the i-th block
+ * of W matrices. The library does not spawn threads itself; parallel_for(count, f) is expected to invoke f(i)
+ * for all i in [0, count), and may do so concurrently, e.g. by handing the calls to a thread pool.
+ */
+///@{
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void determinant(std::span<Matrix3<T> const> matrices, std::span<T> determinants,
+                        ParallelFor_T&& parallel_for)
+{
+    batch_detail::determinant_batched<T, W, Matrix3>(matrices, determinants, parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void determinant(std::span<Matrix3<T> const> matrices, std::span<T> determinants)
+{
+    determinant<T, W>(matrices, determinants, SequentialFor{});
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void determinant(std::span<Matrix4<T> const> matrices, std::span<T> determinants,
+                        ParallelFor_T&& parallel_for)
+{
+    batch_detail::determinant_batched<T, W, Matrix4>(matrices, determinants, parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void determinant(std::span<Matrix4<T> const> matrices, std::span<T> determinants)
+{
+    determinant<T, W>(matrices, determinants, SequentialFor{});
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void adjugate(std::span<Matrix3<T> const> matrices, std::span<Matrix3<T>> adjugates,
+                     ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(matrices, adjugates,
+        [](Matrix3<BatchLanes<T, W>> const& m) { return adjugate(m); }, parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void adjugate(std::span<Matrix3<T> const> matrices, std::span<Matrix3<T>> adjugates)
+{
+    adjugate<T, W>(matrices, adjugates, SequentialFor{});
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void adjugate(std::span<Matrix4<T> const> matrices, std::span<Matrix4<T>> adjugates,
+                     ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(matrices, adjugates,
+        [](Matrix4<BatchLanes<T, W>> const& m) { return adjugate(m); }, parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void adjugate(std::span<Matrix4<T> const> matrices, std::span<Matrix4<T>> adjugates)
+{
+    adjugate<T, W>(matrices, adjugates, SequentialFor{});
+}
+
+template<std::floating_point T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void inverse(std::span<Matrix3<T> const> matrices, std::span<Matrix3<T>> inverses,
+                    ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(matrices, inverses,
+        [](Matrix3<BatchLanes<T, W>> const& m) {
+            ScaledMatrix3<BatchLanes<T, W>> const inv = inverse_scaled(m);
+            return inv.m * (BatchLanes<T, W>(traits::Constants<T>::One()) / inv.inverse_scale_factor);
+        }, parallel_for);
+}
+
+template<std::floating_point T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void inverse(std::span<Matrix3<T> const> matrices, std::span<Matrix3<T>> inverses)
+{
+    inverse<T, W>(matrices, inverses, SequentialFor{});
+}
+
+template<std::floating_point T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void inverse(std::span<Matrix4<T> const> matrices, std::span<Matrix4<T>> inverses,
+                    ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(matrices, inverses,
+        [](Matrix4<BatchLanes<T, W>> const& m) {
+            ScaledMatrix4<BatchLanes<T, W>> const inv = inverse_scaled(m);
+            return inv.m * (BatchLanes<T, W>(traits::Constants<T>::One()) / inv.inverse_scale_factor);
+        }, parallel_for);
+}
+
+template<std::floating_point T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void inverse(std::span<Matrix4<T> const> matrices, std::span<Matrix4<T>> inverses)
+{
+    inverse<T, W>(matrices, inverses, SequentialFor{});
+}
+
+/** Computes products[i] = lhs[i] * rhs[i].
+ */
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void multiply(std::span<Matrix3<T> const> lhs, std::span<Matrix3<T> const> rhs,
+                     std::span<Matrix3<T>> products, ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(lhs, rhs, products,
+        [](Matrix3<BatchLanes<T, W>> const& l, Matrix3<BatchLanes<T, W>> const& r) { return l * r; },
+        parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void multiply(std::span<Matrix3<T> const> lhs, std::span<Matrix3<T> const> rhs,
+                     std::span<Matrix3<T>> products)
+{
+    multiply<T, W>(lhs, rhs, products, SequentialFor{});
+}
+
+/** Computes products[i] = lhs[i] * rhs[i].
+ */
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value, typename ParallelFor_T>
+inline void multiply(std::span<Matrix4<T> const> lhs, std::span<Matrix4<T> const> rhs,
+                     std::span<Matrix4<T>> products, ParallelFor_T&& parallel_for)
+{
+    batch_detail::transform_batched<T, W>(lhs, rhs, products,
+        [](Matrix4<BatchLanes<T, W>> const& l, Matrix4<BatchLanes<T, W>> const& r) { return l * r; },
+        parallel_for);
+}
+
+template<typename T, std::size_t W = DefaultBatchWidth<T>::value>
+inline void multiply(std::span<Matrix4<T> const> lhs, std::span<Matrix4<T> const> rhs,
+                     std::span<Matrix4<T>> products)
+{
+    multiply<T, W>(lhs, rhs, products, SequentialFor{});
+}
+///@}
+}
+#endif
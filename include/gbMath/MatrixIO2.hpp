@@ -8,35 +8,35 @@
  */
 
 #include <gbMath/config.hpp>
+#include <gbMath/FormatIO.hpp>
 #include <gbMath/Matrix2.hpp>
 
 #include <ostream>
 #include <version>
 
 #ifdef __cpp_lib_format
+#include <array>
 #include <format>
 
 template<class T, class Char_T>
 struct std::formatter<GHULBUS_MATH_NAMESPACE::Matrix2<T>, Char_T>
+    : public GHULBUS_MATH_NAMESPACE::format_detail::ElementFormatter<T, Char_T>
 {
-    constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
-    }
-
     template<class FormatContext>
     auto format(GHULBUS_MATH_NAMESPACE::Matrix2<T> const& m, FormatContext& ctx) const
     {
-        return std::format_to(ctx.out(), "[ [{} {}] [{} {}] ]", m.m11, m.m12, m.m21, m.m22);
+        this->write_rows(std::array<T, 4>{ m.m11, m.m12, m.m21, m.m22 }, 2, ctx);
+        return ctx.out();
     }
 };
 
 namespace GHULBUS_MATH_NAMESPACE
 {
-    template<typename T>
-    std::ostream& operator<<(std::ostream& os, Matrix2<T> const& rhs)
-    {
-        return os << std::format("{}", rhs);
-    }
+template<typename T>
+inline std::ostream& operator<<(std::ostream& os, Matrix2<T> const& rhs)
+{
+    return format_detail::insert_formatted(os, rhs);
+}
 }
 
 #else
@@ -8,51 +8,49 @@
  */
 
 #include <gbMath/config.hpp>
+#include <gbMath/FormatIO.hpp>
 #include <gbMath/Matrix.hpp>
 
 #include <ostream>
 #include <version>
 
 #ifdef __cpp_lib_format
+#include <array>
 #include <format>
 
-template<class T, std::size_t M, std::size_t N, class Char_T>
-struct std::formatter<GHULBUS_MATH_NAMESPACE::Matrix<T, M, N>, Char_T>
+template<class T, std::size_t M, std::size_t N, GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order Order_V, class Char_T>
+struct std::formatter<GHULBUS_MATH_NAMESPACE::Matrix<T, M, N, Order_V>, Char_T>
+    : public GHULBUS_MATH_NAMESPACE::format_detail::ElementFormatter<T, Char_T>
 {
-    constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
-    }
-
     template<class FormatContext>
-    auto format(GHULBUS_MATH_NAMESPACE::Matrix<T, M, N> const& m, FormatContext& ctx) const
+    auto format(GHULBUS_MATH_NAMESPACE::Matrix<T, M, N, Order_V> const& m, FormatContext& ctx) const
     {
-        std::format_to(ctx.out(), "[");
+        std::array<T, M * N> elements;
         for (std::size_t i = 0; i < M; ++i) {
-            std::format_to(ctx.out(), " [{}", m(i, 0));
-            for (std::size_t j = 1; j < N; ++j) {
-                std::format_to(ctx.out(), " {}", m(i, j));
+            for (std::size_t j = 0; j < N; ++j) {
+                elements[i * N + j] = m(i, j);
             }
-            std::format_to(ctx.out(), "]");
         }
-        return std::format_to(ctx.out(), " ]");
+        this->write_rows(elements, N, ctx);
+        return ctx.out();
     }
 };
 
 namespace GHULBUS_MATH_NAMESPACE
 {
-    template<typename T, std::size_t M, std::size_t N>
-    std::ostream& operator<<(std::ostream& os, Matrix<T, M, N> const& rhs)
-    {
-        return os << std::format("{}", rhs);
-    }
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+inline std::ostream& operator<<(std::ostream& os, Matrix<T, M, N, Order_V> const& rhs)
+{
+    return format_detail::insert_formatted(os, rhs);
+}
 }
 
 #else
 
 namespace GHULBUS_MATH_NAMESPACE
 {
-template<typename T, std::size_t M, std::size_t N>
-std::ostream& operator<<(std::ostream& os, Matrix<T, M, N> const& rhs)
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+std::ostream& operator<<(std::ostream& os, Matrix<T, M, N, Order_V> const& rhs)
 {
     os << "[";
     for (std::size_t i = 0; i < M; ++i) {
@@ -0,0 +1,312 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MATRIX_VIEW_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_MATRIX_VIEW_HPP
+
+/** @file
+ *
+ * @brief Non-owning view of an MxN Matrix.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Common.hpp>
+#include <gbMath/Matrix.hpp>
+#include <gbMath/MatrixPolicies.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector.hpp>
+#include <gbMath/VectorView.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning view of MxN elements in external memory.
+ * The element at row r and column c is located at `data[r * row_stride + c * column_stride]`, which allows
+ * viewing both row-major and column-major buffers, as well as sub-matrices of larger matrices.
+ * Like std::span, the view does not propagate constness. Use a const element type T for read-only views.
+ * Copying a view copies the reference, not the elements. Use assign() to write through the view.
+ * Operations that produce new values return an owning Matrix.
+ */
+template<typename T, std::size_t M, std::size_t N>
+class MatrixView {
+public:
+    using ValueType = std::remove_cv_t<T>;
+    using ElementType = T;
+    static_assert(M > 0, "Matrix must have at least one row.");
+    static_assert(N > 0, "Matrix must have at least one column.");
+    using Rows = std::integral_constant<std::size_t, M>;
+    using Columns = std::integral_constant<std::size_t, N>;
+
+    T* data;
+    std::ptrdiff_t row_stride;
+    std::ptrdiff_t column_stride;
+
+    constexpr MatrixView(T* n_data, std::ptrdiff_t n_row_stride, std::ptrdiff_t n_column_stride)
+        :data(n_data), row_stride(n_row_stride), column_stride(n_column_stride)
+    {}
+
+    constexpr MatrixView(T* n_data, MatrixPolicies::InputOrder_RowMajor)
+        :MatrixView(n_data, N, 1)
+    {}
+
+    constexpr MatrixView(T* n_data, MatrixPolicies::InputOrder_ColumnMajor)
+        :MatrixView(n_data, 1, M)
+    {}
+
+    template<MatrixPolicies::Order Order_V>
+    constexpr MatrixView(Matrix<ValueType, M, N, Order_V>& mat)
+        :MatrixView(mat.m.data(), MatrixPolicies::InputOrder_T<Order_V>{})
+    {}
+
+    template<MatrixPolicies::Order Order_V>
+    constexpr MatrixView(Matrix<ValueType, M, N, Order_V> const& mat) requires(std::is_const_v<T>)
+        :MatrixView(mat.m.data(), MatrixPolicies::InputOrder_T<Order_V>{})
+    {}
+
+    template<typename U>
+    constexpr MatrixView(MatrixView<U, M, N> const& other) requires(std::is_convertible_v<U*, T*>)
+        :data(other.data), row_stride(other.row_stride), column_stride(other.column_stride)
+    {}
+
+    constexpr MatrixView(MatrixView const&) = default;
+    constexpr MatrixView& operator=(MatrixView const&) = default;
+
+    [[nodiscard]] constexpr std::pair<std::size_t, std::size_t> dimension() const
+    {
+        return std::make_pair(M, N);
+    }
+
+    [[nodiscard]] constexpr bool is_square() const
+    {
+        return M == N;
+    }
+
+    [[nodiscard]] constexpr T& operator()(std::size_t r, std::size_t c) const
+    {
+        return data[static_cast<std::ptrdiff_t>(r) * row_stride + static_cast<std::ptrdiff_t>(c) * column_stride];
+    }
+
+    [[nodiscard]] constexpr VectorView<T, N> row(std::size_t idx) const
+    {
+        return VectorView<T, N>(data + static_cast<std::ptrdiff_t>(idx) * row_stride, column_stride);
+    }
+
+    [[nodiscard]] constexpr VectorView<T, M> column(std::size_t idx) const
+    {
+        return VectorView<T, M>(data + static_cast<std::ptrdiff_t>(idx) * column_stride, row_stride);
+    }
+
+    /** Copies the viewed elements into an owning Matrix.
+     */
+    [[nodiscard]] constexpr Matrix<ValueType, M, N> to_matrix() const
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = (*this)(i, j);
+            }
+        }
+        return ret;
+    }
+
+    /** Overwrites the viewed elements with the elements of rhs.
+     */
+    constexpr MatrixView const& assign(MatrixView<ValueType const, M, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) = rhs(i, j);
+            }
+        }
+        return *this;
+    }
+
+    constexpr MatrixView const& operator+=(MatrixView<ValueType const, M, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) += rhs(i, j);
+            }
+        }
+        return *this;
+    }
+
+    constexpr MatrixView const& operator-=(MatrixView<ValueType const, M, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) -= rhs(i, j);
+            }
+        }
+        return *this;
+    }
+
+    constexpr MatrixView const& operator*=(ValueType f) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) *= f;
+            }
+        }
+        return *this;
+    }
+
+    constexpr MatrixView const& operator/=(ValueType f) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                (*this)(i, j) /= f;
+            }
+        }
+        return *this;
+    }
+
+    /** Element-wise comparison of the viewed values.
+     */
+    [[nodiscard]] friend constexpr bool operator==(MatrixView const& lhs, MatrixView const& rhs)
+    {
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                if (!(lhs(i, j) == rhs(i, j))) { return false; }
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] friend constexpr Matrix<ValueType, M, N> operator+(MatrixView const& lhs, MatrixView const& rhs)
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = lhs(i, j) + rhs(i, j);
+            }
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Matrix<ValueType, M, N> operator-(MatrixView const& lhs, MatrixView const& rhs)
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = lhs(i, j) - rhs(i, j);
+            }
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Matrix<ValueType, M, N> operator*(MatrixView const& lhs, ValueType f)
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = lhs(i, j) * f;
+            }
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Matrix<ValueType, M, N> operator*(ValueType f, MatrixView const& rhs)
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = f * rhs(i, j);
+            }
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Matrix<ValueType, M, N> operator/(MatrixView const& lhs, ValueType f)
+    {
+        Matrix<ValueType, M, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            for (std::size_t j = 0; j < N; ++j) {
+                ret(i, j) = lhs(i, j) / f;
+            }
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, M> operator*(MatrixView const& m,
+                                                                  VectorView<ValueType const, N> const& v)
+    {
+        Vector<ValueType, M> ret(doNotInitialize);
+        for (std::size_t i = 0; i < M; ++i) {
+            ValueType acc = traits::Constants<ValueType>::Zero();
+            for (std::size_t k = 0; k < N; ++k) {
+                acc += m(i, k) * v[k];
+            }
+            ret[i] = acc;
+        }
+        return ret;
+    }
+};
+
+template<typename T, typename U, std::size_t M, std::size_t N, std::size_t Q>
+[[nodiscard]] constexpr inline Matrix<std::remove_cv_t<T>, M, Q> operator*(MatrixView<T, M, N> const& lhs,
+                                                                           MatrixView<U, N, Q> const& rhs)
+    requires(std::same_as<std::remove_cv_t<T>, std::remove_cv_t<U>>)
+{
+    using ValueType = std::remove_cv_t<T>;
+    Matrix<ValueType, M, Q> ret(doNotInitialize);
+    for (std::size_t i = 0; i < M; ++i) {
+        for (std::size_t j = 0; j < Q; ++j) {
+            ValueType acc = traits::Constants<ValueType>::Zero();
+            for (std::size_t k = 0; k < N; ++k) {
+                acc += lhs(i, k) * rhs(k, j);
+            }
+            ret(i, j) = acc;
+        }
+    }
+    return ret;
+}
+
+/** Deduction guides for views of Matrix.
+ */
+///@{
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+MatrixView(Matrix<T, M, N, Order_V>&) -> MatrixView<T, M, N>;
+
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+MatrixView(Matrix<T, M, N, Order_V> const&) -> MatrixView<T const, M, N>;
+///@}
+
+/** Transposes a view by swapping its strides.
+ * Unlike transpose() for Matrix, this does not copy any elements. The returned view refers to the same memory.
+ */
+template<typename T, std::size_t M, std::size_t N>
+[[nodiscard]] constexpr inline MatrixView<T, N, M> transpose(MatrixView<T, M, N> const& m)
+{
+    return MatrixView<T, N, M>(m.data, m.column_stride, m.row_stride);
+}
+
+template<typename T, std::size_t N>
+[[nodiscard]] constexpr inline std::remove_cv_t<T> trace(MatrixView<T, N, N> const& m)
+{
+    std::remove_cv_t<T> ret = traits::Constants<std::remove_cv_t<T>>::Zero();
+    for (std::size_t i = 0; i < N; ++i) {
+        ret += m(i, i);
+    }
+    return ret;
+}
+
+/** Computes the LU decomposition of the viewed matrix.
+ * The decomposition owns its storage, so this copies the viewed elements once.
+ */
+template<typename T, std::size_t N>
+[[nodiscard]] constexpr inline LUDecomposition<std::remove_cv_t<T>, N> lu_decompose(MatrixView<T, N, N> const& m)
+{
+    return lu_decompose(m.to_matrix());
+}
+}
+
+#endif
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <concepts>
+#include <cstddef>
 #include <limits>
 #include <type_traits>
 
@@ -40,6 +42,51 @@ public:
     {}
 };
 
+/** Returns the point inside the box that is closest to p.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> closest_point(OBB3<T> const& o, Point3<T> const& p)
+{
+    // p relative to the box center, expressed in the box's coordinate frame
+    Vector3<T> const d = o.orientation * Vector3<T>(p - o.center);
+    Point3<T> ret = o.center;
+    for(std::size_t i = 0; i < 3; ++i) {
+        ret += o.orientation.row(i) * std::clamp(d[i], -o.halfwidth[i], o.halfwidth[i]);
+    }
+    return ret;
+}
+
+/** Squared distance from a point to the box; 0 for points inside the box.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline T distance_squared(OBB3<T> const& o, Point3<T> const& p)
+{
+    Vector3<T> const d = o.orientation * Vector3<T>(p - o.center);
+    T ret = traits::Constants<T>::Zero();
+    for(std::size_t i = 0; i < 3; ++i) {
+        T const excess = std::max(std::abs(d[i]) - o.halfwidth[i], traits::Constants<T>::Zero());
+        ret += excess * excess;
+    }
+    return ret;
+}
+
+/** Signed distance from a point to the surface of the box.
+ * Positive outside the box, negative inside.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T signed_distance(OBB3<T> const& o, Point3<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    Vector3<T> const d = o.orientation * Vector3<T>(p - o.center);
+    T const qx = std::abs(d.x) - o.halfwidth.x;
+    T const qy = std::abs(d.y) - o.halfwidth.y;
+    T const qz = std::abs(d.z) - o.halfwidth.z;
+    T const ox = std::max(qx, zero);
+    T const oy = std::max(qy, zero);
+    T const oz = std::max(qz, zero);
+    return std::sqrt(ox*ox + oy*oy + oz*oz) + std::min(std::max({ qx, qy, qz }), zero);
+}
+
 template<typename T>
 [[nodiscard]] constexpr inline bool intersects(OBB3<T> const& o1, OBB3<T> const& o2, T epsilon = traits::Constants<T>::Zero())
 {
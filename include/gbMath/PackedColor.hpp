@@ -0,0 +1,252 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PACKED_COLOR_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PACKED_COLOR_HPP
+
+/** @file
+ *
+ * @brief Packed color formats and conversions from and to Color4.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Color4.hpp>
+#include <gbMath/Half.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Four 8 bit unsigned normalized channels, stored in the order r, g, b, a.
+ */
+struct ColorRGBA8 {
+    std::uint8_t r;
+    std::uint8_t g;
+    std::uint8_t b;
+    std::uint8_t a;
+
+    [[nodiscard]] friend constexpr bool operator==(ColorRGBA8 const&, ColorRGBA8 const&) = default;
+};
+
+/** Three 10 bit and one 2 bit unsigned normalized channels packed into 32 bits.
+ * Red occupies the least significant bits 0-9, followed by green in 10-19, blue in 20-29 and alpha in 30-31.
+ */
+struct ColorRGB10A2 {
+    std::uint32_t bits;
+
+    [[nodiscard]] constexpr std::uint32_t red() const { return bits & 0x3ffu; }
+    [[nodiscard]] constexpr std::uint32_t green() const { return (bits >> 10) & 0x3ffu; }
+    [[nodiscard]] constexpr std::uint32_t blue() const { return (bits >> 20) & 0x3ffu; }
+    [[nodiscard]] constexpr std::uint32_t alpha() const { return bits >> 30; }
+
+    [[nodiscard]] friend constexpr bool operator==(ColorRGB10A2 const&, ColorRGB10A2 const&) = default;
+};
+
+/** Four IEEE 754 binary16 channels, stored as their bit patterns in the order r, g, b, a.
+ */
+struct ColorRGBA16F {
+    std::uint16_t r;
+    std::uint16_t g;
+    std::uint16_t b;
+    std::uint16_t a;
+
+    [[nodiscard]] friend constexpr bool operator==(ColorRGBA16F const&, ColorRGBA16F const&) = default;
+};
+
+namespace packed_color_detail
+{
+/** Converts to an unsigned normalized integer with Max_V as the largest value.
+ * Values are saturated to [0, 1] and rounded to nearest; NaN converts to 0.
+ */
+template<std::uint32_t Max_V, std::floating_point T>
+[[nodiscard]] constexpr inline std::uint32_t to_unorm(T v)
+{
+    T const one = traits::Constants<T>::One();
+    T const saturated = (v > traits::Constants<T>::Zero()) ? ((v < one) ? v : one) : traits::Constants<T>::Zero();
+    return static_cast<std::uint32_t>(saturated * static_cast<T>(Max_V) + static_cast<T>(0.5));
+}
+
+template<std::uint32_t Max_V, std::floating_point T>
+[[nodiscard]] constexpr inline T from_unorm(std::uint32_t v)
+{
+    return static_cast<T>(v) / static_cast<T>(Max_V);
+}
+}
+
+/** @name Conversion to packed formats.
+ * Conversions to unsigned normalized formats saturate to [0, 1] and round to nearest; NaN converts to 0.
+ * Conversions to binary16 round to nearest even; values too large become infinity.
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline ColorRGBA8 pack_rgba8(Color4<T> const& c)
+{
+    using packed_color_detail::to_unorm;
+    return ColorRGBA8{ static_cast<std::uint8_t>(to_unorm<255>(c.r)), static_cast<std::uint8_t>(to_unorm<255>(c.g)),
+                       static_cast<std::uint8_t>(to_unorm<255>(c.b)), static_cast<std::uint8_t>(to_unorm<255>(c.a)) };
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline ColorRGB10A2 pack_rgb10a2(Color4<T> const& c)
+{
+    using packed_color_detail::to_unorm;
+    return ColorRGB10A2{ to_unorm<1023>(c.r) | (to_unorm<1023>(c.g) << 10) |
+                         (to_unorm<1023>(c.b) << 20) | (to_unorm<3>(c.a) << 30) };
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline ColorRGBA16F pack_rgba16f(Color4<T> const& c)
+{
+    using half_detail::float_to_half_bits;
+    return ColorRGBA16F{ float_to_half_bits(static_cast<float>(c.r)), float_to_half_bits(static_cast<float>(c.g)),
+                         float_to_half_bits(static_cast<float>(c.b)), float_to_half_bits(static_cast<float>(c.a)) };
+}
+///@}
+
+/** @name Conversion from packed formats.
+ */
+///@{
+template<std::floating_point T = float>
+[[nodiscard]] constexpr inline Color4<T> unpack(ColorRGBA8 const& c)
+{
+    using packed_color_detail::from_unorm;
+    return Color4<T>(from_unorm<255, T>(c.r), from_unorm<255, T>(c.g), from_unorm<255, T>(c.b), from_unorm<255, T>(c.a));
+}
+
+template<std::floating_point T = float>
+[[nodiscard]] constexpr inline Color4<T> unpack(ColorRGB10A2 const& c)
+{
+    using packed_color_detail::from_unorm;
+    return Color4<T>(from_unorm<1023, T>(c.red()), from_unorm<1023, T>(c.green()),
+                     from_unorm<1023, T>(c.blue()), from_unorm<3, T>(c.alpha()));
+}
+
+template<std::floating_point T = float>
+[[nodiscard]] constexpr inline Color4<T> unpack(ColorRGBA16F const& c)
+{
+    using half_detail::half_bits_to_float;
+    return Color4<T>(static_cast<T>(half_bits_to_float(c.r)), static_cast<T>(half_bits_to_float(c.g)),
+                     static_cast<T>(half_bits_to_float(c.b)), static_cast<T>(half_bits_to_float(c.a)));
+}
+///@}
+
+/** @name Premultiplied alpha.
+ * premultiplied() converts a color with straight alpha to premultiplied alpha by scaling the color channels
+ * with alpha. unpremultiplied() reverses this; fully transparent colors convert to (0, 0, 0, 0).
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> premultiplied(Color4<T> const& c)
+{
+    return Color4<T>(c.r * c.a, c.g * c.a, c.b * c.a, c.a);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Color4<T> unpremultiplied(Color4<T> const& c)
+{
+    T const inverse_alpha = (c.a > traits::Constants<T>::Zero()) ? (traits::Constants<T>::One() / c.a) :
+                                                                    traits::Constants<T>::Zero();
+    return Color4<T>(c.r * inverse_alpha, c.g * inverse_alpha, c.b * inverse_alpha, c.a);
+}
+///@}
+
+/** @name Bulk conversion.
+ * Apply the single color conversions to each element of a span.
+ * Each element is converted independently without function calls, which allows the compiler to vectorize
+ * the loops.
+ * The output span must be at least as large as the input span.
+ */
+///@{
+template<std::floating_point T>
+inline void pack(std::span<Color4<T> const> colors, std::span<ColorRGBA8> packed)
+{
+    assert(packed.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { packed[i] = pack_rgba8(colors[i]); }
+}
+
+template<std::floating_point T>
+inline void pack(std::span<Color4<T> const> colors, std::span<ColorRGB10A2> packed)
+{
+    assert(packed.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { packed[i] = pack_rgb10a2(colors[i]); }
+}
+
+template<std::floating_point T>
+inline void pack(std::span<Color4<T> const> colors, std::span<ColorRGBA16F> packed)
+{
+    assert(packed.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { packed[i] = pack_rgba16f(colors[i]); }
+}
+
+template<std::floating_point T>
+inline void unpack(std::span<ColorRGBA8 const> packed, std::span<Color4<T>> colors)
+{
+    assert(colors.size() >= packed.size());
+    for (std::size_t i = 0; i < packed.size(); ++i) { colors[i] = unpack<T>(packed[i]); }
+}
+
+template<std::floating_point T>
+inline void unpack(std::span<ColorRGB10A2 const> packed, std::span<Color4<T>> colors)
+{
+    assert(colors.size() >= packed.size());
+    for (std::size_t i = 0; i < packed.size(); ++i) { colors[i] = unpack<T>(packed[i]); }
+}
+
+template<std::floating_point T>
+inline void unpack(std::span<ColorRGBA16F const> packed, std::span<Color4<T>> colors)
+{
+    assert(colors.size() >= packed.size());
+    for (std::size_t i = 0; i < packed.size(); ++i) { colors[i] = unpack<T>(packed[i]); }
+}
+
+/** Converts colors with straight alpha to a packed format with premultiplied alpha in a single pass.
+ */
+template<std::floating_point T>
+inline void pack_premultiplied(std::span<Color4<T> const> colors, std::span<ColorRGBA8> packed)
+{
+    assert(packed.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { packed[i] = pack_rgba8(premultiplied(colors[i])); }
+}
+
+template<std::floating_point T>
+inline void pack_premultiplied(std::span<Color4<T> const> colors, std::span<ColorRGBA16F> packed)
+{
+    assert(packed.size() >= colors.size());
+    for (std::size_t i = 0; i < colors.size(); ++i) { packed[i] = pack_rgba16f(premultiplied(colors[i])); }
+}
+
+/** Converts a packed format with premultiplied alpha to colors with straight alpha in a single pass.
+ */
+template<std::floating_point T>
+inline void unpack_unpremultiplied(std::span<ColorRGBA8 const> packed, std::span<Color4<T>> colors)
+{
+    assert(colors.size() >= packed.size());
+    for (std::size_t i = 0; i < packed.size(); ++i) { colors[i] = unpremultiplied(unpack<T>(packed[i])); }
+}
+
+template<std::floating_point T>
+inline void unpack_unpremultiplied(std::span<ColorRGBA16F const> packed, std::span<Color4<T>> colors)
+{
+    assert(colors.size() >= packed.size());
+    for (std::size_t i = 0; i < packed.size(); ++i) { colors[i] = unpremultiplied(unpack<T>(packed[i])); }
+}
+
+template<std::floating_point T>
+inline void premultiply(std::span<Color4<T>> colors)
+{
+    for (auto& c : colors) { c = premultiplied(c); }
+}
+
+template<std::floating_point T>
+inline void unpremultiply(std::span<Color4<T>> colors)
+{
+    for (auto& c : colors) { c = unpremultiplied(c); }
+}
+///@}
+}
+
+#endif
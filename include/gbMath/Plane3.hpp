@@ -0,0 +1,94 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PLANE3_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PLANE3_HPP
+
+/** @file
+*
+* @brief 3D Plane.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Common.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <cmath>
+#include <concepts>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** A plane consisting of all points x with dot(n, x) == d.
+ * The normal n is not required to be of unit length, but the distance functions are cheaper if it is.
+ * The half-space into which n points is the positive side of the plane.
+ */
+template<typename T>
+class Plane3 {
+public:
+    Vector3<T> n;
+    T d;
+public:
+    constexpr Plane3()
+        :n{}, d{}
+    {}
+    constexpr explicit Plane3(DoNotInitialize_Tag)
+        :n(doNotInitialize)
+    {}
+    constexpr Plane3(Plane3 const&) = default;
+    constexpr Plane3& operator=(Plane3 const&) = default;
+
+    constexpr Plane3(Vector3<T> const& n_normal, T n_d)
+        :n(n_normal), d(n_d)
+    {}
+
+    /** Constructs the plane with normal n_normal passing through p.
+     */
+    constexpr Plane3(Vector3<T> const& n_normal, Point3<T> const& p)
+        :n(n_normal), d(dot(n_normal, p - Point3<T>()))
+    {}
+
+    /** Constructs the plane through three points.
+     * The normal is cross(b - a, c - a), so that the positive side is the one from which a, b, c appear
+     * in counter-clockwise order.
+     */
+    constexpr Plane3(Point3<T> const& a, Point3<T> const& b, Point3<T> const& c)
+        :Plane3(cross(b - a, c - a), a)
+    {}
+
+    [[nodiscard]] friend constexpr bool operator==(Plane3 const& lhs, Plane3 const& rhs) = default;
+};
+
+/** Rescales the plane equation so that the normal has unit length.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline Plane3<T> normalized(Plane3<T> const& p)
+{
+    T const len = length(p.n);
+    return Plane3<T>(p.n / len, p.d / len);
+}
+
+/** Signed distance of a point from the plane; positive on the side that the normal points to.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T signed_distance(Plane3<T> const& pl, Point3<T> const& p)
+{
+    return (dot(pl.n, p - Point3<T>()) - pl.d) / length(pl.n);
+}
+
+/** Signed distance of a point from a plane with a normal of unit length.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline T signed_distance_unit(Plane3<T> const& pl, Point3<T> const& p)
+{
+    return dot(pl.n, p - Point3<T>()) - pl.d;
+}
+
+/** Projects a point onto the plane.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> closest_point(Plane3<T> const& pl, Point3<T> const& p)
+{
+    return p - pl.n * ((dot(pl.n, p - Point3<T>()) - pl.d) / dot(pl.n, pl.n));
+}
+}
+#endif
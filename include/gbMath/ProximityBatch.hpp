@@ -0,0 +1,170 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PROXIMITY_BATCH_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_PROXIMITY_BATCH_HPP
+
+/** @file
+ *
+ * @brief Batched distance queries.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Line3.hpp>
+#include <gbMath/OBB3.hpp>
+#include <gbMath/Sphere3.hpp>
+#include <gbMath/Sphere3Batch.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning structure-of-arrays view of a set of points.
+ * All spans must have the same size.
+ */
+template<typename T>
+struct Point3SoA {
+    std::span<T const> x;
+    std::span<T const> y;
+    std::span<T const> z;
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        assert((y.size() == x.size()) && (z.size() == x.size()));
+        return x.size();
+    }
+
+    [[nodiscard]] constexpr Point3<T> operator[](std::size_t idx) const
+    {
+        return Point3<T>(x[idx], y[idx], z[idx]);
+    }
+};
+
+/** Non-owning structure-of-arrays view of a set of axis-aligned boxes.
+ * All spans must have the same size.
+ */
+template<typename T>
+struct AABB3SoA {
+    std::span<T const> min_x;
+    std::span<T const> min_y;
+    std::span<T const> min_z;
+    std::span<T const> max_x;
+    std::span<T const> max_y;
+    std::span<T const> max_z;
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        assert((min_y.size() == min_x.size()) && (min_z.size() == min_x.size()) && (max_x.size() == min_x.size()) &&
+               (max_y.size() == min_x.size()) && (max_z.size() == min_x.size()));
+        return min_x.size();
+    }
+
+    [[nodiscard]] constexpr AABB3<T> operator[](std::size_t idx) const
+    {
+        return AABB3<T>(Point3<T>(min_x[idx], min_y[idx], min_z[idx]), Point3<T>(max_x[idx], max_y[idx], max_z[idx]));
+    }
+};
+
+/** Non-owning structure-of-arrays view of a set of segments.
+ * The segment at index i runs from p = (p_x[i], p_y[i], p_z[i]) to p + v, with v = (v_x[i], v_y[i], v_z[i]).
+ * All spans must have the same size.
+ */
+template<typename T>
+struct Segment3SoA {
+    std::span<T const> p_x;
+    std::span<T const> p_y;
+    std::span<T const> p_z;
+    std::span<T const> v_x;
+    std::span<T const> v_y;
+    std::span<T const> v_z;
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        assert((p_y.size() == p_x.size()) && (p_z.size() == p_x.size()) && (v_x.size() == p_x.size()) &&
+               (v_y.size() == p_x.size()) && (v_z.size() == p_x.size()));
+        return p_x.size();
+    }
+
+    [[nodiscard]] constexpr Line3<T> operator[](std::size_t idx) const
+    {
+        return Line3<T>(Point3<T>(p_x[idx], p_y[idx], p_z[idx]), Vector3<T>(v_x[idx], v_y[idx], v_z[idx]));
+    }
+};
+
+/** @name Batched distance queries.
+ * Each of these functions evaluates a distance query between one object and each element of a set of objects
+ * in structure-of-arrays layout, writing the result for element i to out[i]. The results are identical to those
+ * of the respective scalar functions. The scalar kernels are branch-free, so the compiler can vectorize the loops.
+ * @pre out has at least as many elements as the set of objects.
+ */
+///@{
+template<typename T>
+inline void distance_squared(AABB3<T> const& b, Point3SoA<T> const& points, std::span<T> out)
+{
+    std::size_t const n = points.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = distance_squared(b, Point3<T>(points.x[i], points.y[i], points.z[i]));
+    }
+}
+
+template<std::floating_point T>
+inline void signed_distance(AABB3<T> const& b, Point3SoA<T> const& points, std::span<T> out)
+{
+    std::size_t const n = points.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = signed_distance(b, Point3<T>(points.x[i], points.y[i], points.z[i]));
+    }
+}
+
+template<std::floating_point T>
+inline void signed_distance(OBB3<T> const& o, Point3SoA<T> const& points, std::span<T> out)
+{
+    std::size_t const n = points.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = signed_distance(o, Point3<T>(points.x[i], points.y[i], points.z[i]));
+    }
+}
+
+template<std::floating_point T>
+inline void signed_distance(AABB3<T> const& b, Sphere3SoA<T> const& spheres, std::span<T> out)
+{
+    std::size_t const n = spheres.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = signed_distance(b, Point3<T>(spheres.center_x[i], spheres.center_y[i], spheres.center_z[i])) -
+                 spheres.radius[i];
+    }
+}
+
+template<typename T>
+inline void distance_squared(AABB3<T> const& b, AABB3SoA<T> const& boxes, std::span<T> out)
+{
+    std::size_t const n = boxes.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = distance_squared(b, AABB3<T>(Point3<T>(boxes.min_x[i], boxes.min_y[i], boxes.min_z[i]),
+                                              Point3<T>(boxes.max_x[i], boxes.max_y[i], boxes.max_z[i])));
+    }
+}
+
+template<std::floating_point T>
+inline void distance_squared_segment(Line3<T> const& s, Segment3SoA<T> const& segments, std::span<T> out)
+{
+    std::size_t const n = segments.size();
+    assert(out.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = distance_squared_segment(s, Line3<T>(Point3<T>(segments.p_x[i], segments.p_y[i], segments.p_z[i]),
+                                                      Vector3<T>(segments.v_x[i], segments.v_y[i], segments.v_z[i])));
+    }
+}
+///@}
+}
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_QUANTIZED_VECTOR3_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_QUANTIZED_VECTOR3_HPP
+
+/** @file
+ *
+ * @brief Compact storage formats for normals and positions.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Unit vector in octahedral encoding, stored as two signed normalized integers.
+ * The unit sphere is projected onto the octahedron |x| + |y| + |z| = 1, whose lower half is folded over the upper
+ * half, so that the whole sphere maps to the square [-1, 1]^2.
+ */
+template<std::signed_integral Int_T>
+struct OctahedralNormal {
+    Int_T x;
+    Int_T y;
+
+    [[nodiscard]] friend constexpr bool operator==(OctahedralNormal const&, OctahedralNormal const&) = default;
+};
+
+/** 2 bytes per normal. The angular error of a decoded normal is below 1.2 degrees.
+ */
+using OctahedralNormal8 = OctahedralNormal<std::int8_t>;
+/** 4 bytes per normal. The angular error of a decoded normal is below 0.005 degrees.
+ */
+using OctahedralNormal16 = OctahedralNormal<std::int16_t>;
+
+/** Position quantized to 16 bits per axis relative to an AABB3.
+ */
+struct QuantizedPoint3 {
+    std::uint16_t x;
+    std::uint16_t y;
+    std::uint16_t z;
+
+    [[nodiscard]] friend constexpr bool operator==(QuantizedPoint3 const&, QuantizedPoint3 const&) = default;
+};
+
+namespace quantization_detail
+{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline T sign_not_zero(T v)
+{
+    return (v < traits::Constants<T>::Zero()) ? -traits::Constants<T>::One() : traits::Constants<T>::One();
+}
+
+template<std::signed_integral Int_T, std::floating_point T>
+[[nodiscard]] constexpr inline Int_T to_snorm(T v)
+{
+    T const one = traits::Constants<T>::One();
+    T const clamped = (v > -one) ? ((v < one) ? v : one) : -one;
+    T const scaled = clamped * static_cast<T>(std::numeric_limits<Int_T>::max());
+    return static_cast<Int_T>(scaled + ((scaled < traits::Constants<T>::Zero()) ? static_cast<T>(-0.5) :
+                                                                                 static_cast<T>(0.5)));
+}
+
+template<std::floating_point T, std::signed_integral Int_T>
+[[nodiscard]] constexpr inline T from_snorm(Int_T v)
+{
+    T const f = static_cast<T>(v) / static_cast<T>(std::numeric_limits<Int_T>::max());
+    return (f < -traits::Constants<T>::One()) ? -traits::Constants<T>::One() : f;
+}
+
+/** Scale factors for quantizing positions within an AABB3.
+ * Degenerate axes of zero extent quantize to 0 and dequantize to the box minimum.
+ */
+template<std::floating_point T>
+struct PointQuantizationScale {
+    Point3<T> origin;
+    Vector3<T> to_quantized;
+    Vector3<T> from_quantized;
+
+    explicit constexpr PointQuantizationScale(AABB3<T> const& bounds)
+        :origin(bounds.min), to_quantized(doNotInitialize), from_quantized(doNotInitialize)
+    {
+        T const zero = traits::Constants<T>::Zero();
+        T const max_value = static_cast<T>(std::numeric_limits<std::uint16_t>::max());
+        for (std::size_t i = 0; i < 3; ++i) {
+            T const extent = bounds.max[i] - bounds.min[i];
+            to_quantized[i] = (extent > zero) ? (max_value / extent) : zero;
+            from_quantized[i] = (extent > zero) ? (extent / max_value) : zero;
+        }
+    }
+
+    [[nodiscard]] constexpr std::uint16_t quantize(T v, std::size_t axis) const
+    {
+        T const max_value = static_cast<T>(std::numeric_limits<std::uint16_t>::max());
+        T const scaled = (v - origin[axis]) * to_quantized[axis];
+        T const clamped = (scaled > traits::Constants<T>::Zero()) ? ((scaled < max_value) ? scaled : max_value) :
+                                                                    traits::Constants<T>::Zero();
+        return static_cast<std::uint16_t>(clamped + static_cast<T>(0.5));
+    }
+
+    [[nodiscard]] constexpr QuantizedPoint3 quantize(Point3<T> const& p) const
+    {
+        return QuantizedPoint3{ quantize(p.x, 0), quantize(p.y, 1), quantize(p.z, 2) };
+    }
+
+    [[nodiscard]] constexpr Point3<T> dequantize(QuantizedPoint3 const& q) const
+    {
+        return Point3<T>(origin.x + static_cast<T>(q.x) * from_quantized.x,
+                         origin.y + static_cast<T>(q.y) * from_quantized.y,
+                         origin.z + static_cast<T>(q.z) * from_quantized.z);
+    }
+};
+}
+
+/** @name Octahedral normal encoding.
+ * encode_octahedral() accepts vectors of any non-zero length; the zero vector encodes as (0, 0, 1).
+ * decode_octahedral() returns a vector of unit length.
+ * The angular error bounds are documented with OctahedralNormal8 and OctahedralNormal16.
+ */
+///@{
+template<std::signed_integral Int_T, std::floating_point T, typename VectorTag_T>
+[[nodiscard]] inline OctahedralNormal<Int_T> encode_octahedral(Vector3Impl<T, VectorTag_T> const& n)
+{
+    using quantization_detail::sign_not_zero;
+    using quantization_detail::to_snorm;
+    T const one = traits::Constants<T>::One();
+    T const l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (!(l1 > traits::Constants<T>::Zero())) { return OctahedralNormal<Int_T>{ 0, 0 }; }
+    T px = n.x / l1;
+    T py = n.y / l1;
+    if (n.z < traits::Constants<T>::Zero()) {
+        T const fx = (one - std::abs(py)) * sign_not_zero(px);
+        T const fy = (one - std::abs(px)) * sign_not_zero(py);
+        px = fx;
+        py = fy;
+    }
+    return OctahedralNormal<Int_T>{ to_snorm<Int_T>(px), to_snorm<Int_T>(py) };
+}
+
+template<std::floating_point T = float, std::signed_integral Int_T>
+[[nodiscard]] inline Normal3<T> decode_octahedral(OctahedralNormal<Int_T> const& e)
+{
+    using quantization_detail::from_snorm;
+    using quantization_detail::sign_not_zero;
+    T const one = traits::Constants<T>::One();
+    T x = from_snorm<T>(e.x);
+    T y = from_snorm<T>(e.y);
+    T const z = one - std::abs(x) - std::abs(y);
+    if (z < traits::Constants<T>::Zero()) {
+        T const fx = (one - std::abs(y)) * sign_not_zero(x);
+        T const fy = (one - std::abs(x)) * sign_not_zero(y);
+        x = fx;
+        y = fy;
+    }
+    T const inv_len = one / std::sqrt(x*x + y*y + z*z);
+    return Normal3<T>(x * inv_len, y * inv_len, z * inv_len);
+}
+///@}
+
+/** @name Position quantization.
+ * Positions are mapped to 16 bit integers per axis, relative to a bounding box. Positions outside of the box
+ * are clamped to it. For positions inside the box, the error of a dequantized coordinate is at most
+ * (bounds.max - bounds.min) / 131070 on each axis, plus floating point rounding.
+ */
+///@{
+template<std::floating_point T>
+[[nodiscard]] constexpr inline QuantizedPoint3 quantize(AABB3<T> const& bounds, Point3<T> const& p)
+{
+    return quantization_detail::PointQuantizationScale<T>(bounds).quantize(p);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Point3<T> dequantize(AABB3<T> const& bounds, QuantizedPoint3 const& q)
+{
+    return quantization_detail::PointQuantizationScale<T>(bounds).dequantize(q);
+}
+///@}
+
+/** @name Bulk encoding and decoding.
+ * Apply the single element functions to each element of a span. The scale factors for position quantization
+ * are computed once per call. The loop bodies are independent for all elements, which allows the compiler
+ * to vectorize them.
+ * The output span must be at least as large as the input span.
+ */
+///@{
+template<std::signed_integral Int_T, std::floating_point T, typename VectorTag_T>
+inline void encode_octahedral(std::span<Vector3Impl<T, VectorTag_T> const> normals,
+                              std::span<OctahedralNormal<Int_T>> out)
+{
+    assert(out.size() >= normals.size());
+    for (std::size_t i = 0; i < normals.size(); ++i) { out[i] = encode_octahedral<Int_T>(normals[i]); }
+}
+
+template<std::floating_point T, std::signed_integral Int_T>
+inline void decode_octahedral(std::span<OctahedralNormal<Int_T> const> encoded, std::span<Normal3<T>> out)
+{
+    assert(out.size() >= encoded.size());
+    for (std::size_t i = 0; i < encoded.size(); ++i) { out[i] = decode_octahedral<T>(encoded[i]); }
+}
+
+template<std::floating_point T>
+inline void quantize(AABB3<T> const& bounds, std::span<Point3<T> const> points, std::span<QuantizedPoint3> out)
+{
+    assert(out.size() >= points.size());
+    quantization_detail::PointQuantizationScale<T> const scale(bounds);
+    for (std::size_t i = 0; i < points.size(); ++i) { out[i] = scale.quantize(points[i]); }
+}
+
+template<std::floating_point T>
+inline void dequantize(AABB3<T> const& bounds, std::span<QuantizedPoint3 const> quantized, std::span<Point3<T>> out)
+{
+    assert(out.size() >= quantized.size());
+    quantization_detail::PointQuantizationScale<T> const scale(bounds);
+    for (std::size_t i = 0; i < quantized.size(); ++i) { out[i] = scale.dequantize(quantized[i]); }
+}
+///@}
+}
+
+#endif
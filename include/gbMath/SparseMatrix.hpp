@@ -0,0 +1,253 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SPARSE_MATRIX_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SPARSE_MATRIX_HPP
+
+/** @file
+ *
+ * @brief Sparse matrices in compressed sparse row (CSR) format.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Matrix3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace SparseMatrixTraits
+{
+/** Describes the blocks stored in a BasicSparseMatrix.
+ * For a block type Block_T, VectorElementType is the type of the elements of the vectors that the matrix
+ * can be multiplied with. Each block maps one such element to another.
+ */
+template<typename Block_T>
+struct BlockTraits;
+
+template<std::floating_point T>
+struct BlockTraits<T> {
+    using ScalarType = T;
+    using VectorElementType = T;
+
+    [[nodiscard]] static constexpr T inner_product(T lhs, T rhs)
+    {
+        return lhs * rhs;
+    }
+
+    [[nodiscard]] static constexpr T inverse(T b)
+    {
+        return traits::Constants<T>::One() / b;
+    }
+};
+
+template<std::floating_point T>
+struct BlockTraits<Matrix3<T>> {
+    using ScalarType = T;
+    using VectorElementType = Vector3<T>;
+
+    [[nodiscard]] static constexpr T inner_product(Vector3<T> const& lhs, Vector3<T> const& rhs)
+    {
+        return dot(lhs, rhs);
+    }
+
+    [[nodiscard]] static constexpr Matrix3<T> inverse(Matrix3<T> const& b)
+    {
+        return ::GHULBUS_MATH_NAMESPACE::inverse(b);
+    }
+};
+}
+
+/** A single entry of a sparse matrix, used for assembling a BasicSparseMatrix.
+ */
+template<typename Block_T>
+struct SparseMatrixEntry {
+    std::size_t row;
+    std::size_t column;
+    Block_T value;
+};
+
+/** Sparse matrix in compressed sparse row (CSR) format.
+ * The matrix consists of rows x columns blocks of type Block_T, of which only the non-zero blocks are stored.
+ * For scalar blocks, this is a regular CSR matrix. For Matrix3 blocks, this is a block-CSR matrix that operates
+ * on vectors of Vector3, which is the natural layout for systems with three degrees of freedom per node.
+ * The sparsity pattern is fixed on construction, but the values of the non-zero blocks may be modified
+ * through values(), which allows re-assembling a system with the same topology without reallocation.
+ * Within each row, the stored blocks are sorted by column.
+ */
+template<typename Block_T>
+class BasicSparseMatrix {
+public:
+    using BlockType = Block_T;
+    using ValueType = typename SparseMatrixTraits::BlockTraits<Block_T>::ScalarType;
+    using VectorElementType = typename SparseMatrixTraits::BlockTraits<Block_T>::VectorElementType;
+private:
+    std::size_t m_rows;
+    std::size_t m_columns;
+    std::vector<std::size_t> m_rowOffsets;
+    std::vector<std::size_t> m_columnIndices;
+    std::vector<Block_T> m_values;
+public:
+    constexpr BasicSparseMatrix()
+        :m_rows(0), m_columns(0), m_rowOffsets(1, 0)
+    {}
+
+    /** Assembles a sparse matrix from a list of entries in arbitrary order.
+     * Multiple entries for the same row and column are summed up, as is common for finite element assembly.
+     */
+    BasicSparseMatrix(std::size_t rows, std::size_t columns, std::span<SparseMatrixEntry<Block_T> const> entries)
+        :m_rows(rows), m_columns(columns), m_rowOffsets(rows + 1, 0)
+    {
+        std::vector<SparseMatrixEntry<Block_T>> sorted(entries.begin(), entries.end());
+        std::stable_sort(begin(sorted), end(sorted),
+            [](SparseMatrixEntry<Block_T> const& lhs, SparseMatrixEntry<Block_T> const& rhs) {
+                return (lhs.row < rhs.row) || ((lhs.row == rhs.row) && (lhs.column < rhs.column));
+            });
+        m_columnIndices.reserve(sorted.size());
+        m_values.reserve(sorted.size());
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            SparseMatrixEntry<Block_T> const& e = sorted[i];
+            assert((e.row < rows) && (e.column < columns));
+            if ((i > 0) && (sorted[i - 1].row == e.row) && (sorted[i - 1].column == e.column)) {
+                m_values.back() += e.value;
+            } else {
+                ++m_rowOffsets[e.row + 1];
+                m_columnIndices.push_back(e.column);
+                m_values.push_back(e.value);
+            }
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            m_rowOffsets[i + 1] += m_rowOffsets[i];
+        }
+    }
+
+    /** Constructs a sparse matrix from raw CSR arrays.
+     * @pre row_offsets has rows + 1 elements, starting at 0 and non-decreasing.
+     *      column_indices and values have row_offsets.back() elements.
+     *      Column indices within each row are sorted and unique.
+     */
+    BasicSparseMatrix(std::size_t rows, std::size_t columns, std::vector<std::size_t> row_offsets,
+                      std::vector<std::size_t> column_indices, std::vector<Block_T> values)
+        :m_rows(rows), m_columns(columns), m_rowOffsets(std::move(row_offsets)),
+         m_columnIndices(std::move(column_indices)), m_values(std::move(values))
+    {
+        assert(m_rowOffsets.size() == rows + 1);
+        assert(m_rowOffsets.front() == 0);
+        assert(m_columnIndices.size() == m_rowOffsets.back());
+        assert(m_values.size() == m_rowOffsets.back());
+    }
+
+    [[nodiscard]] std::size_t rows() const
+    {
+        return m_rows;
+    }
+
+    [[nodiscard]] std::size_t columns() const
+    {
+        return m_columns;
+    }
+
+    /** Number of stored blocks.
+     */
+    [[nodiscard]] std::size_t non_zeros() const
+    {
+        return m_values.size();
+    }
+
+    [[nodiscard]] std::span<std::size_t const> row_offsets() const
+    {
+        return m_rowOffsets;
+    }
+
+    [[nodiscard]] std::span<std::size_t const> column_indices() const
+    {
+        return m_columnIndices;
+    }
+
+    [[nodiscard]] std::span<Block_T> values()
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] std::span<Block_T const> values() const
+    {
+        return m_values;
+    }
+
+    /** Returns the block at row r and column c, or a zero block if that block is not stored.
+     */
+    [[nodiscard]] Block_T operator()(std::size_t r, std::size_t c) const
+    {
+        auto const row_begin = begin(m_columnIndices) + m_rowOffsets[r];
+        auto const row_end = begin(m_columnIndices) + m_rowOffsets[r + 1];
+        auto const it = std::lower_bound(row_begin, row_end, c);
+        if ((it == row_end) || (*it != c)) { return Block_T{}; }
+        return m_values[it - begin(m_columnIndices)];
+    }
+
+    /** Computes y = A * x for the rows in the range [row_begin, row_end).
+     * Calls for disjoint row ranges do not interfere with each other, so a large product can be distributed
+     * over multiple threads by partitioning the rows.
+     * @pre x has columns() elements and y has rows() elements. x and y do not alias.
+     */
+    void multiply(std::span<VectorElementType const> x, std::span<VectorElementType> y,
+                  std::size_t row_begin, std::size_t row_end) const
+    {
+        assert(x.size() >= m_columns);
+        assert(y.size() >= m_rows);
+        assert((row_begin <= row_end) && (row_end <= m_rows));
+        for (std::size_t i = row_begin; i < row_end; ++i) {
+            VectorElementType acc{};
+            for (std::size_t k = m_rowOffsets[i]; k < m_rowOffsets[i + 1]; ++k) {
+                acc += m_values[k] * x[m_columnIndices[k]];
+            }
+            y[i] = acc;
+        }
+    }
+
+    /** Computes y = A * x.
+     * @pre x has columns() elements and y has rows() elements. x and y do not alias.
+     */
+    void multiply(std::span<VectorElementType const> x, std::span<VectorElementType> y) const
+    {
+        multiply(x, y, 0, m_rows);
+    }
+
+    /** Inverses of the diagonal blocks, for use as a (block-)Jacobi preconditioner.
+     * @pre The matrix is square and all diagonal blocks are invertible.
+     */
+    [[nodiscard]] std::vector<Block_T> inverse_diagonal() const
+    {
+        std::vector<Block_T> ret(m_rows);
+        inverse_diagonal(ret);
+        return ret;
+    }
+
+    /** Writes the inverses of the diagonal blocks to out, which must have rows() elements.
+     * @pre The matrix is square and all diagonal blocks are invertible.
+     */
+    void inverse_diagonal(std::span<Block_T> out) const
+    {
+        assert(m_rows == m_columns);
+        assert(out.size() >= m_rows);
+        for (std::size_t i = 0; i < m_rows; ++i) {
+            out[i] = SparseMatrixTraits::BlockTraits<Block_T>::inverse((*this)(i, i));
+        }
+    }
+};
+
+template<std::floating_point T>
+using SparseMatrix = BasicSparseMatrix<T>;
+
+template<std::floating_point T>
+using BlockSparseMatrix3 = BasicSparseMatrix<Matrix3<T>>;
+}
+
+#endif
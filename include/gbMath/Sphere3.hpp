@@ -9,6 +9,7 @@
 
 #include <gbMath/config.hpp>
 
+#include <gbMath/AABB3.hpp>
 #include <gbMath/Common.hpp>
 #include <gbMath/Line3.hpp>
 #include <gbMath/NumberTypeTraits.hpp>
@@ -16,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <concepts>
 #include <limits>
 #include <optional>
 #include <type_traits>
@@ -66,15 +68,30 @@ template<typename T>
     return true;
 }
 
-template<typename T>
-[[nodiscard]] constexpr inline bool intersects(Sphere3<T> const& s, Line3<T> const& l)
+/** Signed distance between the surfaces of a sphere and a box.
+ * Positive if the two are separated, negative if they overlap.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T signed_distance(Sphere3<T> const& s, AABB3<T> const& b)
+{
+    return signed_distance(b, s.center) - s.radius;
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline T signed_distance(AABB3<T> const& b, Sphere3<T> const& s)
+{
+    return signed_distance(s, b);
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline bool intersects(Sphere3<T> const& s, NormalizedLine3<T> const& l)
 {
     Vector3<T> const m = l.p - s.center;
     T const c = dot(m, m) - (s.radius * s.radius);
     if(c <= traits::Constants<T>::Zero()) {
         return true;
     }
-    T const b = dot(m, normalized(l.v));
+    T const b = dot(m, l.v);
     if(b > traits::Constants<T>::Zero()) {
         return false;
     }
@@ -85,11 +102,17 @@ template<typename T>
     return true;
 }
 
-template<typename T>
-[[nodiscard]] constexpr inline std::optional<T> intersect_p(Sphere3<T> const& s, Line3<T> const& l)
+template<std::floating_point T>
+[[nodiscard]] constexpr inline bool intersects(Sphere3<T> const& s, Line3<T> const& l)
+{
+    return intersects(s, NormalizedLine3<T>(l));
+}
+
+template<std::floating_point T>
+[[nodiscard]] constexpr inline std::optional<T> intersect_p(Sphere3<T> const& s, NormalizedLine3<T> const& l)
 {
     Vector3<T> const m = l.p - s.center;
-    T const b = dot(m, normalized(l.v));
+    T const b = dot(m, l.v);
     T const c = dot(m, m) - (s.radius * s.radius);
     if(c > traits::Constants<T>::Zero() && b > traits::Constants<T>::Zero()) {
         // ray origin is outside of sphere and ray is pointing away from sphere: no intersection
@@ -104,11 +127,17 @@ template<typename T>
     if(t < traits::Constants<T>::Zero()) {
         // ray origin is inside sphere; clamp t to 0
         // this means we consider spheres solid; rays starting inside the sphere intersect at the ray origin
-        t = 0.f;
+        t = traits::Constants<T>::Zero();
     }
     return t;
 }
 
+template<std::floating_point T>
+[[nodiscard]] constexpr inline std::optional<T> intersect_p(Sphere3<T> const& s, Line3<T> const& l)
+{
+    return intersect_p(s, NormalizedLine3<T>(l));
+}
+
 template<typename T>
 struct Sphere3Line3IntersectionParameters
 {
@@ -170,14 +199,20 @@ struct Sphere3Line3Intersection
     }
 };
 
-template<typename T>
-[[nodiscard]] constexpr inline Sphere3Line3Intersection<T> intersect(Sphere3<T> const& s, Line3<T> const& l)
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Sphere3Line3Intersection<T> intersect(Sphere3<T> const& s, NormalizedLine3<T> const& l)
 {
     Vector3<T> const m = l.p - s.center;
-    T const b = dot(m, normalized(l.v));
+    T const b = dot(m, l.v);
     T const c = dot(m, m) - (s.radius * s.radius);
     return Sphere3Line3Intersection(b, c);
 }
 
+template<std::floating_point T>
+[[nodiscard]] constexpr inline Sphere3Line3Intersection<T> intersect(Sphere3<T> const& s, Line3<T> const& l)
+{
+    return intersect(s, NormalizedLine3<T>(l));
+}
+
 }
 #endif
@@ -0,0 +1,141 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SPHERE3_BATCH_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SPHERE3_BATCH_HPP
+
+/** @file
+ *
+ * @brief Batched ray-sphere intersection.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Line3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Sphere3.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning structure-of-arrays view of a set of spheres.
+ * The sphere at index i has its center at (center_x[i], center_y[i], center_z[i]) and radius radius[i].
+ * All four spans must have the same size.
+ */
+template<std::floating_point T>
+struct Sphere3SoA {
+    std::span<T const> center_x;
+    std::span<T const> center_y;
+    std::span<T const> center_z;
+    std::span<T const> radius;
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        assert((center_y.size() == center_x.size()) && (center_z.size() == center_x.size()) &&
+               (radius.size() == center_x.size()));
+        return center_x.size();
+    }
+
+    [[nodiscard]] constexpr Sphere3<T> operator[](std::size_t idx) const
+    {
+        return Sphere3<T>(Point3<T>(center_x[idx], center_y[idx], center_z[idx]), radius[idx]);
+    }
+};
+
+/** The nearest sphere hit by a ray.
+ */
+template<typename T>
+struct Sphere3Hit {
+    std::size_t index;      ///< Index of the sphere that was hit.
+    T t;                    ///< Ray parameter of the hit, as returned by intersect_p().
+};
+
+namespace batch_detail
+{
+/** Branch-free equivalent of intersect_p(Sphere3, NormalizedLine3).
+ * The arguments are the components of the vector from the sphere center to the ray origin,
+ * the components of the normalized ray direction and the sphere radius.
+ * Returns infinity if the ray misses the sphere.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T sphere3_ray_t(T mx, T my, T mz, T dx, T dy, T dz, T r)
+{
+    T const b = (mx * dx) + (my * dy) + (mz * dz);
+    T const c = ((mx * mx) + (my * my) + (mz * mz)) - (r * r);
+    T const discr = b*b - c;
+    T const t = std::max(-b - std::sqrt(std::max(discr, traits::Constants<T>::Zero())), traits::Constants<T>::Zero());
+    bool const is_behind = (c > traits::Constants<T>::Zero()) && (b > traits::Constants<T>::Zero());
+    bool const is_hit = (discr >= traits::Constants<T>::Zero()) && !is_behind;
+    return is_hit ? t : std::numeric_limits<T>::infinity();
+}
+}
+
+/** @name Packet ray-sphere intersection.
+ * These functions compute the same t values as intersect_p(), but process many spheres or rays at once.
+ * Rays are passed as NormalizedLine3, so the normalized direction is computed only once per ray.
+ * The loops are branch-free, which allows the compiler to vectorize them.
+ */
+///@{
+/** Intersects a ray with each of a set of spheres.
+ * Writes the t value of the intersection with spheres[i] to t[i], or infinity if the ray misses that sphere.
+ * @pre t has at least spheres.size() elements.
+ */
+template<std::floating_point T>
+inline void intersect_p(NormalizedLine3<T> const& ray, Sphere3SoA<T> const& spheres, std::span<T> t)
+{
+    std::size_t const n = spheres.size();
+    assert(t.size() >= n);
+    for (std::size_t i = 0; i < n; ++i) {
+        t[i] = batch_detail::sphere3_ray_t(ray.p.x - spheres.center_x[i], ray.p.y - spheres.center_y[i],
+                                           ray.p.z - spheres.center_z[i], ray.v.x, ray.v.y, ray.v.z,
+                                           spheres.radius[i]);
+    }
+}
+
+/** Finds the sphere that a ray hits first.
+ * If the ray hits multiple spheres at the same t, the one with the lowest index is returned.
+ * Returns std::nullopt if the ray misses all spheres.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<Sphere3Hit<T>> intersect_nearest(NormalizedLine3<T> const& ray,
+                                                                    Sphere3SoA<T> const& spheres)
+{
+    std::size_t const n = spheres.size();
+    T nearest_t = std::numeric_limits<T>::infinity();
+    std::size_t nearest_index = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        T const t = batch_detail::sphere3_ray_t(ray.p.x - spheres.center_x[i], ray.p.y - spheres.center_y[i],
+                                                ray.p.z - spheres.center_z[i], ray.v.x, ray.v.y, ray.v.z,
+                                                spheres.radius[i]);
+        bool const is_nearer = (t < nearest_t);
+        nearest_index = is_nearer ? i : nearest_index;
+        nearest_t = is_nearer ? t : nearest_t;
+    }
+    if (nearest_t == std::numeric_limits<T>::infinity()) { return std::nullopt; }
+    return Sphere3Hit<T>{ nearest_index, nearest_t };
+}
+
+/** Intersects each of a set of rays with a single sphere.
+ * Writes the t value of the intersection of rays[i] to t[i], or infinity if that ray misses the sphere.
+ * @pre t has at least rays.size() elements.
+ */
+template<std::floating_point T>
+inline void intersect_p(Sphere3<T> const& s, std::span<NormalizedLine3<T> const> rays, std::span<T> t)
+{
+    assert(t.size() >= rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        NormalizedLine3<T> const& ray = rays[i];
+        t[i] = batch_detail::sphere3_ray_t(ray.p.x - s.center.x, ray.p.y - s.center.y, ray.p.z - s.center.z,
+                                           ray.v.x, ray.v.y, ray.v.z, s.radius);
+    }
+}
+///@}
+}
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SWEPT_COLLISION_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_SWEPT_COLLISION_HPP
+
+/** @file
+ *
+ * @brief Time of impact for moving spheres and boxes.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Plane3.hpp>
+#include <gbMath/Sphere3.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+
+/* All functions in this file consider shapes that move with constant velocity over the time interval [0, 1].
+ * The motion of each shape is given as its displacement over that interval, usually velocity * timestep.
+ * They return the earliest time in [0, 1] at which the shapes touch, 0 if they already intersect at time 0,
+ * or std::nullopt if they do not touch during the interval.
+ * See Ericson - Real-Time Collision Detection, Section 5.5.
+ */
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace swept_collision_detail
+{
+/** Earliest t in [0, 1] at which the point p + t * v lies inside the box, using the slab test.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> intersect_segment(AABB3<T> const& b, Point3<T> const& p, Vector3<T> const& v)
+{
+    T t_min = traits::Constants<T>::Zero();
+    T t_max = traits::Constants<T>::One();
+    for (std::size_t i = 0; i < 3; ++i) {
+        if (v[i] == traits::Constants<T>::Zero()) {
+            // segment is parallel to the slab; no hit unless the start point is within the slab
+            if ((p[i] < b.min[i]) || (p[i] > b.max[i])) { return std::nullopt; }
+        } else {
+            T const inv_v = traits::Constants<T>::One() / v[i];
+            T t1 = (b.min[i] - p[i]) * inv_v;
+            T t2 = (b.max[i] - p[i]) * inv_v;
+            if (t1 > t2) { std::swap(t1, t2); }
+            t_min = std::max(t_min, t1);
+            t_max = std::min(t_max, t2);
+            if (t_min > t_max) { return std::nullopt; }
+        }
+    }
+    return t_min;
+}
+
+/** Earliest t >= 0 at which |m + t * v| == r, for |m| > r, or infinity if there is none.
+ * Only the components selected by the mask take part, which allows solving for cylinders as well as spheres.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline T first_root(Vector3<T> const& m, Vector3<T> const& v, T r, Vector3<T> const& mask)
+{
+    T const zero = traits::Constants<T>::Zero();
+    Vector3<T> const mm(m.x * mask.x, m.y * mask.y, m.z * mask.z);
+    Vector3<T> const vm(v.x * mask.x, v.y * mask.y, v.z * mask.z);
+    T const a = dot(vm, vm);
+    T const b = dot(mm, vm);
+    T const c = dot(mm, mm) - r*r;
+    if ((a == zero) || (b >= zero)) { return std::numeric_limits<T>::infinity(); }
+    T const discr = b*b - a*c;
+    if (discr < zero) { return std::numeric_limits<T>::infinity(); }
+    return std::max((-b - std::sqrt(discr)) / a, zero);
+}
+}
+
+/** Time of impact of two moving spheres.
+ * @param[in] v0 Displacement of s0 over the time interval.
+ * @param[in] v1 Displacement of s1 over the time interval.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> time_of_impact(Sphere3<T> const& s0, Vector3<T> const& v0,
+                                                     Sphere3<T> const& s1, Vector3<T> const& v1)
+{
+    T const zero = traits::Constants<T>::Zero();
+    Vector3<T> const s = s1.center - s0.center;
+    Vector3<T> const v = v1 - v0;
+    T const r = s0.radius + s1.radius;
+    T const c = dot(s, s) - r*r;
+    if (c <= zero) {
+        // spheres already overlap
+        return zero;
+    }
+    T const a = dot(v, v);
+    T const b = dot(v, s);
+    if ((a == zero) || (b >= zero)) {
+        // spheres not moving relative to each other, or moving apart
+        return std::nullopt;
+    }
+    T const discr = b*b - a*c;
+    if (discr < zero) { return std::nullopt; }
+    T const t = (-b - std::sqrt(discr)) / a;
+    if (t > traits::Constants<T>::One()) { return std::nullopt; }
+    return t;
+}
+
+/** Time of impact of a moving sphere and a moving box.
+ * The set of sphere centers touching the box is the box rounded by the sphere radius, which is the union of
+ * the box extended by the radius along each of the axes, cylinders around the 12 edges and spheres around the
+ * 8 corners. The earliest entry of the sphere center into any of these is the time of impact.
+ * @param[in] vs Displacement of the sphere over the time interval.
+ * @param[in] vb Displacement of the box over the time interval.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> time_of_impact(Sphere3<T> const& s, Vector3<T> const& vs,
+                                                     AABB3<T> const& b, Vector3<T> const& vb)
+{
+    using swept_collision_detail::first_root;
+    using swept_collision_detail::intersect_segment;
+    T const zero = traits::Constants<T>::Zero();
+    T const one = traits::Constants<T>::One();
+    T const r = s.radius;
+    if (distance_squared(b, s.center) <= r*r) { return zero; }
+    Vector3<T> const v = vs - vb;
+    Vector3<T> const ext(r, r, r);
+    // early out: the rounded box is contained in the box extended by r in all directions
+    if (!intersect_segment(AABB3<T>(b.min - ext, b.max + ext), s.center, v)) { return std::nullopt; }
+
+    T t = std::numeric_limits<T>::infinity();
+    // face regions
+    for (std::size_t i = 0; i < 3; ++i) {
+        Vector3<T> e(zero, zero, zero);
+        e[i] = r;
+        if (auto const t_face = intersect_segment(AABB3<T>(b.min - e, b.max + e), s.center, v)) {
+            t = std::min(t, *t_face);
+        }
+    }
+    // edge regions
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        std::size_t const i = (axis + 1) % 3;
+        std::size_t const j = (axis + 2) % 3;
+        Vector3<T> mask(one, one, one);
+        mask[axis] = zero;
+        for (T const ei : { b.min[i], b.max[i] }) {
+            for (T const ej : { b.min[j], b.max[j] }) {
+                Point3<T> edge_point = b.min;
+                edge_point[i] = ei;
+                edge_point[j] = ej;
+                T const t_edge = first_root(s.center - edge_point, v, r, mask);
+                T const h = s.center[axis] + v[axis] * t_edge;
+                if ((t_edge <= one) && (h >= b.min[axis]) && (h <= b.max[axis])) {
+                    t = std::min(t, t_edge);
+                }
+            }
+        }
+    }
+    // corner regions
+    for (std::size_t corner = 0; corner < 8; ++corner) {
+        Point3<T> const p(((corner & 1) != 0) ? b.max.x : b.min.x,
+                          ((corner & 2) != 0) ? b.max.y : b.min.y,
+                          ((corner & 4) != 0) ? b.max.z : b.min.z);
+        t = std::min(t, first_root(s.center - p, v, r, Vector3<T>(one, one, one)));
+    }
+    if (t > one) { return std::nullopt; }
+    return t;
+}
+
+/** Time of impact of two moving boxes.
+ * The boxes touch when the displacement of b relative to a lies in the Minkowski difference of a and b,
+ * which is found with a slab test of the relative displacement against that box.
+ * @param[in] va Displacement of a over the time interval.
+ * @param[in] vb Displacement of b over the time interval.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> time_of_impact(AABB3<T> const& a, Vector3<T> const& va,
+                                                     AABB3<T> const& b, Vector3<T> const& vb)
+{
+    AABB3<T> const minkowski(Point3<T>(a.min.x - b.max.x, a.min.y - b.max.y, a.min.z - b.max.z),
+                             Point3<T>(a.max.x - b.min.x, a.max.y - b.min.y, a.max.z - b.min.z));
+    return swept_collision_detail::intersect_segment(minkowski, Point3<T>(), vb - va);
+}
+
+/** Time of impact of a moving sphere and a static plane.
+ * Spheres are considered to touch the plane from either side.
+ * @param[in] v Displacement of the sphere over the time interval.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> time_of_impact(Sphere3<T> const& s, Vector3<T> const& v, Plane3<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    T const n_len = length(p.n);
+    T const dist = (dot(p.n, s.center - Point3<T>()) - p.d) / n_len;
+    if (std::abs(dist) <= s.radius) {
+        // sphere already touches the plane
+        return zero;
+    }
+    T const denom = dot(p.n, v) / n_len;
+    if (denom * dist >= zero) {
+        // sphere moving parallel to or away from the plane
+        return std::nullopt;
+    }
+    T const r = (dist > zero) ? s.radius : -s.radius;
+    T const t = (r - dist) / denom;
+    if (t > traits::Constants<T>::One()) { return std::nullopt; }
+    return t;
+}
+}
+
+#endif
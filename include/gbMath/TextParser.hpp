@@ -0,0 +1,318 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TEXT_PARSER_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TEXT_PARSER_HPP
+
+/** @file
+ *
+ * @brief Parsers for the text formats of Vector, Matrix and Rational types.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+#include <gbMath/Matrix.hpp>
+#include <gbMath/Matrix2.hpp>
+#include <gbMath/Matrix3.hpp>
+#include <gbMath/Matrix4.hpp>
+#include <gbMath/Rational.hpp>
+#include <gbMath/Vector.hpp>
+#include <gbMath/Vector2.hpp>
+#include <gbMath/Vector3.hpp>
+#include <gbMath/Vector4.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/* The parsers accept the formats written by the ostream inserters and formatters:
+ *   vectors    [1 2 3]
+ *   matrices   [ [1 2] [3 4] ]
+ *   rationals  1/2
+ * Elements are parsed with std::from_chars, so parsing is independent of the locale and does not allocate.
+ * Any amount of whitespace is accepted between brackets and elements, but leading whitespace before a value
+ * is not skipped, same as for std::from_chars.
+ * On failure, the value is left unmodified and ptr points to the position where parsing failed.
+ */
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+namespace text_parser_detail
+{
+[[nodiscard]] constexpr inline bool is_space(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r') || (c == '\v') || (c == '\f');
+}
+
+[[nodiscard]] constexpr inline char const* skip_space(char const* first, char const* last)
+{
+    while ((first != last) && is_space(*first)) { ++first; }
+    return first;
+}
+
+[[nodiscard]] constexpr inline std::from_chars_result expect(char const* first, char const* last, char c)
+{
+    if ((first == last) || (*first != c)) { return { first, std::errc::invalid_argument }; }
+    return { first + 1, std::errc{} };
+}
+
+/** Parses a scalar. Character types are parsed as numbers, the way they are written by the inserters.
+ */
+template<typename T>
+inline std::from_chars_result scalar_from_chars(char const* first, char const* last, T& out)
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::from_chars(first, last, out, std::chars_format::general);
+    } else {
+        return std::from_chars(first, last, out);
+    }
+}
+
+/** Parses a bracketed list of N whitespace separated scalars.
+ */
+template<typename T, std::size_t N>
+inline std::from_chars_result list_from_chars(char const* first, char const* last, std::array<T, N>& out)
+{
+    auto res = expect(first, last, '[');
+    if (res.ec != std::errc{}) { return res; }
+    char const* it = skip_space(res.ptr, last);
+    for (std::size_t i = 0; i < N; ++i) {
+        if (i > 0) {
+            char const* const next = skip_space(it, last);
+            if (next == it) { return { it, std::errc::invalid_argument }; }
+            it = next;
+        }
+        res = scalar_from_chars(it, last, out[i]);
+        if (res.ec != std::errc{}) { return res; }
+        it = res.ptr;
+    }
+    return expect(skip_space(it, last), last, ']');
+}
+
+/** Parses a bracketed list of M rows, each a bracketed list of N scalars, into row-major storage.
+ */
+template<typename T, std::size_t M, std::size_t N>
+inline std::from_chars_result rows_from_chars(char const* first, char const* last, std::array<T, M * N>& out)
+{
+    auto res = expect(first, last, '[');
+    if (res.ec != std::errc{}) { return res; }
+    char const* it = res.ptr;
+    std::array<T, N> row;
+    for (std::size_t i = 0; i < M; ++i) {
+        res = list_from_chars(skip_space(it, last), last, row);
+        if (res.ec != std::errc{}) { return res; }
+        std::copy(row.begin(), row.end(), out.begin() + i * N);
+        it = res.ptr;
+    }
+    return expect(skip_space(it, last), last, ']');
+}
+}
+
+template<typename T, typename VectorTag_T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Vector2Impl<T, VectorTag_T>& out)
+{
+    std::array<T, 2> v;
+    auto const res = text_parser_detail::list_from_chars(first, last, v);
+    if (res.ec == std::errc{}) { out = Vector2Impl<T, VectorTag_T>(v.data()); }
+    return res;
+}
+
+template<typename T, typename VectorTag_T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Vector3Impl<T, VectorTag_T>& out)
+{
+    std::array<T, 3> v;
+    auto const res = text_parser_detail::list_from_chars(first, last, v);
+    if (res.ec == std::errc{}) { out = Vector3Impl<T, VectorTag_T>(v.data()); }
+    return res;
+}
+
+template<typename T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Vector4<T>& out)
+{
+    std::array<T, 4> v;
+    auto const res = text_parser_detail::list_from_chars(first, last, v);
+    if (res.ec == std::errc{}) { out = Vector4<T>(v.data()); }
+    return res;
+}
+
+template<typename T, std::size_t N>
+inline std::from_chars_result from_chars(char const* first, char const* last, Vector<T, N>& out)
+{
+    std::array<T, N> v;
+    auto const res = text_parser_detail::list_from_chars(first, last, v);
+    if (res.ec == std::errc{}) { out.v = v; }
+    return res;
+}
+
+template<typename T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Matrix2<T>& out)
+{
+    std::array<T, 4> m;
+    auto const res = text_parser_detail::rows_from_chars<T, 2, 2>(first, last, m);
+    if (res.ec == std::errc{}) { out = Matrix2<T>(m.data(), MatrixPolicies::InputOrder_RowMajor{}); }
+    return res;
+}
+
+template<typename T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Matrix3<T>& out)
+{
+    std::array<T, 9> m;
+    auto const res = text_parser_detail::rows_from_chars<T, 3, 3>(first, last, m);
+    if (res.ec == std::errc{}) { out = Matrix3<T>(m.data(), MatrixPolicies::InputOrder_RowMajor{}); }
+    return res;
+}
+
+template<typename T>
+inline std::from_chars_result from_chars(char const* first, char const* last, Matrix4<T>& out)
+{
+    std::array<T, 16> m;
+    auto const res = text_parser_detail::rows_from_chars<T, 4, 4>(first, last, m);
+    if (res.ec == std::errc{}) { out = Matrix4<T>(m.data(), MatrixPolicies::InputOrder_RowMajor{}); }
+    return res;
+}
+
+template<typename T, std::size_t M, std::size_t N, MatrixPolicies::Order Order_V>
+inline std::from_chars_result from_chars(char const* first, char const* last, Matrix<T, M, N, Order_V>& out)
+{
+    std::array<T, M * N> m;
+    auto const res = text_parser_detail::rows_from_chars<T, M, N>(first, last, m);
+    if (res.ec == std::errc{}) { out = Matrix<T, M, N, Order_V>(m.data(), MatrixPolicies::InputOrder_RowMajor{}); }
+    return res;
+}
+
+/** Parses a rational n/d.
+ * A denominator of 0 is only accepted for the Permissive policy, otherwise it fails with invalid_argument.
+ */
+template<typename T, typename RationalPolicy_T>
+inline std::from_chars_result from_chars(char const* first, char const* last, RationalImpl<T, RationalPolicy_T>& out)
+{
+    T numerator;
+    auto res = std::from_chars(first, last, numerator);
+    if (res.ec != std::errc{}) { return res; }
+    res = text_parser_detail::expect(res.ptr, last, '/');
+    if (res.ec != std::errc{}) { return res; }
+    char const* const denominator_first = res.ptr;
+    T denominator;
+    res = std::from_chars(denominator_first, last, denominator);
+    if (res.ec != std::errc{}) { return res; }
+    if constexpr (!std::is_same_v<RationalPolicy_T, RationalPolicies::Permissive>) {
+        if (denominator == 0) { return { denominator_first, std::errc::invalid_argument }; }
+    }
+    out = RationalImpl<T, RationalPolicy_T>(numerator, denominator);
+    return res;
+}
+
+/** Types that can be parsed with from_chars().
+ */
+template<typename T>
+concept TextParsable = requires(char const* p, T& t) {
+    { from_chars(p, p, t) } -> std::same_as<std::from_chars_result>;
+};
+
+/** Parses a complete string.
+ * @return The parsed value, or std::nullopt if str does not contain exactly one value,
+ *         optionally surrounded by whitespace.
+ */
+template<TextParsable T>
+[[nodiscard]] inline std::optional<T> parse(std::string_view str)
+{
+    char const* const last = str.data() + str.size();
+    T ret;
+    auto const res = from_chars(text_parser_detail::skip_space(str.data(), last), last, ret);
+    if ((res.ec != std::errc{}) || (text_parser_detail::skip_space(res.ptr, last) != last)) { return std::nullopt; }
+    return ret;
+}
+
+/** Parses a sequence of whitespace separated values from a character range and invokes f on each.
+ * If f returns bool, returning false stops the parsing.
+ * @return ptr points past the last parsed value. On a parse error, ec is set and ptr points to the position
+ *         where parsing failed.
+ */
+template<TextParsable T, typename F>
+inline std::from_chars_result parse_each(char const* first, char const* last, F&& f)
+{
+    for (;;) {
+        char const* const it = text_parser_detail::skip_space(first, last);
+        if (it == last) { return { it, std::errc{} }; }
+        T value;
+        auto const res = from_chars(it, last, value);
+        if (res.ec != std::errc{}) { return res; }
+        first = res.ptr;
+        if constexpr (std::is_same_v<std::invoke_result_t<F&, T const&>, bool>) {
+            if (!f(std::as_const(value))) { return { first, std::errc{} }; }
+        } else {
+            f(std::as_const(value));
+        }
+    }
+}
+
+/** Parses a sequence of whitespace separated values from a stream and invokes f on each.
+ * The stream is read in blocks of buffer_size bytes into a single buffer that is allocated once,
+ * so arbitrarily large inputs are parsed in constant memory. A single value must fit into the buffer.
+ * If f returns bool, returning false stops the parsing; the stream is then left at an unspecified position.
+ * Sets failbit on the stream if the input contains anything but values and whitespace.
+ * @return The number of values that were parsed.
+ */
+template<TextParsable T, typename F>
+inline std::size_t parse_each(std::istream& is, F&& f, std::size_t buffer_size = 1 << 16)
+{
+    assert(buffer_size > 0);
+    std::vector<char> buffer(buffer_size);
+    std::size_t count = 0;
+    std::size_t filled = 0;
+    for (;;) {
+        is.read(buffer.data() + filled, static_cast<std::streamsize>(buffer.size() - filled));
+        filled += static_cast<std::size_t>(is.gcount());
+        bool const at_end = is.eof();
+        if (is.bad()) { return count; }
+        char const* const first = buffer.data();
+        char const* const filled_last = first + filled;
+        char const* last = filled_last;
+        if (!at_end) {
+            // only values followed by whitespace are known to be complete
+            while ((last != first) && !text_parser_detail::is_space(*(last - 1))) { --last; }
+        }
+        char const* it = text_parser_detail::skip_space(first, last);
+        while (it != last) {
+            T value;
+            auto const res = from_chars(it, last, value);
+            if (res.ec != std::errc{}) {
+                // a value that is cut off at the end of the block fails at last and is retried with more input
+                if (at_end || (res.ec != std::errc::invalid_argument) || (res.ptr != last)) {
+                    is.setstate(std::ios_base::failbit);
+                    return count;
+                }
+                break;
+            }
+            ++count;
+            if constexpr (std::is_same_v<std::invoke_result_t<F&, T const&>, bool>) {
+                if (!f(std::as_const(value))) { return count; }
+            } else {
+                f(std::as_const(value));
+            }
+            it = text_parser_detail::skip_space(res.ptr, last);
+        }
+        if (at_end) {
+            is.clear(std::ios_base::eofbit);
+            return count;
+        }
+        // move the incomplete tail to the front of the buffer
+        std::copy(it, filled_last, buffer.data());
+        filled = static_cast<std::size_t>(filled_last - it);
+        if (filled == buffer.size()) {
+            // a single value does not fit into the buffer
+            is.setstate(std::ios_base::failbit);
+            return count;
+        }
+    }
+}
+}
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TRIANGLE3_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TRIANGLE3_HPP
+
+/** @file
+*
+* @brief 3D Triangle.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Common.hpp>
+#include <gbMath/Line3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+template<typename T>
+class Triangle3 {
+public:
+    Point3<T> a;
+    Point3<T> b;
+    Point3<T> c;
+
+    constexpr Triangle3() = default;
+    constexpr explicit Triangle3(DoNotInitialize_Tag)
+        :a(doNotInitialize), b(doNotInitialize), c(doNotInitialize)
+    {}
+    constexpr Triangle3(Triangle3 const&) = default;
+    constexpr Triangle3& operator=(Triangle3 const&) = default;
+
+    constexpr Triangle3(Point3<T> const& n_a, Point3<T> const& n_b, Point3<T> const& n_c)
+        :a(n_a), b(n_b), c(n_c)
+    {}
+
+    [[nodiscard]] friend constexpr bool operator==(Triangle3 const& lhs, Triangle3 const& rhs) = default;
+};
+
+template<typename T>
+[[nodiscard]] constexpr inline AABB3<T> bounds(Triangle3<T> const& tri)
+{
+    return AABB3<T>::from_points({ tri.a, tri.b, tri.c });
+}
+
+/** Returns the point on the triangle (including its interior) that is closest to p.
+ */
+template<typename T>
+[[nodiscard]] constexpr inline Point3<T> closest_point(Triangle3<T> const& tri, Point3<T> const& p)
+{
+    T const zero = traits::Constants<T>::Zero();
+    Vector3<T> const ab = tri.b - tri.a;
+    Vector3<T> const ac = tri.c - tri.a;
+
+    // vertex region a
+    Vector3<T> const ap = p - tri.a;
+    T const d1 = dot(ab, ap);
+    T const d2 = dot(ac, ap);
+    if((d1 <= zero) && (d2 <= zero)) { return tri.a; }
+
+    // vertex region b
+    Vector3<T> const bp = p - tri.b;
+    T const d3 = dot(ab, bp);
+    T const d4 = dot(ac, bp);
+    if((d3 >= zero) && (d4 <= d3)) { return tri.b; }
+
+    // edge region ab
+    T const vc = d1*d4 - d3*d2;
+    if((vc <= zero) && (d1 >= zero) && (d3 <= zero)) {
+        return tri.a + ab * (d1 / (d1 - d3));
+    }
+
+    // vertex region c
+    Vector3<T> const cp = p - tri.c;
+    T const d5 = dot(ab, cp);
+    T const d6 = dot(ac, cp);
+    if((d6 >= zero) && (d5 <= d6)) { return tri.c; }
+
+    // edge region ac
+    T const vb = d5*d2 - d1*d6;
+    if((vb <= zero) && (d2 >= zero) && (d6 <= zero)) {
+        return tri.a + ac * (d2 / (d2 - d6));
+    }
+
+    // edge region bc
+    T const va = d3*d6 - d5*d4;
+    if((va <= zero) && ((d4 - d3) >= zero) && ((d5 - d6) >= zero)) {
+        return tri.b + (tri.c - tri.b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    // face region
+    T const denom = va + vb + vc;
+    return tri.a + ab * (vb / denom) + ac * (vc / denom);
+}
+
+/** A line prepared for watertight intersection tests with triangles.
+ * The line is transformed into a coordinate system where its direction is the positive z axis. Triangles are
+ * then tested in that coordinate system, which guarantees that rays hitting the shared edge or vertex of
+ * adjacent triangles are never reported as missing all of them.
+ * When testing the same ray against many triangles, construct a WatertightLine3 once and reuse it.
+ * See Woop, Benthin, Wald - Watertight Ray/Triangle Intersection, JCGT 2013.
+ */
+template<std::floating_point T>
+class WatertightLine3 {
+public:
+    Point3<T> p;
+    std::size_t kx;         ///< Index of the axis mapped to x.
+    std::size_t ky;         ///< Index of the axis mapped to y.
+    std::size_t kz;         ///< Index of the dominant axis of the line direction, mapped to z.
+    T sx;                   ///< Shear along x.
+    T sy;                   ///< Shear along y.
+    T sz;                   ///< Scale along z.
+
+    /** Prepares the line l.
+     * @pre l.v != 0
+     */
+    constexpr explicit WatertightLine3(Line3<T> const& l)
+        :p(l.p)
+    {
+        using std::abs;
+        Vector3<T> const& d = l.v;
+        kz = (abs(d.x) > abs(d.y)) ? ((abs(d.x) > abs(d.z)) ? 0 : 2) : ((abs(d.y) > abs(d.z)) ? 1 : 2);
+        kx = (kz + 1) % 3;
+        ky = (kx + 1) % 3;
+        // swap to preserve the winding direction of triangles
+        if(d[kz] < traits::Constants<T>::Zero()) { std::swap(kx, ky); }
+        sx = d[kx] / d[kz];
+        sy = d[ky] / d[kz];
+        sz = traits::Constants<T>::One() / d[kz];
+    }
+};
+
+/** Result of a ray-triangle intersection.
+ * The intersection point is l.p + t * l.v, as well as u * tri.a + v * tri.b + w * tri.c.
+ */
+template<typename T>
+struct Triangle3Line3Intersection {
+    T t;
+    T u;        ///< Barycentric coordinate of tri.a.
+    T v;        ///< Barycentric coordinate of tri.b.
+    T w;        ///< Barycentric coordinate of tri.c.
+};
+
+namespace triangle3_detail
+{
+template<typename T>
+struct EdgeFunctions {
+    T u;
+    T v;
+    T w;
+};
+
+/** Evaluates the edge functions for a triangle in the sheared coordinate system of the ray.
+ * For float, edge functions that evaluate to exactly 0 are recomputed in double precision,
+ * so that the sign is correct for rays passing exactly through an edge.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline EdgeFunctions<T> evaluate_edge_functions(T ax, T ay, T bx, T by, T cx, T cy)
+{
+    EdgeFunctions<T> ret{ cx*by - cy*bx, ax*cy - ay*cx, bx*ay - by*ax };
+    if constexpr(std::is_same_v<T, float>) {
+        if((ret.u == 0.f) || (ret.v == 0.f) || (ret.w == 0.f)) {
+            ret.u = static_cast<float>(static_cast<double>(cx)*by - static_cast<double>(cy)*bx);
+            ret.v = static_cast<float>(static_cast<double>(ax)*cy - static_cast<double>(ay)*cx);
+            ret.w = static_cast<float>(static_cast<double>(bx)*ay - static_cast<double>(by)*ax);
+        }
+    }
+    return ret;
+}
+
+/** Returns true if the edge functions and the scaled t indicate a hit in front of the ray origin.
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr inline bool is_hit(EdgeFunctions<T> const& e, T det, T t_scaled)
+{
+    T const zero = traits::Constants<T>::Zero();
+    bool const has_negative = (e.u < zero) || (e.v < zero) || (e.w < zero);
+    bool const has_positive = (e.u > zero) || (e.v > zero) || (e.w > zero);
+    bool const is_in_front = (det < zero) ? (t_scaled <= zero) : (t_scaled >= zero);
+    return !(has_negative && has_positive) && (det != zero) && is_in_front;
+}
+}
+
+/** Watertight ray-triangle intersection.
+ * Rays hitting an edge or vertex shared by multiple triangles report a hit with at least one of them.
+ * Both front- and back-facing triangles are reported. Returns std::nullopt if there is no intersection
+ * at t >= 0. The returned t is in units of the length of the original line direction.
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<Triangle3Line3Intersection<T>> intersect(Triangle3<T> const& tri,
+                                                                            WatertightLine3<T> const& l)
+{
+    Vector3<T> const a = tri.a - l.p;
+    Vector3<T> const b = tri.b - l.p;
+    Vector3<T> const c = tri.c - l.p;
+    T const ax = a[l.kx] - l.sx * a[l.kz];
+    T const ay = a[l.ky] - l.sy * a[l.kz];
+    T const bx = b[l.kx] - l.sx * b[l.kz];
+    T const by = b[l.ky] - l.sy * b[l.kz];
+    T const cx = c[l.kx] - l.sx * c[l.kz];
+    T const cy = c[l.ky] - l.sy * c[l.kz];
+    triangle3_detail::EdgeFunctions<T> const e = triangle3_detail::evaluate_edge_functions(ax, ay, bx, by, cx, cy);
+    T const det = e.u + e.v + e.w;
+    T const t_scaled = e.u * (l.sz * a[l.kz]) + e.v * (l.sz * b[l.kz]) + e.w * (l.sz * c[l.kz]);
+    if(!triangle3_detail::is_hit(e, det, t_scaled)) {
+        return std::nullopt;
+    }
+    T const inv_det = traits::Constants<T>::One() / det;
+    return Triangle3Line3Intersection<T>{ t_scaled * inv_det, e.u * inv_det, e.v * inv_det, e.w * inv_det };
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<Triangle3Line3Intersection<T>> intersect(Triangle3<T> const& tri,
+                                                                            Line3<T> const& l)
+{
+    return intersect(tri, WatertightLine3<T>(l));
+}
+
+/** Returns the t value at which the ray intersects the triangle, or std::nullopt if there is no intersection.
+ * @see intersect()
+ */
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> intersect_p(Triangle3<T> const& tri, WatertightLine3<T> const& l)
+{
+    auto const is = intersect(tri, l);
+    if(!is) { return std::nullopt; }
+    return is->t;
+}
+
+template<std::floating_point T>
+[[nodiscard]] inline std::optional<T> intersect_p(Triangle3<T> const& tri, Line3<T> const& l)
+{
+    return intersect_p(tri, WatertightLine3<T>(l));
+}
+}
+#endif
@@ -0,0 +1,215 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TRIANGLE_MESH_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_TRIANGLE_MESH_HPP
+
+/** @file
+*
+* @brief Triangle soup in structure-of-arrays layout.
+* @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+*/
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Line3.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Triangle3.hpp>
+#include <gbMath/Vector3.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** A set of triangles stored in structure-of-arrays layout.
+ * Each coordinate of each vertex is stored in its own contiguous array, so that intersection tests can
+ * process multiple triangles at once.
+ * To use the mesh with a bounding volume hierarchy, build the hierarchy over bounds(), then use permute()
+ * to reorder the triangles so that the triangles of each leaf form a contiguous index range. Leaves can
+ * then be tested with the range overload of intersect_nearest().
+ */
+template<std::floating_point T>
+class TriangleMesh {
+public:
+    using ValueType = T;
+private:
+    std::array<std::vector<T>, 9> m_coordinates;
+public:
+    TriangleMesh() = default;
+
+    explicit TriangleMesh(std::span<Triangle3<T> const> triangles)
+    {
+        reserve(triangles.size());
+        for (auto const& tri : triangles) {
+            push_back(tri);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_coordinates[0].size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_coordinates[0].empty();
+    }
+
+    void reserve(std::size_t n)
+    {
+        for (auto& c : m_coordinates) { c.reserve(n); }
+    }
+
+    void clear()
+    {
+        for (auto& c : m_coordinates) { c.clear(); }
+    }
+
+    void push_back(Triangle3<T> const& tri)
+    {
+        Point3<T> const* vertices[] = { &tri.a, &tri.b, &tri.c };
+        for (std::size_t vertex = 0; vertex < 3; ++vertex) {
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                m_coordinates[vertex * 3 + axis].push_back((*vertices[vertex])[axis]);
+            }
+        }
+    }
+
+    [[nodiscard]] Triangle3<T> operator[](std::size_t idx) const
+    {
+        auto const vertex = [this, idx](std::size_t v) {
+            return Point3<T>(m_coordinates[v * 3][idx], m_coordinates[v * 3 + 1][idx], m_coordinates[v * 3 + 2][idx]);
+        };
+        return Triangle3<T>(vertex(0), vertex(1), vertex(2));
+    }
+
+    /** The coordinates along axis (0 = x, 1 = y, 2 = z) of vertex (0 = a, 1 = b, 2 = c) of all triangles.
+     */
+    [[nodiscard]] std::span<T const> coordinates(std::size_t vertex, std::size_t axis) const
+    {
+        assert((vertex < 3) && (axis < 3));
+        return m_coordinates[vertex * 3 + axis];
+    }
+
+    [[nodiscard]] AABB3<T> bounds(std::size_t idx) const
+    {
+        return ::GHULBUS_MATH_NAMESPACE::bounds((*this)[idx]);
+    }
+
+    /** Reorders the triangles such that the triangle previously at index order[i] is moved to index i.
+     * @pre order is a permutation of [0, size()).
+     */
+    void permute(std::span<std::size_t const> order)
+    {
+        assert(order.size() == size());
+        std::vector<T> tmp(size());
+        for (auto& c : m_coordinates) {
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                tmp[i] = c[order[i]];
+            }
+            c.swap(tmp);
+        }
+    }
+};
+
+/** The nearest triangle hit by a ray.
+ */
+template<typename T>
+struct TriangleMeshHit {
+    std::size_t index;                          ///< Index of the triangle that was hit.
+    Triangle3Line3Intersection<T> intersection;
+};
+
+/** Finds the triangle in the index range [first, last) that the ray hits first.
+ * Only hits with t < t_max are considered, which allows culling triangles behind the closest hit found so far
+ * when traversing a hierarchy. If multiple triangles are hit at the same t, the one with the lowest index
+ * is returned. The results are the same as those of intersect() for the individual triangles.
+ * Triangles are processed in blocks of W. The loops over a block are branch-free, which allows the compiler
+ * to vectorize them; W should usually be chosen to match the native SIMD width, i.e. 4 or 8.
+ * @pre first <= last <= mesh.size()
+ */
+template<std::floating_point T, std::size_t W = 8>
+[[nodiscard]] inline std::optional<TriangleMeshHit<T>> intersect_nearest(WatertightLine3<T> const& l,
+                                                                         TriangleMesh<T> const& mesh,
+                                                                         std::size_t first, std::size_t last,
+                                                                         T t_max = std::numeric_limits<T>::infinity())
+{
+    assert((first <= last) && (last <= mesh.size()));
+    T const* const vertex_x[] = { mesh.coordinates(0, l.kx).data(), mesh.coordinates(1, l.kx).data(),
+                                  mesh.coordinates(2, l.kx).data() };
+    T const* const vertex_y[] = { mesh.coordinates(0, l.ky).data(), mesh.coordinates(1, l.ky).data(),
+                                  mesh.coordinates(2, l.ky).data() };
+    T const* const vertex_z[] = { mesh.coordinates(0, l.kz).data(), mesh.coordinates(1, l.kz).data(),
+                                  mesh.coordinates(2, l.kz).data() };
+    T const px = l.p[l.kx];
+    T const py = l.p[l.ky];
+    T const pz = l.p[l.kz];
+
+    std::optional<TriangleMeshHit<T>> ret;
+    for (std::size_t block = first; block < last; block += W) {
+        std::size_t const count = std::min(W, last - block);
+        // sheared vertex coordinates; lanes past the end of the range duplicate the last triangle
+        std::array<T, W> x[3];
+        std::array<T, W> y[3];
+        std::array<T, W> z[3];
+        for (std::size_t v = 0; v < 3; ++v) {
+            for (std::size_t j = 0; j < W; ++j) {
+                std::size_t const i = block + std::min(j, count - 1);
+                T const dz = vertex_z[v][i] - pz;
+                x[v][j] = (vertex_x[v][i] - px) - l.sx * dz;
+                y[v][j] = (vertex_y[v][i] - py) - l.sy * dz;
+                z[v][j] = l.sz * dz;
+            }
+        }
+        std::array<triangle3_detail::EdgeFunctions<T>, W> e;
+        for (std::size_t j = 0; j < W; ++j) {
+            e[j] = triangle3_detail::EdgeFunctions<T>{ x[2][j]*y[1][j] - y[2][j]*x[1][j],
+                                                       x[0][j]*y[2][j] - y[0][j]*x[2][j],
+                                                       x[1][j]*y[0][j] - y[1][j]*x[0][j] };
+        }
+        if constexpr (std::same_as<T, float>) {
+            // rare case: recompute edge functions that evaluated to 0 in higher precision
+            for (std::size_t j = 0; j < count; ++j) {
+                if ((e[j].u == 0.f) || (e[j].v == 0.f) || (e[j].w == 0.f)) {
+                    e[j] = triangle3_detail::evaluate_edge_functions(x[0][j], y[0][j], x[1][j], y[1][j],
+                                                                      x[2][j], y[2][j]);
+                }
+            }
+        }
+        std::array<T, W> det;
+        std::array<T, W> t_scaled;
+        for (std::size_t j = 0; j < W; ++j) {
+            det[j] = e[j].u + e[j].v + e[j].w;
+            t_scaled[j] = e[j].u * z[0][j] + e[j].v * z[1][j] + e[j].w * z[2][j];
+        }
+        for (std::size_t j = 0; j < count; ++j) {
+            if (triangle3_detail::is_hit(e[j], det[j], t_scaled[j])) {
+                T const inv_det = traits::Constants<T>::One() / det[j];
+                T const t = t_scaled[j] * inv_det;
+                if (t < t_max) {
+                    t_max = t;
+                    ret = TriangleMeshHit<T>{ block + j,
+                        Triangle3Line3Intersection<T>{ t, e[j].u * inv_det, e[j].v * inv_det, e[j].w * inv_det } };
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+/** Finds the triangle in the mesh that the ray hits first.
+ */
+template<std::floating_point T, std::size_t W = 8>
+[[nodiscard]] inline std::optional<TriangleMeshHit<T>> intersect_nearest(WatertightLine3<T> const& l,
+                                                                         TriangleMesh<T> const& mesh)
+{
+    return intersect_nearest<T, W>(l, mesh, 0, mesh.size());
+}
+}
+#endif
@@ -258,6 +258,17 @@ template<std::floating_point T, std::size_t N>
     return v / len;
 }
 
+/** Fast approximation of normalized().
+ * Scales by the approximate reciprocal length from rsqrt_fast(), so for float the length of the result
+ * deviates from 1 by less than 1e-5.
+ * @pre v != 0
+ */
+template<std::floating_point T, std::size_t N>
+[[nodiscard]] inline Vector<T, N> normalized_fast(Vector<T, N> const& v)
+{
+    return v * rsqrt_fast(dot(v, v));
+}
+
 template<typename T, std::size_t N>
 [[nodiscard]] constexpr inline T max_component(Vector<T, N> const& v)
 {
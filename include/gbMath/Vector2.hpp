@@ -272,6 +272,19 @@ template<std::floating_point T, typename VectorTag_T>
     return Vector2Impl<T, VectorTag_T>(v.x / len, v.y / len);
 }
 
+/** Fast approximation of normalized().
+ * Scales by the approximate reciprocal length from rsqrt_fast(), so for float the length of the result
+ * deviates from 1 by less than 1e-5. Unlike normalized(), this does not guard against overflow when squaring
+ * the components.
+ * @pre v != 0
+ */
+template<std::floating_point T, typename VectorTag_T>
+[[nodiscard]] inline Vector2Impl<T, VectorTag_T> normalized_fast(Vector2Impl<T, VectorTag_T> const& v)
+{
+    T const inv_len = rsqrt_fast(dot(v, v));
+    return Vector2Impl<T, VectorTag_T>(v.x * inv_len, v.y * inv_len);
+}
+
 /** Computes the counter-clockwise perpendicular normal.
  */
 template<typename T>
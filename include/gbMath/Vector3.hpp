@@ -277,6 +277,19 @@ template<std::floating_point T, typename VectorTag_T>
     return Vector3Impl<T, VectorTag_T>(v.x / len, v.y / len, v.z / len);
 }
 
+/** Fast approximation of normalized().
+ * Scales by the approximate reciprocal length from rsqrt_fast(), so for float the length of the result
+ * deviates from 1 by less than 1e-5. Unlike normalized(), this does not guard against overflow when squaring
+ * the components.
+ * @pre v != 0
+ */
+template<std::floating_point T, typename VectorTag_T>
+[[nodiscard]] inline Vector3Impl<T, VectorTag_T> normalized_fast(Vector3Impl<T, VectorTag_T> const& v)
+{
+    T const inv_len = rsqrt_fast(dot(v, v));
+    return Vector3Impl<T, VectorTag_T>(v.x * inv_len, v.y * inv_len, v.z * inv_len);
+}
+
 /** Computes a normal perpendicular to two other vectors, oriented in the natural handedness of the coordinate system.
  */
 template<typename T>
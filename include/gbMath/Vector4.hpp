@@ -174,6 +174,18 @@ template<std::floating_point T>
     return Vector4<T>(v.x / len, v.y / len, v.z / len, v.w / len);
 }
 
+/** Fast approximation of normalized().
+ * Scales by the approximate reciprocal length from rsqrt_fast(), so for float the length of the result
+ * deviates from 1 by less than 1e-5.
+ * @pre v != 0
+ */
+template<std::floating_point T>
+[[nodiscard]] inline Vector4<T> normalized_fast(Vector4<T> const& v)
+{
+    T const inv_len = rsqrt_fast(dot(v, v));
+    return Vector4<T>(v.x * inv_len, v.y * inv_len, v.z * inv_len, v.w * inv_len);
+}
+
 
 template<typename T>
 [[nodiscard]] constexpr inline T max_component(Vector4<T> const& v)
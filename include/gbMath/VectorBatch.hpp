@@ -0,0 +1,121 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_VECTOR_BATCH_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_VECTOR_BATCH_HPP
+
+/** @file
+ *
+ * @brief Batched operations over arrays of vectors.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/AABB3.hpp>
+#include <gbMath/Common.hpp>
+#include <gbMath/Transform3.hpp>
+#include <gbMath/Vector2.hpp>
+#include <gbMath/Vector3.hpp>
+#include <gbMath/Vector4.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** @name Batched fast normalization.
+ * Applies normalized_fast() to each element of a span, with the same accuracy and preconditions.
+ * The loop bodies are branch-free, which allows the compiler to vectorize them.
+ * The output span must be at least as large as the input span. Input and output may alias.
+ */
+///@{
+template<std::floating_point T, typename VectorTag_T>
+inline void normalized_fast(std::span<Vector2Impl<T, VectorTag_T> const> vectors,
+                            std::span<Vector2Impl<T, VectorTag_T>> normalized)
+{
+    assert(normalized.size() >= vectors.size());
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        normalized[i] = normalized_fast(vectors[i]);
+    }
+}
+
+template<std::floating_point T, typename VectorTag_T>
+inline void normalized_fast(std::span<Vector3Impl<T, VectorTag_T> const> vectors,
+                            std::span<Vector3Impl<T, VectorTag_T>> normalized)
+{
+    assert(normalized.size() >= vectors.size());
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        normalized[i] = normalized_fast(vectors[i]);
+    }
+}
+
+template<std::floating_point T>
+inline void normalized_fast(std::span<Vector4<T> const> vectors, std::span<Vector4<T>> normalized)
+{
+    assert(normalized.size() >= vectors.size());
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        normalized[i] = normalized_fast(vectors[i]);
+    }
+}
+///@}
+
+/** @name Batched in-place fast normalization.
+ * Replaces each element of a span with the result of normalized_fast().
+ */
+///@{
+template<std::floating_point T, typename VectorTag_T>
+inline void normalize_fast(std::span<Vector2Impl<T, VectorTag_T>> vectors)
+{
+    for (auto& v : vectors) {
+        v = normalized_fast(v);
+    }
+}
+
+template<std::floating_point T, typename VectorTag_T>
+inline void normalize_fast(std::span<Vector3Impl<T, VectorTag_T>> vectors)
+{
+    for (auto& v : vectors) {
+        v = normalized_fast(v);
+    }
+}
+
+template<std::floating_point T>
+inline void normalize_fast(std::span<Vector4<T>> vectors)
+{
+    for (auto& v : vectors) {
+        v = normalized_fast(v);
+    }
+}
+///@}
+
+/** Batched transformation.
+ * Applies t to each element of a span, with the semantics of Transform3::operator*: Points are affected by the
+ * translation of t, all other vector types are not.
+ * The output span must be at least as large as the input span. Input and output may alias.
+ */
+template<typename T, typename VectorTag_T>
+inline void transform(Transform3<T> const& t, std::span<Vector3Impl<T, VectorTag_T> const> vectors,
+                      std::span<Vector3Impl<T, VectorTag_T>> transformed)
+{
+    assert(transformed.size() >= vectors.size());
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        transformed[i] = t * vectors[i];
+    }
+}
+
+/** Bounding box of a span of points after transformation by t.
+ * Equivalent to transforming the points and calling AABB3::from_points() on the result, but without
+ * storage for the transformed points, so it can process inputs of any size in a single pass.
+ */
+template<typename T>
+[[nodiscard]] inline AABB3<T> transformed_bounds(Transform3<T> const& t, std::span<Point3<T> const> points)
+{
+    AABB3<T> ret = empty_aabb3<T>();
+    for (Point3<T> const& p : points) {
+        ret = enclose(ret, t * p);
+    }
+    return ret;
+}
+}
+
+#endif
@@ -8,30 +8,25 @@
  */
 
 #include <gbMath/config.hpp>
+#include <gbMath/FormatIO.hpp>
 #include <gbMath/Vector2.hpp>
 
 #include <ostream>
 #include <version>
 
 #ifdef __cpp_lib_format
-#include <concepts>
+#include <array>
 #include <format>
 
 template<class T, typename VectorTag_T, class Char_T>
 struct std::formatter<GHULBUS_MATH_NAMESPACE::Vector2Impl<T, VectorTag_T>, Char_T>
+    : public GHULBUS_MATH_NAMESPACE::format_detail::ElementFormatter<T, Char_T>
 {
-    constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
-    }
-
     template<class FormatContext>
     auto format(GHULBUS_MATH_NAMESPACE::Vector2Impl<T, VectorTag_T> const& v, FormatContext& ctx) const
     {
-        if constexpr (std::same_as<T, char>) {
-            return std::format_to(ctx.out(), "[{} {}]", static_cast<int>(v.x), static_cast<int>(v.y));
-        } else {
-            return std::format_to(ctx.out(), "[{} {}]", v.x, v.y);
-        }
+        this->write_list(std::array<T, 2>{ v.x, v.y }, ctx);
+        return ctx.out();
     }
 };
 
@@ -40,7 +35,7 @@ namespace GHULBUS_MATH_NAMESPACE
 template<typename T, typename VectorTag_T>
 inline std::ostream& operator<<(std::ostream& os, Vector2Impl<T, VectorTag_T> const& rhs)
 {
-    return os << std::format("{}", rhs);
+    return format_detail::insert_formatted(os, rhs);
 }
 }
 
@@ -8,31 +8,25 @@
  */
 
 #include <gbMath/config.hpp>
+#include <gbMath/FormatIO.hpp>
 #include <gbMath/Vector4.hpp>
 
 #include <ostream>
 #include <version>
 
 #ifdef __cpp_lib_format
-#include <concepts>
+#include <array>
 #include <format>
 
 template<class T, class Char_T>
 struct std::formatter<GHULBUS_MATH_NAMESPACE::Vector4<T>, Char_T>
+    : public GHULBUS_MATH_NAMESPACE::format_detail::ElementFormatter<T, Char_T>
 {
-    constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
-    }
-
     template<class FormatContext>
     auto format(GHULBUS_MATH_NAMESPACE::Vector4<T> const& v, FormatContext& ctx) const
     {
-        if constexpr (std::same_as<T, char>) {
-            return std::format_to(ctx.out(), "[{} {} {} {}]",
-                static_cast<int>(v.x), static_cast<int>(v.y), static_cast<int>(v.z), static_cast<int>(v.w));
-        } else {
-            return std::format_to(ctx.out(), "[{} {} {} {}]", v.x, v.y, v.z, v.w);
-        }
+        this->write_list(std::array<T, 4>{ v.x, v.y, v.z, v.w }, ctx);
+        return ctx.out();
     }
 };
 
@@ -41,7 +35,7 @@ namespace GHULBUS_MATH_NAMESPACE
 template<typename T>
 inline std::ostream& operator<<(std::ostream& os, Vector4<T> const& rhs)
 {
-    return os << std::format("{}", rhs);
+    return format_detail::insert_formatted(os, rhs);
 }
 }
 
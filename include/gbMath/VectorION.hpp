@@ -8,38 +8,25 @@
  */
 
 #include <gbMath/config.hpp>
+#include <gbMath/FormatIO.hpp>
 #include <gbMath/Vector.hpp>
 
 #include <ostream>
 #include <version>
 
 #ifdef __cpp_lib_format
-#include <concepts>
+#include <array>
 #include <format>
 
 template<class T, std::size_t N, class Char_T>
 struct std::formatter<GHULBUS_MATH_NAMESPACE::Vector<T, N>, Char_T>
+    : public GHULBUS_MATH_NAMESPACE::format_detail::ElementFormatter<T, Char_T>
 {
-    constexpr auto parse(std::format_parse_context& ctx) {
-        return ctx.begin();
-    }
-
     template<class FormatContext>
     auto format(GHULBUS_MATH_NAMESPACE::Vector<T, N> const& v, FormatContext& ctx) const
     {
-        if constexpr (std::same_as<T, char>) {
-            std::format_to(ctx.out(), "[{}", static_cast<int>(v.v[0]));
-        } else {
-            std::format_to(ctx.out(), "[{}", v.v[0]);
-        }
-        for (std::size_t i = 1; i < N; ++i) {
-            if constexpr (std::same_as<T, char>) {
-                std::format_to(ctx.out(), " {}", static_cast<int>(v.v[i]));
-            } else {
-                std::format_to(ctx.out(), " {}", v.v[i]);
-            }
-        }
-        return std::format_to(ctx.out(), "]");
+        this->write_list(v.v, ctx);
+        return ctx.out();
     }
 };
 
@@ -48,7 +35,7 @@ namespace GHULBUS_MATH_NAMESPACE
 template<typename T, std::size_t N>
 inline std::ostream& operator<<(std::ostream& os, Vector<T, N> const& rhs)
 {
-    return os << std::format("{}", rhs);
+    return format_detail::insert_formatted(os, rhs);
 }
 }
 
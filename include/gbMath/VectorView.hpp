@@ -0,0 +1,211 @@
+#ifndef INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_VECTOR_VIEW_HPP
+#define INCLUDE_GUARD_GHULBUS_LIBRARY_MATH_VECTOR_VIEW_HPP
+
+/** @file
+ *
+ * @brief Non-owning view of an N-dimensional Vector.
+ * @author Andreas Weis (der_ghulbus@ghulbus-inc.de)
+ */
+
+#include <gbMath/config.hpp>
+
+#include <gbMath/Common.hpp>
+#include <gbMath/NumberTypeTraits.hpp>
+#include <gbMath/Vector.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace GHULBUS_MATH_NAMESPACE
+{
+/** Non-owning view of N elements in external memory, that are spaced `stride` elements apart.
+ * Like std::span, the view does not propagate constness. Use a const element type T for read-only views.
+ * Copying a view copies the reference, not the elements. Use assign() to write through the view.
+ * Operations that produce new values return an owning Vector.
+ */
+template<typename T, std::size_t N>
+class VectorView {
+public:
+    using ValueType = std::remove_cv_t<T>;
+    using ElementType = T;
+    static_assert(N > 0, "Vector must have at least one component.");
+    using Dimension = std::integral_constant<std::size_t, N>;
+
+    T* data;
+    std::ptrdiff_t stride;
+
+    constexpr explicit VectorView(T* n_data, std::ptrdiff_t n_stride = 1)
+        :data(n_data), stride(n_stride)
+    {}
+
+    constexpr VectorView(Vector<ValueType, N>& vec)
+        :data(vec.v.data()), stride(1)
+    {}
+
+    constexpr VectorView(Vector<ValueType, N> const& vec) requires(std::is_const_v<T>)
+        :data(vec.v.data()), stride(1)
+    {}
+
+    template<typename U>
+    constexpr VectorView(VectorView<U, N> const& other) requires(std::is_convertible_v<U*, T*>)
+        :data(other.data), stride(other.stride)
+    {}
+
+    constexpr VectorView(VectorView const&) = default;
+    constexpr VectorView& operator=(VectorView const&) = default;
+
+    [[nodiscard]] constexpr std::size_t dimension() const
+    {
+        return N;
+    }
+
+    [[nodiscard]] constexpr T& operator[](std::size_t idx) const
+    {
+        return data[static_cast<std::ptrdiff_t>(idx) * stride];
+    }
+
+    /** Copies the viewed elements into an owning Vector.
+     */
+    [[nodiscard]] constexpr Vector<ValueType, N> to_vector() const
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = (*this)[i];
+        }
+        return ret;
+    }
+
+    /** Overwrites the viewed elements with the elements of rhs.
+     */
+    constexpr VectorView const& assign(VectorView<ValueType const, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] = rhs[i];
+        }
+        return *this;
+    }
+
+    constexpr VectorView const& operator+=(VectorView<ValueType const, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] += rhs[i];
+        }
+        return *this;
+    }
+
+    constexpr VectorView const& operator-=(VectorView<ValueType const, N> const& rhs) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] -= rhs[i];
+        }
+        return *this;
+    }
+
+    constexpr VectorView const& operator*=(ValueType s) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] *= s;
+        }
+        return *this;
+    }
+
+    constexpr VectorView const& operator/=(ValueType s) const
+        requires(!std::is_const_v<T>)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            (*this)[i] /= s;
+        }
+        return *this;
+    }
+
+    /** Element-wise comparison of the viewed values.
+     */
+    [[nodiscard]] friend constexpr bool operator==(VectorView const& lhs, VectorView const& rhs)
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!(lhs[i] == rhs[i])) { return false; }
+        }
+        return true;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator-(VectorView const& lhs)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = -lhs[i];
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator+(VectorView const& lhs, VectorView const& rhs)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = lhs[i] + rhs[i];
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator-(VectorView const& lhs, VectorView const& rhs)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = lhs[i] - rhs[i];
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator*(VectorView const& v, ValueType s)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = v[i] * s;
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator*(ValueType s, VectorView const& v)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = s * v[i];
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr Vector<ValueType, N> operator/(VectorView const& v, ValueType s)
+    {
+        Vector<ValueType, N> ret(doNotInitialize);
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[i] = v[i] / s;
+        }
+        return ret;
+    }
+
+    [[nodiscard]] friend constexpr ValueType dot(VectorView const& lhs, VectorView const& rhs)
+    {
+        ValueType acc = traits::Constants<ValueType>::Zero();
+        for (std::size_t i = 0; i < N; ++i) {
+            acc += lhs[i] * rhs[i];
+        }
+        return acc;
+    }
+};
+
+/** Deduction guide for views of Vector.
+ */
+///@{
+template<typename T, std::size_t N>
+VectorView(Vector<T, N>&) -> VectorView<T, N>;
+
+template<typename T, std::size_t N>
+VectorView(Vector<T, N> const&) -> VectorView<T const, N>;
+///@}
+}
+
+#endif
@@ -3,6 +3,9 @@
 
 #include <catch.hpp>
 
+#include <span>
+#include <vector>
+
 TEST_CASE("AABB2")
 {
     using GHULBUS_MATH_NAMESPACE::AABB2;
@@ -115,6 +118,11 @@ TEST_CASE("AABB2")
                                                        Point2<float>(1.f, -1.f), Point2<float>(3.f, 1.f)});
         CHECK(aabb.min == Point2<float>(0.f, -1.f));
         CHECK(aabb.max == Point2<float>(3.f, 5.f));
+
+        std::vector<Point2<float>> const points{ Point2<float>(1.f,  2.f), Point2<float>(0.f, 5.f),
+                                                 Point2<float>(1.f, -1.f), Point2<float>(3.f, 1.f) };
+        CHECK(AABB2<float>::from_points(points) == aabb);
+        CHECK(AABB2<float>::from_points(std::span<Point2<float> const>(points)) == aabb);
     }
 
     SECTION("Enclose encloses two volumes into one")
@@ -159,6 +167,17 @@ TEST_CASE("AABB2")
                          AABB2<float>(Point2<float>(1.f, 2.f), Point2<float>(2.f, 3.f))));
     }
 
+    SECTION("AABB-Point closest point and distance")
+    {
+        AABB2<float> const box(Point2<float>(1.f, 2.f), Point2<float>(2.f, 3.f));
+        CHECK(closest_point(box, Point2<float>(1.5f, 2.5f)) == Point2<float>(1.5f, 2.5f));
+        CHECK(closest_point(box, Point2<float>(0.f, 2.5f)) == Point2<float>(1.f, 2.5f));
+        CHECK(closest_point(box, Point2<float>(4.f, 5.f)) == Point2<float>(2.f, 3.f));
+        CHECK(distance_squared(box, Point2<float>(1.5f, 2.5f)) == 0.f);
+        CHECK(distance_squared(box, Point2<float>(0.f, 2.5f)) == 1.f);
+        CHECK(distance_squared(box, Point2<float>(4.f, 5.f)) == 8.f);
+    }
+
     SECTION("AABB-AABB Union")
     {
         CHECK(union_aabb(AABB2<float>(Point2<float>(1.f, 2.f), Point2<float>(2.f, 3.f)),
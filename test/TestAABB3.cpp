@@ -3,6 +3,9 @@
 
 #include <catch.hpp>
 
+#include <span>
+#include <vector>
+
 TEST_CASE("AABB3")
 {
     using GHULBUS_MATH_NAMESPACE::AABB3;
@@ -124,6 +127,11 @@ TEST_CASE("AABB3")
                                                        Point3<float>(1.f, -1.f, 2.f), Point3<float>(3.f, 1.f, -3.f)});
         CHECK(aabb.min == Point3<float>(0.f, -1.f, -3.f));
         CHECK(aabb.max == Point3<float>(3.f, 5.f, 3.f));
+
+        std::vector<Point3<float>> const points{ Point3<float>(1.f,  2.f, 3.f), Point3<float>(0.f, 5.f, 1.f),
+                                                 Point3<float>(1.f, -1.f, 2.f), Point3<float>(3.f, 1.f, -3.f) };
+        CHECK(AABB3<float>::from_points(points) == aabb);
+        CHECK(AABB3<float>::from_points(std::span<Point3<float> const>(points)) == aabb);
     }
 
     SECTION("Enclose encloses two volumes into one")
@@ -200,4 +208,35 @@ TEST_CASE("AABB3")
                              AABB3<float>(Point3<float>(-1.f, 1.f, 5.f), Point3<float>(4.f, 2.f, 6.f))) ==
               AABB3<float>(Point3<float>(1.f, 2.f, 5.f), Point3<float>(2.f, 2.f, 4.f)));
     }
+
+    SECTION("AABB-Point closest point and distance")
+    {
+        AABB3<int> const b(Point3<int>(0, 0, 0), Point3<int>(4, 6, 8));
+        CHECK(closest_point(b, Point3<int>(1, 2, 3)) == Point3<int>(1, 2, 3));
+        CHECK(closest_point(b, Point3<int>(-1, 7, 3)) == Point3<int>(0, 6, 3));
+        CHECK(closest_point(b, Point3<int>(10, -10, 10)) == Point3<int>(4, 0, 8));
+        CHECK(distance_squared(b, Point3<int>(1, 2, 3)) == 0);
+        CHECK(distance_squared(b, Point3<int>(-1, 7, 3)) == 2);
+        CHECK(distance_squared(b, Point3<int>(10, -10, 10)) == 36 + 100 + 4);
+    }
+
+    SECTION("AABB-Point signed distance")
+    {
+        AABB3<float> const b(Point3<float>(0.f, 0.f, 0.f), Point3<float>(4.f, 6.f, 8.f));
+        CHECK(signed_distance(b, Point3<float>(1.f, 3.f, 4.f)) == -1.f);
+        CHECK(signed_distance(b, Point3<float>(2.f, 3.f, 4.f)) == -2.f);
+        CHECK(signed_distance(b, Point3<float>(4.f, 3.f, 4.f)) == 0.f);
+        CHECK(signed_distance(b, Point3<float>(7.f, 3.f, 4.f)) == 3.f);
+        CHECK(signed_distance(b, Point3<float>(7.f, 10.f, 4.f)) == 5.f);
+    }
+
+    SECTION("AABB-AABB distance")
+    {
+        AABB3<int> const b(Point3<int>(0, 0, 0), Point3<int>(4, 6, 8));
+        CHECK(distance_squared(b, AABB3<int>(Point3<int>(1, 1, 1), Point3<int>(10, 10, 10))) == 0);
+        CHECK(distance_squared(b, AABB3<int>(Point3<int>(4, 6, 8), Point3<int>(10, 10, 10))) == 0);
+        CHECK(distance_squared(b, AABB3<int>(Point3<int>(5, 1, 1), Point3<int>(10, 2, 2))) == 1);
+        CHECK(distance_squared(b, AABB3<int>(Point3<int>(-10, -10, 10), Point3<int>(-2, -3, 12))) == 4 + 9 + 4);
+        CHECK(distance_squared(AABB3<int>(Point3<int>(-10, -10, 10), Point3<int>(-2, -3, 12)), b) == 4 + 9 + 4);
+    }
 }
@@ -0,0 +1,322 @@
+#include <gbMath/BinaryIO.hpp>
+#include <gbMath/VectorIO3.hpp>
+
+#include <catch.hpp>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+template<typename T>
+std::vector<T> binary_round_trip(std::vector<T> const& values, std::endian byte_order)
+{
+    using GHULBUS_MATH_NAMESPACE::binary_size_v;
+    std::vector<std::byte> buffer(values.size() * binary_size_v<T>);
+    CHECK(GHULBUS_MATH_NAMESPACE::write_binary(std::span<T const>(values), std::span<std::byte>(buffer),
+                                               byte_order) == buffer.size());
+    std::vector<T> ret(values.size());
+    CHECK(GHULBUS_MATH_NAMESPACE::read_binary(std::span<std::byte const>(buffer), std::span<T>(ret),
+                                              byte_order) == buffer.size());
+    return ret;
+}
+}
+
+TEST_CASE("BinaryIO")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB2;
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::BinaryHeader;
+    using GHULBUS_MATH_NAMESPACE::BinaryScalarKind;
+    using GHULBUS_MATH_NAMESPACE::binary_size_v;
+    using GHULBUS_MATH_NAMESPACE::Circle2;
+    using GHULBUS_MATH_NAMESPACE::is_binary_memcpyable_v;
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::Matrix2;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::Matrix4;
+    using GHULBUS_MATH_NAMESPACE::OBB3;
+    using GHULBUS_MATH_NAMESPACE::Plane3;
+    using GHULBUS_MATH_NAMESPACE::Point2;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Transform2;
+    using GHULBUS_MATH_NAMESPACE::Transform3;
+    using GHULBUS_MATH_NAMESPACE::Triangle3;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::Vector4;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order;
+
+    SECTION("Binary sizes")
+    {
+        static_assert(binary_size_v<float> == 4);
+        static_assert(binary_size_v<Vector2<std::int16_t>> == 4);
+        static_assert(binary_size_v<Point3<float>> == 12);
+        static_assert(binary_size_v<Vector4<double>> == 32);
+        static_assert(binary_size_v<Vector<float, 5>> == 20);
+        static_assert(binary_size_v<Matrix3<float>> == 36);
+        static_assert(binary_size_v<Matrix<double, 2, 3, Order::ColumnMajor>> == 48);
+        static_assert(binary_size_v<Transform3<float>> == 64);
+        static_assert(binary_size_v<AABB3<float>> == 24);
+        static_assert(binary_size_v<Sphere3<double>> == 32);
+        static_assert(binary_size_v<OBB3<float>> == 60);
+        static_assert(binary_size_v<Plane3<float>> == 16);
+        static_assert(binary_size_v<Triangle3<float>> == 36);
+        static_assert(is_binary_memcpyable_v<Vector3<float>>);
+        static_assert(is_binary_memcpyable_v<Matrix4<double>>);
+        static_assert(is_binary_memcpyable_v<AABB3<float>>);
+        static_assert(is_binary_memcpyable_v<Matrix<float, 1, 3, Order::ColumnMajor>>);
+        static_assert(!is_binary_memcpyable_v<Matrix<double, 2, 3, Order::ColumnMajor>>);
+    }
+
+    SECTION("Byte order of the payload")
+    {
+        Vector2<std::uint16_t> const v(0x0102, 0x0304);
+        std::array<std::byte, 4> buffer;
+        GHULBUS_MATH_NAMESPACE::write_binary(std::span<Vector2<std::uint16_t> const>(&v, 1), buffer,
+                                             std::endian::little);
+        CHECK(buffer == std::array<std::byte, 4>{ std::byte{ 2 }, std::byte{ 1 }, std::byte{ 4 }, std::byte{ 3 } });
+        GHULBUS_MATH_NAMESPACE::write_binary(std::span<Vector2<std::uint16_t> const>(&v, 1), buffer,
+                                             std::endian::big);
+        CHECK(buffer == std::array<std::byte, 4>{ std::byte{ 1 }, std::byte{ 2 }, std::byte{ 3 }, std::byte{ 4 } });
+
+        float const f = 1.0f;
+        std::array<std::byte, 4> fbuffer;
+        GHULBUS_MATH_NAMESPACE::write_binary(std::span<float const>(&f, 1), fbuffer, std::endian::big);
+        CHECK(fbuffer == std::array<std::byte, 4>{ std::byte{ 0x3f }, std::byte{ 0x80 },
+                                                    std::byte{ 0 }, std::byte{ 0 } });
+    }
+
+    for (std::endian const byte_order : { std::endian::little, std::endian::big }) {
+        SECTION(std::string("Round trip ") + ((byte_order == std::endian::little) ? "little" : "big") + "-endian")
+        {
+            std::vector<Vector3<float>> const vectors{ Vector3<float>(1, 2, 3), Vector3<float>(-4.5f, 0, 1e30f) };
+            CHECK(binary_round_trip(vectors, byte_order) == vectors);
+
+            std::vector<Point2<std::int32_t>> const points{ Point2<std::int32_t>(-1, 2), Point2<std::int32_t>(3, 4) };
+            CHECK(binary_round_trip(points, byte_order) == points);
+
+            std::vector<Vector4<double>> const vectors4{ Vector4<double>(1, 2, 3, 4) };
+            CHECK(binary_round_trip(vectors4, byte_order) == vectors4);
+
+            std::vector<Vector<float, 5>> const vectors5{ Vector<float, 5>(1.f, 2.f, 3.f, 4.f, 5.f) };
+            CHECK(binary_round_trip(vectors5, byte_order) == vectors5);
+
+            std::vector<Matrix2<float>> const matrices2{ Matrix2<float>(1, 2, 3, 4) };
+            CHECK(binary_round_trip(matrices2, byte_order) == matrices2);
+
+            std::vector<Matrix3<double>> const matrices3{ Matrix3<double>(1, 2, 3, 4, 5, 6, 7, 8, 9) };
+            CHECK(binary_round_trip(matrices3, byte_order) == matrices3);
+
+            std::vector<Matrix4<float>> const matrices4{
+                Matrix4<float>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16) };
+            CHECK(binary_round_trip(matrices4, byte_order) == matrices4);
+
+            std::vector<Matrix<double, 2, 3, Order::ColumnMajor>> const matrices_n{
+                Matrix<double, 2, 3, Order::ColumnMajor>(1., 2., 3., 4., 5., 6.) };
+            CHECK(binary_round_trip(matrices_n, byte_order) == matrices_n);
+
+            std::vector<Transform2<float>> const transforms2{ Transform2<float>(1, 2, 3, 4, 5, 6, 0, 0, 1) };
+            CHECK(binary_round_trip(transforms2, byte_order)[0].m == transforms2[0].m);
+
+            std::vector<Transform3<double>> const transforms3{
+                Transform3<double>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 0, 1) };
+            CHECK(binary_round_trip(transforms3, byte_order)[0].m == transforms3[0].m);
+
+            std::vector<AABB2<float>> const boxes2{ AABB2<float>(Point2<float>(-1, -2), Point2<float>(3, 4)) };
+            CHECK(binary_round_trip(boxes2, byte_order) == boxes2);
+
+            std::vector<AABB3<double>> const boxes3{
+                AABB3<double>(Point3<double>(-1, -2, -3), Point3<double>(4, 5, 6)) };
+            CHECK(binary_round_trip(boxes3, byte_order) == boxes3);
+
+            std::vector<Circle2<float>> const circles{ Circle2<float>(Point2<float>(1, 2), 3) };
+            auto const circles_read = binary_round_trip(circles, byte_order);
+            CHECK(circles_read[0].center == circles[0].center);
+            CHECK(circles_read[0].radius == circles[0].radius);
+
+            std::vector<Sphere3<double>> const spheres{ Sphere3<double>(Point3<double>(1, 2, 3), 4) };
+            auto const spheres_read = binary_round_trip(spheres, byte_order);
+            CHECK(spheres_read[0].center == spheres[0].center);
+            CHECK(spheres_read[0].radius == spheres[0].radius);
+
+            std::vector<OBB3<float>> const obbs{ OBB3<float>(Point3<float>(1, 2, 3),
+                                                             Matrix3<float>(0, -1, 0, 1, 0, 0, 0, 0, 1),
+                                                             Vector3<float>(4, 5, 6)) };
+            auto const obbs_read = binary_round_trip(obbs, byte_order);
+            CHECK(obbs_read[0].center == obbs[0].center);
+            CHECK(obbs_read[0].orientation == obbs[0].orientation);
+            CHECK(obbs_read[0].halfwidth == obbs[0].halfwidth);
+
+            std::vector<Plane3<float>> const planes{ Plane3<float>(Vector3<float>(0, 0, 1), 2.5f) };
+            CHECK(binary_round_trip(planes, byte_order) == planes);
+
+            std::vector<Triangle3<double>> const triangles{
+                Triangle3<double>(Point3<double>(1, 2, 3), Point3<double>(4, 5, 6), Point3<double>(7, 8, 9)) };
+            CHECK(binary_round_trip(triangles, byte_order) == triangles);
+        }
+    }
+
+    SECTION("Volumes are stored as the sequence of their scalars")
+    {
+        AABB3<float> const box(Point3<float>(1, 2, 3), Point3<float>(4, 5, 6));
+        std::array<std::byte, 24> box_bytes;
+        GHULBUS_MATH_NAMESPACE::write_binary(std::span<AABB3<float> const>(&box, 1), box_bytes, std::endian::big);
+        std::array<float, 6> scalars;
+        GHULBUS_MATH_NAMESPACE::read_binary(std::span<std::byte const>(box_bytes), std::span<float>(scalars),
+                                            std::endian::big);
+        CHECK(scalars == std::array<float, 6>{ 1, 2, 3, 4, 5, 6 });
+    }
+
+    SECTION("Matrices are stored in row-major order regardless of storage order")
+    {
+        using ColumnMajorMatrix3 = Matrix<float, 3, 3, Order::ColumnMajor>;
+        ColumnMajorMatrix3 const column_major(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f);
+        std::array<std::byte, 36> bytes;
+        GHULBUS_MATH_NAMESPACE::write_binary(std::span<ColumnMajorMatrix3 const>(&column_major, 1), bytes);
+        std::array<float, 9> scalars;
+        GHULBUS_MATH_NAMESPACE::read_binary(std::span<std::byte const>(bytes), std::span<float>(scalars));
+        CHECK(scalars == std::array<float, 9>{ 1, 2, 3, 4, 5, 6, 7, 8, 9 });
+
+        std::stringstream sstr;
+        GHULBUS_MATH_NAMESPACE::write_binary(sstr, std::span<ColumnMajorMatrix3 const>(&column_major, 1));
+        std::vector<Matrix3<float>> matrices3;
+        CHECK(GHULBUS_MATH_NAMESPACE::read_binary(sstr, matrices3));
+        REQUIRE(matrices3.size() == 1);
+        CHECK(matrices3[0] == Matrix3<float>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+        sstr.clear();
+        sstr.seekg(0);
+        std::vector<Matrix<float, 3, 3>> row_major;
+        CHECK(GHULBUS_MATH_NAMESPACE::read_binary(sstr, row_major));
+        REQUIRE(row_major.size() == 1);
+        CHECK(row_major[0] == Matrix<float, 3, 3>(column_major));
+
+        std::stringstream row_major_sstr;
+        GHULBUS_MATH_NAMESPACE::write_binary(row_major_sstr, std::span<Matrix<float, 3, 3> const>(row_major));
+        std::vector<ColumnMajorMatrix3> column_major_read;
+        CHECK(GHULBUS_MATH_NAMESPACE::read_binary(row_major_sstr, column_major_read));
+        REQUIRE(column_major_read.size() == 1);
+        CHECK(column_major_read[0] == column_major);
+    }
+
+    SECTION("Header")
+    {
+        BinaryHeader const header = GHULBUS_MATH_NAMESPACE::make_binary_header<AABB3<float>>(42, std::endian::big);
+        CHECK(header.version == BinaryHeader::current_version);
+        CHECK(header.byte_order == std::endian::big);
+        CHECK(header.scalar_kind == BinaryScalarKind::FloatingPoint);
+        CHECK(header.scalar_size == 4);
+        CHECK(header.scalars_per_element == 6);
+        CHECK(header.count == 42);
+        CHECK(GHULBUS_MATH_NAMESPACE::make_binary_header<Vector2<std::int16_t>>(0).scalar_kind ==
+              BinaryScalarKind::SignedInteger);
+        CHECK(GHULBUS_MATH_NAMESPACE::make_binary_header<Vector2<std::uint16_t>>(0).scalar_kind ==
+              BinaryScalarKind::UnsignedInteger);
+
+        std::array<std::byte, BinaryHeader::size> bytes;
+        GHULBUS_MATH_NAMESPACE::write_binary_header(header, bytes);
+        CHECK(bytes[0] == std::byte{ 'G' });
+        CHECK(bytes[3] == std::byte{ 'B' });
+        CHECK(bytes[4] == std::byte{ 1 });
+        CHECK(bytes[5] == std::byte{ 0 });
+        CHECK(bytes[6] == std::byte{ 1 });
+        CHECK(bytes[12] == std::byte{ 6 });
+        CHECK(bytes[16] == std::byte{ 42 });
+        auto const read_header = GHULBUS_MATH_NAMESPACE::read_binary_header(bytes);
+        REQUIRE(read_header);
+        CHECK(*read_header == header);
+
+        // compatibility is determined by the shape of the elements
+        CHECK(GHULBUS_MATH_NAMESPACE::is_compatible<AABB3<float>>(header));
+        CHECK(GHULBUS_MATH_NAMESPACE::is_compatible<Vector<float, 6>>(header));
+        CHECK(!GHULBUS_MATH_NAMESPACE::is_compatible<AABB3<double>>(header));
+        CHECK(!GHULBUS_MATH_NAMESPACE::is_compatible<AABB2<float>>(header));
+        CHECK(!GHULBUS_MATH_NAMESPACE::is_compatible<Vector<std::int32_t, 6>>(header));
+
+        // invalid headers are rejected
+        auto invalid = bytes;
+        invalid[0] = std::byte{ 'X' };
+        CHECK(!GHULBUS_MATH_NAMESPACE::read_binary_header(invalid));
+        invalid = bytes;
+        invalid[4] = std::byte{ 2 };
+        CHECK(!GHULBUS_MATH_NAMESPACE::read_binary_header(invalid));
+        invalid = bytes;
+        invalid[6] = std::byte{ 2 };
+        CHECK(!GHULBUS_MATH_NAMESPACE::read_binary_header(invalid));
+        invalid = bytes;
+        invalid[7] = std::byte{ 3 };
+        CHECK(!GHULBUS_MATH_NAMESPACE::read_binary_header(invalid));
+    }
+
+    SECTION("Streams")
+    {
+        std::vector<Point3<double>> points;
+        for (int i = 0; i < 2000; ++i) { points.emplace_back(i, -i, 0.5 * i); }
+
+        for (std::endian const byte_order : { std::endian::little, std::endian::big }) {
+            std::stringstream sstr;
+            GHULBUS_MATH_NAMESPACE::write_binary(sstr, std::span<Point3<double> const>(points), byte_order);
+            CHECK(sstr.str().size() == BinaryHeader::size + points.size() * 24);
+            std::vector<Point3<double>> read_points{ Point3<double>(1, 2, 3) };
+            CHECK(GHULBUS_MATH_NAMESPACE::read_binary(sstr, read_points));
+            CHECK(read_points == points);
+        }
+
+        // mismatched element type
+        {
+            std::stringstream sstr;
+            GHULBUS_MATH_NAMESPACE::write_binary(sstr, std::span<Point3<double> const>(points));
+            std::vector<Point3<float>> read_points;
+            CHECK(!GHULBUS_MATH_NAMESPACE::read_binary(sstr, read_points));
+        }
+
+        // truncated stream
+        {
+            std::stringstream sstr;
+            GHULBUS_MATH_NAMESPACE::write_binary(sstr, std::span<Point3<double> const>(points));
+            std::string data = sstr.str();
+            data.resize(data.size() - 1);
+            std::stringstream truncated(data);
+            std::vector<Point3<double>> read_points;
+            CHECK(!GHULBUS_MATH_NAMESPACE::read_binary(truncated, read_points));
+        }
+    }
+}
+
+TEST_CASE("BinaryIO text comparison", "[.][benchmark]")
+{
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using Clock = std::chrono::steady_clock;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(-1000.f, 1000.f);
+    std::vector<Point3<float>> points;
+    for (int i = 0; i < 1'000'000; ++i) { points.emplace_back(dist(rng), dist(rng), dist(rng)); }
+
+    auto const t0 = Clock::now();
+    std::stringstream text;
+    for (auto const& p : points) { text << p << '\n'; }
+    auto const t1 = Clock::now();
+    std::stringstream binary;
+    GHULBUS_MATH_NAMESPACE::write_binary(binary, std::span<Point3<float> const>(points));
+    auto const t2 = Clock::now();
+    std::vector<Point3<float>> read_points;
+    GHULBUS_MATH_NAMESPACE::read_binary(binary, read_points);
+    auto const t3 = Clock::now();
+
+    CHECK(read_points == points);
+    CHECK(binary.str().size() < text.str().size());
+    auto const ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    WARN("text write: " << ms(t1 - t0) << " ms, " << text.str().size() << " bytes; binary write: "
+         << ms(t2 - t1) << " ms, binary read: " << ms(t3 - t2) << " ms, " << binary.str().size() << " bytes");
+}
@@ -7,6 +7,7 @@
 
 TEST_CASE("Circle2")
 {
+    using GHULBUS_MATH_NAMESPACE::AABB2;
     using GHULBUS_MATH_NAMESPACE::Circle2;
     using GHULBUS_MATH_NAMESPACE::Point2;
     using GHULBUS_MATH_NAMESPACE::Line2;
@@ -82,6 +83,16 @@ TEST_CASE("Circle2")
                           Circle2<float>(Point2<float>(1.f + std::sqrt(2.f), 2.f + std::sqrt(2.f)), 1.f)));
     }
 
+    SECTION("Circle-AABB collision test")
+    {
+        AABB2<float> const box(Point2<float>(0.f, 0.f), Point2<float>(2.f, 1.f));
+        CHECK(collides(Circle2<float>(Point2<float>(1.f, 0.5f), 0.1f), box));
+        CHECK(collides(Circle2<float>(Point2<float>(3.f, 0.5f), 1.f), box));
+        CHECK(!collides(Circle2<float>(Point2<float>(3.f, 0.5f), 0.9f), box));
+        CHECK(collides(Circle2<float>(Point2<float>(3.f, 2.f), 1.5f), box));
+        CHECK(!collides(Circle2<float>(Point2<float>(3.f, 2.f), 1.4f), box));
+    }
+
     SECTION("Circle2Line2Intersection Zero Initialisation")
     {
         using GHULBUS_MATH_NAMESPACE::Circle2Line2Intersection;
@@ -0,0 +1,151 @@
+#include <gbMath/ColorBlend.hpp>
+
+#include <catch.hpp>
+
+#include <span>
+#include <vector>
+
+namespace {
+template<typename T>
+bool approx_equal(GHULBUS_MATH_NAMESPACE::Color4<T> const& lhs, GHULBUS_MATH_NAMESPACE::Color4<T> const& rhs)
+{
+    return (lhs.r == Approx(rhs.r)) && (lhs.g == Approx(rhs.g)) && (lhs.b == Approx(rhs.b)) &&
+           (lhs.a == Approx(rhs.a));
+}
+}
+
+TEST_CASE("ColorBlend")
+{
+    using GHULBUS_MATH_NAMESPACE::blend_additive;
+    using GHULBUS_MATH_NAMESPACE::blend_additive_premultiplied;
+    using GHULBUS_MATH_NAMESPACE::blend_multiply;
+    using GHULBUS_MATH_NAMESPACE::blend_multiply_premultiplied;
+    using GHULBUS_MATH_NAMESPACE::blend_over;
+    using GHULBUS_MATH_NAMESPACE::blend_over_premultiplied;
+    using GHULBUS_MATH_NAMESPACE::Color4;
+    using GHULBUS_MATH_NAMESPACE::Color4SoA;
+    using GHULBUS_MATH_NAMESPACE::premultiplied;
+
+    Color4<double> const red(1.0, 0.0, 0.0, 1.0);
+    Color4<double> const half_green(0.0, 1.0, 0.0, 0.5);
+    Color4<double> const transparent(0.0, 0.0, 0.0, 0.0);
+
+    SECTION("Over")
+    {
+        // opaque source replaces destination
+        CHECK(blend_over(red, half_green) == red);
+        CHECK(blend_over_premultiplied(red, premultiplied(half_green)) == red);
+        // transparent source leaves destination unchanged
+        CHECK(blend_over(transparent, half_green) == half_green);
+        CHECK(blend_over(half_green, transparent) == half_green);
+        CHECK(blend_over(transparent, transparent) == transparent);
+        // half transparent source over opaque destination
+        CHECK(blend_over(half_green, red) == Color4<double>(0.5, 0.5, 0.0, 1.0));
+        // half transparent over half transparent
+        CHECK(approx_equal(blend_over(half_green, Color4<double>(1.0, 0.0, 0.0, 0.5)),
+                           Color4<double>(1.0 / 3.0, 2.0 / 3.0, 0.0, 0.75)));
+        CHECK(blend_over_premultiplied(premultiplied(half_green), premultiplied(Color4<double>(1.0, 0.0, 0.0, 0.5))) ==
+              Color4<double>(0.25, 0.5, 0.0, 0.75));
+    }
+
+    SECTION("Additive")
+    {
+        CHECK(blend_additive_premultiplied(Color4<double>(0.5, 0.25, 0.0, 0.5), Color4<double>(0.75, 0.0, 0.5, 0.75)) ==
+              Color4<double>(1.25, 0.25, 0.5, 1.0));
+        CHECK(blend_additive(half_green, red) == Color4<double>(1.0, 0.5, 0.0, 1.0));
+        CHECK(blend_additive(transparent, half_green) == half_green);
+    }
+
+    SECTION("Multiply")
+    {
+        Color4<double> const grey(0.5, 0.5, 0.5, 1.0);
+        Color4<double> const color(1.0, 0.5, 0.25, 1.0);
+        // opaque colors multiply component-wise
+        CHECK(blend_multiply(grey, color) == Color4<double>(0.5, 0.25, 0.125, 1.0));
+        CHECK(blend_multiply_premultiplied(grey, color) == Color4<double>(0.5, 0.25, 0.125, 1.0));
+        // transparent source leaves destination unchanged
+        CHECK(blend_multiply(transparent, color) == color);
+        // transparent destination yields the source
+        CHECK(blend_multiply(half_green, transparent) == half_green);
+        // partial coverage
+        CHECK(blend_multiply_premultiplied(Color4<double>(0.25, 0.25, 0.25, 0.5), color) ==
+              Color4<double>(0.5 + 0.25, 0.25 + 0.125, 0.125 + 0.0625, 1.0));
+    }
+
+    SECTION("Bulk blending matches single blending")
+    {
+        std::vector<Color4<float>> src;
+        std::vector<Color4<float>> dst;
+        for (int i = 0; i < 500; ++i) {
+            src.emplace_back(static_cast<float>(i % 7) / 6.f, static_cast<float>(i % 11) / 10.f,
+                             static_cast<float>(i % 3) / 2.f, static_cast<float>(i % 5) / 4.f);
+            dst.emplace_back(static_cast<float>(i % 13) / 12.f, static_cast<float>(i % 2),
+                             static_cast<float>(i % 9) / 8.f, static_cast<float>(i % 4) / 3.f);
+        }
+        std::span<Color4<float> const> const in(src);
+
+        auto check_aos = [&](auto bulk, auto single) {
+            std::vector<Color4<float>> out = dst;
+            bulk(in, std::span<Color4<float>>(out));
+            bool all_match = true;
+            for (std::size_t i = 0; i < src.size(); ++i) { all_match = all_match && (out[i] == single(src[i], dst[i])); }
+            CHECK(all_match);
+        };
+        check_aos([](auto s, auto d) { blend_over(s, d); }, [](auto s, auto d) { return blend_over(s, d); });
+        check_aos([](auto s, auto d) { blend_additive(s, d); }, [](auto s, auto d) { return blend_additive(s, d); });
+        check_aos([](auto s, auto d) { blend_multiply(s, d); }, [](auto s, auto d) { return blend_multiply(s, d); });
+        check_aos([](auto s, auto d) { blend_over_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_over_premultiplied(s, d); });
+        check_aos([](auto s, auto d) { blend_additive_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_additive_premultiplied(s, d); });
+        check_aos([](auto s, auto d) { blend_multiply_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_multiply_premultiplied(s, d); });
+
+        // planar layout
+        std::size_t const n = src.size();
+        std::vector<float> src_planes(4 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t c = 0; c < 4; ++c) { src_planes[c * n + i] = src[i][c]; }
+        }
+        std::span<float const> const sp(src_planes);
+        Color4SoA<float const> const src_soa{ sp.subspan(0, n), sp.subspan(n, n), sp.subspan(2 * n, n),
+                                              sp.subspan(3 * n, n) };
+        REQUIRE(src_soa.size() == n);
+        CHECK(src_soa[7] == src[7]);
+
+        auto check_soa = [&](auto bulk, auto single) {
+            std::vector<float> dst_planes(4 * n);
+            std::span<float> const dp(dst_planes);
+            Color4SoA<float> const dst_soa{ dp.subspan(0, n), dp.subspan(n, n), dp.subspan(2 * n, n),
+                                            dp.subspan(3 * n, n) };
+            for (std::size_t i = 0; i < n; ++i) { dst_soa.set(i, dst[i]); }
+            bulk(src_soa, dst_soa);
+            bool all_match = true;
+            for (std::size_t i = 0; i < n; ++i) { all_match = all_match && (dst_soa[i] == single(src[i], dst[i])); }
+            CHECK(all_match);
+        };
+        check_soa([](auto const& s, auto const& d) { blend_over(s, d); },
+                  [](auto s, auto d) { return blend_over(s, d); });
+        check_soa([](auto const& s, auto const& d) { blend_additive(s, d); },
+                  [](auto s, auto d) { return blend_additive(s, d); });
+        check_soa([](auto const& s, auto const& d) { blend_multiply(s, d); },
+                  [](auto s, auto d) { return blend_multiply(s, d); });
+        check_soa([](auto const& s, auto const& d) { blend_over_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_over_premultiplied(s, d); });
+        check_soa([](auto const& s, auto const& d) { blend_additive_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_additive_premultiplied(s, d); });
+        check_soa([](auto const& s, auto const& d) { blend_multiply_premultiplied(s, d); },
+                  [](auto s, auto d) { return blend_multiply_premultiplied(s, d); });
+
+        // a mutable view converts to a read-only source
+        std::vector<float> planes(4 * n, 0.5f);
+        std::span<float> const p(planes);
+        Color4SoA<float> const soa{ p.subspan(0, n), p.subspan(n, n), p.subspan(2 * n, n), p.subspan(3 * n, n) };
+        std::vector<float> out_planes(4 * n, 0.f);
+        std::span<float> const op(out_planes);
+        Color4SoA<float> const out_soa{ op.subspan(0, n), op.subspan(n, n), op.subspan(2 * n, n),
+                                        op.subspan(3 * n, n) };
+        blend_additive_premultiplied(soa, out_soa);
+        CHECK(out_soa[0] == Color4<float>(0.5f, 0.5f, 0.5f, 0.5f));
+    }
+}
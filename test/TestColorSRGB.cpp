@@ -0,0 +1,127 @@
+#include <gbMath/ColorSRGB.hpp>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+TEST_CASE("ColorSRGB")
+{
+    using GHULBUS_MATH_NAMESPACE::Color4;
+    using GHULBUS_MATH_NAMESPACE::ColorRGBA8;
+    using GHULBUS_MATH_NAMESPACE::linear_to_srgb;
+    using GHULBUS_MATH_NAMESPACE::linear_to_srgb8;
+    using GHULBUS_MATH_NAMESPACE::linear_to_srgb_fast;
+    using GHULBUS_MATH_NAMESPACE::srgb8_to_linear;
+    using GHULBUS_MATH_NAMESPACE::srgb_to_linear;
+
+    SECTION("Exact transfer functions")
+    {
+        CHECK(srgb_to_linear(0.0) == 0.0);
+        CHECK(srgb_to_linear(1.0) == Approx(1.0));
+        CHECK(srgb_to_linear(0.04045) == Approx(0.04045 / 12.92));
+        CHECK(srgb_to_linear(0.5) == Approx(0.214041140482232));
+        CHECK(linear_to_srgb(0.0f) == 0.0f);
+        CHECK(linear_to_srgb(1.0f) == Approx(1.0f));
+        CHECK(linear_to_srgb(0.214041140482232) == Approx(0.5));
+        CHECK(linear_to_srgb(0.001) == Approx(0.01292));
+        for (int i = 0; i <= 100; ++i) {
+            double const v = i / 100.0;
+            CHECK(linear_to_srgb(srgb_to_linear(v)) == Approx(v).margin(1e-12));
+        }
+    }
+
+    SECTION("Color4 conversions leave alpha untouched")
+    {
+        Color4<float> const c(0.5f, 0.25f, 1.f, 0.5f);
+        Color4<float> const linear = srgb_to_linear(c);
+        CHECK(linear.r == srgb_to_linear(0.5f));
+        CHECK(linear.g == srgb_to_linear(0.25f));
+        CHECK(linear.b == srgb_to_linear(1.f));
+        CHECK(linear.a == 0.5f);
+        CHECK(linear_to_srgb(linear).a == 0.5f);
+        CHECK(linear_to_srgb_fast(linear).a == 0.5f);
+    }
+
+    SECTION("Approximate encoding error bound")
+    {
+        double max_error = 0.0;
+        for (int i = 0; i <= 1 << 20; ++i) {
+            float const v = static_cast<float>(i) / static_cast<float>(1 << 20);
+            double const error = std::abs(linear_to_srgb_fast(v) - linear_to_srgb(static_cast<double>(v)));
+            max_error = (error > max_error) ? error : max_error;
+        }
+        CHECK(max_error < 4e-6);
+        // saturation
+        CHECK(linear_to_srgb_fast(-1.f) == 0.f);
+        CHECK(linear_to_srgb_fast(2.f) == Approx(1.f).margin(4e-6));
+        CHECK(linear_to_srgb_fast(std::numeric_limits<float>::infinity()) == Approx(1.f).margin(4e-6));
+        CHECK(linear_to_srgb_fast(std::numeric_limits<float>::quiet_NaN()) == 0.f);
+    }
+
+    SECTION("8 bit conversions")
+    {
+        CHECK(srgb8_to_linear(0) == 0.f);
+        CHECK(srgb8_to_linear(255) == 1.f);
+        for (int i = 0; i < 256; ++i) {
+            auto const v = static_cast<std::uint8_t>(i);
+            CHECK(srgb8_to_linear(v) == static_cast<float>(srgb_to_linear(i / 255.0)));
+            ColorRGBA8 const c{ v, v, v, v };
+            Color4<float> const linear = srgb_to_linear(c);
+            CHECK(linear.a == static_cast<float>(i) / 255.f);
+            CHECK(linear_to_srgb8(linear) == c);
+        }
+        CHECK(linear_to_srgb8(Color4<float>(0.214041140482232f, 0.f, 1.f, 0.5f)) == ColorRGBA8{ 128, 0, 255, 128 });
+    }
+
+    SECTION("Bulk conversion matches single conversion")
+    {
+        std::vector<Color4<float>> colors;
+        std::vector<ColorRGBA8> srgb8;
+        for (int i = 0; i < 1000; ++i) {
+            colors.emplace_back(static_cast<float>(i) / 999.f, static_cast<float>(i % 17) / 16.f,
+                                static_cast<float>(999 - i) / 999.f, static_cast<float>(i % 5) / 4.f);
+            srgb8.push_back(ColorRGBA8{ static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(i * 7),
+                                        static_cast<std::uint8_t>(i * 13), static_cast<std::uint8_t>(i / 4) });
+        }
+        std::span<Color4<float> const> const in(colors);
+        std::vector<Color4<float>> out(colors.size());
+
+        srgb_to_linear(in, std::span<Color4<float>>(out));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(out[i] == srgb_to_linear(colors[i])); }
+        linear_to_srgb(in, std::span<Color4<float>>(out));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(out[i] == linear_to_srgb(colors[i])); }
+        linear_to_srgb_fast(in, std::span<Color4<float>>(out));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(out[i] == linear_to_srgb_fast(colors[i])); }
+
+        srgb_to_linear(std::span<ColorRGBA8 const>(srgb8), std::span<Color4<float>>(out));
+        for (std::size_t i = 0; i < srgb8.size(); ++i) { CHECK(out[i] == srgb_to_linear(srgb8[i])); }
+        std::vector<ColorRGBA8> packed(colors.size());
+        linear_to_srgb8(in, std::span<ColorRGBA8>(packed));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(packed[i] == linear_to_srgb8(colors[i])); }
+    }
+}
+
+TEST_CASE("ColorSRGB Benchmark", "[.][benchmark]")
+{
+    using GHULBUS_MATH_NAMESPACE::Color4;
+    std::vector<Color4<float>> colors(1 << 20);
+    for (std::size_t i = 0; i < colors.size(); ++i) {
+        float const v = static_cast<float>(i) / static_cast<float>(colors.size());
+        colors[i] = Color4<float>(v, 1.f - v, v * v, 1.f);
+    }
+    std::vector<Color4<float>> out(colors.size());
+    std::span<Color4<float> const> const in(colors);
+
+    auto const t0 = std::chrono::steady_clock::now();
+    GHULBUS_MATH_NAMESPACE::linear_to_srgb(in, std::span<Color4<float>>(out));
+    auto const t1 = std::chrono::steady_clock::now();
+    GHULBUS_MATH_NAMESPACE::linear_to_srgb_fast(in, std::span<Color4<float>>(out));
+    auto const t2 = std::chrono::steady_clock::now();
+    auto const ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    WARN("linear_to_srgb: " << ms(t1 - t0) << " ms; linear_to_srgb_fast: " << ms(t2 - t1) << " ms");
+}
@@ -2,6 +2,33 @@
 
 #include <catch.hpp>
 
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
 TEST_CASE("Common")
 {
+    using GHULBUS_MATH_NAMESPACE::rsqrt_fast;
+
+    SECTION("Fast reciprocal square root")
+    {
+        CHECK(rsqrt_fast(4.f) == Approx(0.5f).epsilon(5e-6));
+        CHECK(rsqrt_fast(1e-30f) == Approx(1e15f).epsilon(5e-6));
+        CHECK(rsqrt_fast(1e30f) == Approx(1e-15f).epsilon(5e-6));
+        CHECK(rsqrt_fast(4.0) == 0.5);
+        CHECK(rsqrt_fast(2.0) == 1.0 / std::sqrt(2.0));
+    }
+
+    SECTION("Fast reciprocal square root error bound")
+    {
+        // the relative error only depends on the mantissa and the lowest bit of the exponent,
+        // so checking all floats in [1, 4) covers all normal floats
+        double max_error = 0.0;
+        for (std::uint32_t bits = std::bit_cast<std::uint32_t>(1.f); bits < std::bit_cast<std::uint32_t>(4.f); ++bits) {
+            float const x = std::bit_cast<float>(bits);
+            double const error = std::abs(static_cast<double>(rsqrt_fast(x)) * std::sqrt(static_cast<double>(x)) - 1.0);
+            if (error > max_error) { max_error = error; }
+        }
+        CHECK(max_error < 5e-6);
+    }
 }
@@ -0,0 +1,149 @@
+#include <gbMath/ConjugateGradient.hpp>
+
+#include <catch.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEST_CASE("Conjugate Gradient")
+{
+    using GHULBUS_MATH_NAMESPACE::BlockSparseMatrix3;
+    using GHULBUS_MATH_NAMESPACE::ConjugateGradientWorkspace;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::SparseMatrix;
+    using GHULBUS_MATH_NAMESPACE::SparseMatrixEntry;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using Catch::Approx;
+
+    SECTION("1D Poisson problem")
+    {
+        // tridiagonal [-1 2 -1] system with a known solution
+        std::size_t const n = 100;
+        std::vector<SparseMatrixEntry<double>> entries;
+        for (std::size_t i = 0; i < n; ++i) {
+            entries.push_back({ i, i, 2.0 });
+            if (i > 0) { entries.push_back({ i, i - 1, -1.0 }); }
+            if (i + 1 < n) { entries.push_back({ i, i + 1, -1.0 }); }
+        }
+        SparseMatrix<double> const a(n, n, entries);
+        std::vector<double> expected(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expected[i] = static_cast<double>(i % 7) - 3.0;
+        }
+        std::vector<double> b(n);
+        a.multiply(expected, b);
+
+        std::vector<double> x(n, 0.0);
+        auto const res = conjugate_gradient(a, b, x, 1e-10, 1000);
+        CHECK(res.converged);
+        CHECK(res.residual_norm <= 1e-10);
+        // CG converges in at most n steps in exact arithmetic
+        CHECK(res.iterations <= static_cast<int>(n));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(x[i] == Approx(expected[i]).margin(1e-6));
+        }
+
+        SECTION("Warm start from solution")
+        {
+            auto const res_warm = conjugate_gradient(a, b, x, 1e-6, 1000);
+            CHECK(res_warm.converged);
+            CHECK(res_warm.iterations == 0);
+        }
+
+        SECTION("Iteration limit")
+        {
+            std::vector<double> x2(n, 0.0);
+            auto const res_limited = conjugate_gradient(a, b, x2, 1e-10, 3);
+            CHECK(!res_limited.converged);
+            CHECK(res_limited.iterations == 3);
+        }
+    }
+
+    SECTION("Zero right-hand side")
+    {
+        SparseMatrix<float> const a(2, 2, std::vector<SparseMatrixEntry<float>>{ { 0, 0, 1.f }, { 1, 1, 1.f } });
+        std::vector<float> const b(2, 0.f);
+        std::vector<float> x{ 5.f, 6.f };
+        auto const res = conjugate_gradient(a, b, x, 1e-6f, 10);
+        CHECK(res.converged);
+        CHECK(x == std::vector<float>{ 0.f, 0.f });
+    }
+
+    SECTION("Block system of a spring chain")
+    {
+        // chain of nodes connected by anisotropic springs, anchored at the first node
+        std::size_t const n = 20;
+        Matrix3<double> const k(3.0, 0.5, 0.0,
+                                0.5, 2.0, 0.25,
+                                0.0, 0.25, 1.0);
+        Matrix3<double> const mass(1.0, 0.0, 0.0,
+                                   0.0, 1.0, 0.0,
+                                   0.0, 0.0, 1.0);
+        std::vector<SparseMatrixEntry<Matrix3<double>>> entries;
+        for (std::size_t i = 0; i < n; ++i) {
+            entries.push_back({ i, i, mass });
+            if (i + 1 < n) {
+                entries.push_back({ i, i, k });
+                entries.push_back({ i + 1, i + 1, k });
+                entries.push_back({ i, i + 1, k * -1.0 });
+                entries.push_back({ i + 1, i, k * -1.0 });
+            }
+        }
+        BlockSparseMatrix3<double> const a(n, n, entries);
+        std::vector<Vector3<double>> expected(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            double const f = static_cast<double>(i);
+            expected[i] = Vector3<double>(f, -0.5 * f, 1.0);
+        }
+        std::vector<Vector3<double>> b(n);
+        a.multiply(expected, b);
+
+        std::vector<Vector3<double>> x(n);
+        auto const res = conjugate_gradient(a, b, x, 1e-12, 500);
+        CHECK(res.converged);
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(x[i].x == Approx(expected[i].x).margin(1e-8));
+            CHECK(x[i].y == Approx(expected[i].y).margin(1e-8));
+            CHECK(x[i].z == Approx(expected[i].z).margin(1e-8));
+        }
+    }
+
+    SECTION("Reused workspace and parallel_for")
+    {
+        std::size_t const n = 2500;
+        std::vector<SparseMatrixEntry<double>> entries;
+        for (std::size_t i = 0; i < n; ++i) {
+            entries.push_back({ i, i, 4.0 });
+            if (i > 0) { entries.push_back({ i, i - 1, -1.0 }); }
+            if (i + 1 < n) { entries.push_back({ i, i + 1, -1.0 }); }
+        }
+        SparseMatrix<double> const a(n, n, entries);
+        std::vector<double> b(n);
+        for (std::size_t i = 0; i < n; ++i) { b[i] = static_cast<double>(i % 5) - 2.0; }
+
+        std::vector<double> x_sequential(n, 0.0);
+        auto const res_sequential = conjugate_gradient(a, b, x_sequential, 1e-10, 1000);
+        REQUIRE(res_sequential.converged);
+
+        std::size_t task_count = 0;
+        auto const reverse_for = [&task_count](std::size_t count, auto&& f) {
+            task_count = count;
+            // run the tasks in reverse order to check that they are independent
+            for (std::size_t i = count; i > 0; --i) { f(i - 1); }
+        };
+        ConjugateGradientWorkspace<double> workspace;
+        std::vector<double> x(n, 0.0);
+        auto const res = conjugate_gradient(a, b, x, 1e-10, 1000, workspace, reverse_for);
+        CHECK(task_count == 3);
+        CHECK(res.iterations == res_sequential.iterations);
+        CHECK(x == x_sequential);
+
+        // solving again with the same workspace does not reallocate
+        double const* const buffer = workspace.r.data();
+        std::vector<double> x2(n, 0.0);
+        auto const res2 = conjugate_gradient(a, b, x2, 1e-10, 1000, workspace);
+        CHECK(workspace.r.data() == buffer);
+        CHECK(res2.iterations == res_sequential.iterations);
+        CHECK(x2 == x_sequential);
+    }
+}
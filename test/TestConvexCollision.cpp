@@ -0,0 +1,139 @@
+#include <gbMath/ConvexCollision.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Convex Collision")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::ConvexHull3;
+    using GHULBUS_MATH_NAMESPACE::GjkSimplex;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::OBB3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    GjkSimplex<float> simplex;
+    AABB3<float> const box(Point3<float>(0.f, 0.f, 0.f), Point3<float>(2.f, 2.f, 2.f));
+
+    SECTION("Support functions")
+    {
+        CHECK(support(box, Vector3<float>(1.f, -1.f, 0.f)) == Point3<float>(2.f, 0.f, 2.f));
+        CHECK(support(Sphere3<float>(Point3<float>(1.f, 2.f, 3.f), 2.f), Vector3<float>(0.f, -5.f, 0.f)) ==
+              Point3<float>(1.f, 0.f, 3.f));
+        OBB3<float> const obb(Point3<float>(1.f, 1.f, 1.f), Matrix3<float>(0.f, 1.f, 0.f, -1.f, 0.f, 0.f, 0.f, 0.f, 1.f),
+                              Vector3<float>(3.f, 2.f, 1.f));
+        CHECK(support(obb, Vector3<float>(1.f, 1.f, 1.f)) == Point3<float>(3.f, 4.f, 2.f));
+        std::vector<Point3<float>> const points{ Point3<float>(0.f, 0.f, 0.f), Point3<float>(1.f, 5.f, 0.f),
+                                                 Point3<float>(-2.f, 1.f, 1.f) };
+        CHECK(support(ConvexHull3<float>{ points }, Vector3<float>(-1.f, 0.f, 0.f)) == Point3<float>(-2.f, 1.f, 1.f));
+    }
+
+    SECTION("Distance of separated shapes")
+    {
+        Sphere3<float> const s1(Point3<float>(0.f, 0.f, 0.f), 1.f);
+        Sphere3<float> const s2(Point3<float>(0.f, 4.f, 0.f), 1.5f);
+        auto const r = gjk_distance(s1, s2, simplex);
+        CHECK(!r.intersecting);
+        CHECK(r.distance == Approx(1.5f).epsilon(5e-4));
+        CHECK(r.point_a.y == Approx(1.f).epsilon(1e-4));
+        CHECK(r.point_b.y == Approx(2.5f).epsilon(1e-4));
+
+        // box rotated by 45 degrees around z, with a corner pointing towards the axis-aligned box
+        float const c = std::sqrt(0.5f);
+        OBB3<float> const obb(Point3<float>(4.f, 1.f, 1.f), Matrix3<float>(c, c, 0.f, -c, c, 0.f, 0.f, 0.f, 1.f),
+                              Vector3<float>(1.f, 1.f, 1.f));
+        simplex.reset();
+        auto const contact = collide(box, obb, simplex);
+        CHECK(!contact.intersecting);
+        CHECK(contact.distance == Approx(2.f - std::sqrt(2.f)).epsilon(1e-4));
+        CHECK(contact.normal.x == Approx(1.f));
+        CHECK(contact.point_a.x == Approx(2.f));
+        CHECK(contact.point_b.x == Approx(4.f - std::sqrt(2.f)));
+    }
+
+    SECTION("Penetration of intersecting shapes")
+    {
+        AABB3<float> const other(Point3<float>(1.5f, 0.5f, 0.5f), Point3<float>(4.f, 1.f, 1.f));
+        auto contact = collide(box, other, simplex);
+        CHECK(contact.intersecting);
+        CHECK(contact.distance == Approx(-0.5f));
+        CHECK(contact.normal.x == Approx(1.f));
+        CHECK(contact.normal.y == Approx(0.f).margin(1e-6));
+        CHECK(contact.normal.z == Approx(0.f).margin(1e-6));
+        CHECK(contact.point_a.x == Approx(2.f));
+        CHECK(contact.point_b.x == Approx(1.5f));
+
+        // sphere penetrating the top face of the box
+        simplex.reset();
+        contact = collide(box, Sphere3<float>(Point3<float>(1.f, 1.f, 2.5f), 1.f), simplex);
+        CHECK(contact.intersecting);
+        CHECK(contact.distance == Approx(-0.5f).epsilon(1e-3));
+        CHECK(contact.normal.z == Approx(1.f).epsilon(1e-3));
+
+        // separating the shapes along the normal resolves the overlap
+        Sphere3<float> const s1(Point3<float>(0.f, 0.f, 0.f), 1.f);
+        Sphere3<float> s2(Point3<float>(1.f, 1.f, 0.f), 1.f);
+        simplex.reset();
+        contact = collide(s1, s2, simplex);
+        REQUIRE(contact.intersecting);
+        CHECK(contact.distance == Approx(std::sqrt(2.f) - 2.f).epsilon(1e-3));
+        s2.center += contact.normal * (-contact.distance + 0.01f);
+        simplex.reset();
+        CHECK(!gjk_intersects(s1, s2, simplex));
+    }
+
+    SECTION("Convex hulls")
+    {
+        std::vector<Point3<float>> const tetrahedron{ Point3<float>(0.f, 0.f, 0.f), Point3<float>(1.f, 0.f, 0.f),
+                                                      Point3<float>(0.f, 1.f, 0.f), Point3<float>(0.f, 0.f, 1.f) };
+        ConvexHull3<float> const hull{ tetrahedron };
+        auto contact = collide(hull, Sphere3<float>(Point3<float>(1.f, 1.f, 1.f), 0.5f), simplex);
+        CHECK(!contact.intersecting);
+        CHECK(contact.distance == Approx(2.f / std::sqrt(3.f) - 0.5f).epsilon(5e-4));
+        simplex.reset();
+        contact = collide(hull, AABB3<float>(Point3<float>(-1.f, -1.f, -1.f), Point3<float>(0.25f, 2.f, 2.f)),
+                          simplex);
+        CHECK(contact.intersecting);
+        CHECK(contact.distance == Approx(-0.25f));
+        CHECK(contact.normal.x == Approx(-1.f));
+    }
+
+    SECTION("Intersection test agrees with specialized tests")
+    {
+        for (int i = -12; i <= 12; ++i) {
+            for (int j = -12; j <= 12; j += 3) {
+                float const x = 0.25f * static_cast<float>(i) + 0.01f;
+                float const y = 0.25f * static_cast<float>(j) + 0.02f;
+                AABB3<float> const other(Point3<float>(x, y, 0.5f), Point3<float>(x + 1.f, y + 1.5f, 1.f));
+                simplex.reset();
+                CHECK(gjk_intersects(box, other, simplex) == intersects(box, other));
+                Sphere3<float> const s1(Point3<float>(0.f, 0.f, 0.f), 1.f);
+                Sphere3<float> const s2(Point3<float>(x, y, 0.5f), 0.75f);
+                simplex.reset();
+                CHECK(gjk_intersects(s1, s2, simplex) == collides(s1, s2));
+            }
+        }
+    }
+
+    SECTION("Warm-starting")
+    {
+        Sphere3<double> const s1(Point3<double>(0.0, 0.0, 0.0), 1.0);
+        GjkSimplex<double> warm;
+        auto r = gjk_distance(s1, OBB3<double>(Point3<double>(3.0, 1.0, 0.0), Matrix3<double>(1.0, 0.0, 0.0,
+                                                                                             0.0, 1.0, 0.0,
+                                                                                             0.0, 0.0, 1.0),
+                                               Vector3<double>(1.0, 0.5, 0.5)), warm);
+        int const cold_iterations = r.iterations;
+        CHECK(r.distance == Approx(std::sqrt(4.0 + 0.25) - 1.0));
+        r = gjk_distance(s1, OBB3<double>(Point3<double>(3.01, 1.0, 0.0), Matrix3<double>(1.0, 0.0, 0.0,
+                                                                                          0.0, 1.0, 0.0,
+                                                                                          0.0, 0.0, 1.0),
+                                          Vector3<double>(1.0, 0.5, 0.5)), warm);
+        CHECK(r.distance == Approx(std::sqrt(2.01 * 2.01 + 0.25) - 1.0));
+        CHECK(r.iterations < cold_iterations);
+    }
+}
@@ -0,0 +1,156 @@
+#include <gbMath/DynMatrix.hpp>
+
+#include <catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+TEST_CASE("DynMatrix")
+{
+    using GHULBUS_MATH_NAMESPACE::DynMatrix;
+    using GHULBUS_MATH_NAMESPACE::DynVector;
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_ColumnMajor;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_RowMajor;
+
+    SECTION("Construction")
+    {
+        DynMatrix<float> const empty;
+        CHECK(empty.dimension() == std::pair<std::size_t, std::size_t>(0, 0));
+
+        DynMatrix<int> const zeros(2, 3);
+        CHECK(zeros.rows() == 2);
+        CHECK(zeros.columns() == 3);
+        CHECK(!zeros.is_square());
+        for (int e : zeros.elements()) {
+            CHECK(e == 0);
+        }
+
+        int const arr[] = { 1, 2, 3, 4, 5, 6 };
+        DynMatrix<int> const mr(2, 3, arr, InputOrder_RowMajor{});
+        CHECK(mr(0, 2) == 3);
+        CHECK(mr(1, 0) == 4);
+        DynMatrix<int> const mc(2, 3, arr, InputOrder_ColumnMajor{});
+        CHECK(mc(0, 2) == 5);
+        CHECK(mc(1, 0) == 2);
+
+        Matrix<int, 2, 3> const fixed(1, 2, 3,
+                                      4, 5, 6);
+        CHECK(DynMatrix<int>(fixed) == mr);
+        CHECK(mr != mc);
+        CHECK(DynMatrix<int>(3, 2) != DynMatrix<int>(2, 3));
+    }
+
+    SECTION("Rows and columns")
+    {
+        int const arr[] = { 1, 2, 3, 4, 5, 6 };
+        DynMatrix<int> m(2, 3, arr, InputOrder_RowMajor{});
+        CHECK(m.row(1) == DynVector<int>{ 4, 5, 6 });
+        CHECK(m.column(2) == DynVector<int>{ 3, 6 });
+        m.set_row(0, DynVector<int>{ 7, 8, 9 });
+        m.set_column(1, DynVector<int>{ -1, -2 });
+        CHECK(m == DynMatrix<int>(Matrix<int, 2, 3>(7, -1, 9,
+                                                    4, -2, 6)));
+        m.swap_rows(0, 1);
+        m.swap_columns(0, 2);
+        CHECK(m == DynMatrix<int>(Matrix<int, 2, 3>(6, -2, 4,
+                                                    9, -1, 7)));
+    }
+
+    SECTION("Arithmetic matches fixed-size matrix")
+    {
+        Matrix<int, 2, 3> const f1(1, 2, 3,
+                                   4, 5, 6);
+        Matrix<int, 3, 2> const f2(7, 8,
+                                   9, 10,
+                                   11, 12);
+        DynMatrix<int> const d1(f1);
+        DynMatrix<int> const d2(f2);
+        CHECK(d1 * d2 == DynMatrix<int>(f1 * f2));
+        CHECK(d1 + d1 == DynMatrix<int>(f1 + f1));
+        CHECK(d1 - d1 * 2 == DynMatrix<int>(f1 - f1 * 2));
+        CHECK(3 * d1 / 3 == d1);
+        CHECK(transpose(d1) == DynMatrix<int>(transpose(f1)));
+        CHECK(trace(d1 * d2) == trace(f1 * f2));
+        CHECK(d1 * DynVector<int>{ 1, -1, 2 } == DynVector<int>{ 5, 11 });
+
+        DynMatrix<int> d = d1;
+        d += d1;
+        d -= d1;
+        d *= 4;
+        d /= 2;
+        CHECK(d == DynMatrix<int>(f1 * 2));
+
+        auto const id = GHULBUS_MATH_NAMESPACE::dyn_identity<int>(3);
+        CHECK(d1 * id == d1);
+    }
+
+    SECTION("LU decomposition matches fixed-size matrix")
+    {
+        using Catch::Approx;
+        Matrix<double, 3, 3> const fixed(2.0, 1.0, 1.0,
+                                         4.0, -6.0, 0.0,
+                                         -2.0, 7.0, 2.0);
+        DynMatrix<double> const m(fixed);
+        auto const lu = lu_decompose(m);
+        REQUIRE(lu);
+        auto const fixed_lu = lu_decompose(fixed);
+        CHECK(lu.getDeterminant() == fixed_lu.getDeterminant());
+        for (std::size_t i = 0; i < 3; ++i) {
+            CHECK(lu.indices[i] == fixed_lu.indices[i]);
+            for (std::size_t j = 0; j < 3; ++j) {
+                CHECK(lu.m(i, j) == fixed_lu.m(i, j));
+            }
+        }
+
+        auto const x = lu.solveFor(DynVector<double>{ 5.0, -2.0, 9.0 });
+        auto const r = m * x;
+        CHECK(r[0] == Approx(5.0));
+        CHECK(r[1] == Approx(-2.0));
+        CHECK(r[2] == Approx(9.0));
+
+        auto const inv = lu.getInverse();
+        auto const id = m * inv;
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                CHECK(id(i, j) == Approx((i == j) ? 1.0 : 0.0).margin(1e-12));
+            }
+        }
+    }
+
+    SECTION("LU decomposition of singular matrix")
+    {
+        DynMatrix<double> const m(Matrix<double, 2, 2>(1.0, 2.0,
+                                                       2.0, 4.0));
+        CHECK(!lu_decompose(m));
+        CHECK(!lu_decompose(DynMatrix<double>(2, 2)));
+    }
+
+    SECTION("Per-frame solve in an arena")
+    {
+        using Catch::Approx;
+        namespace pmr = GHULBUS_MATH_NAMESPACE::pmr;
+        std::array<std::byte, 4096> buffer;
+        // the null upstream resource ensures that nothing escapes to the global allocator
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        std::size_t const n = 5;
+        pmr::DynMatrix<double> a(n, n, &arena);
+        pmr::DynVector<double> b(n, &arena);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                a(i, j) = (i == j) ? 4.0 : 1.0 / static_cast<double>(i + j + 1);
+            }
+            b[i] = static_cast<double>(i);
+        }
+        auto const lu = lu_decompose(a);
+        REQUIRE(lu);
+        CHECK(lu.m.get_allocator().resource() == &arena);
+        auto const x = lu.solveFor(b);
+        auto const r = a * x - b;
+        CHECK(r.get_allocator().resource() == &arena);
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(r[i] == Approx(0.0).margin(1e-12));
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include <gbMath/DynVector.hpp>
+
+#include <catch.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+TEST_CASE("DynVector")
+{
+    using GHULBUS_MATH_NAMESPACE::DynVector;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+
+    SECTION("Construction")
+    {
+        DynVector<float> const empty;
+        CHECK(empty.dimension() == 0);
+
+        DynVector<int> const zeros(5);
+        CHECK(zeros.dimension() == 5);
+        for (std::size_t i = 0; i < 5; ++i) {
+            CHECK(zeros[i] == 0);
+        }
+
+        DynVector<int> const v{ 1, 2, 3 };
+        REQUIRE(v.dimension() == 3);
+        CHECK(v[0] == 1);
+        CHECK(v[1] == 2);
+        CHECK(v[2] == 3);
+        CHECK(v.elements().size() == 3);
+        CHECK(v.data() == v.elements().data());
+
+        CHECK(DynVector<int>(Vector<int, 3>(1, 2, 3)) == v);
+    }
+
+    SECTION("Equality")
+    {
+        CHECK(DynVector<int>{ 1, 2 } == DynVector<int>{ 1, 2 });
+        CHECK(DynVector<int>{ 1, 2 } != DynVector<int>{ 1, 3 });
+        CHECK(DynVector<int>{ 1, 2 } != DynVector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Arithmetic")
+    {
+        DynVector<int> const v1{ 1, 2, 3 };
+        DynVector<int> const v2{ 10, 20, 30 };
+        CHECK(v1 + v2 == DynVector<int>{ 11, 22, 33 });
+        CHECK(v2 - v1 == DynVector<int>{ 9, 18, 27 });
+        CHECK(-v1 == DynVector<int>{ -1, -2, -3 });
+        CHECK(v1 * 2 == DynVector<int>{ 2, 4, 6 });
+        CHECK(2 * v1 == DynVector<int>{ 2, 4, 6 });
+        CHECK(v2 / 10 == v1);
+        CHECK(dot(v1, v2) == 140);
+
+        DynVector<int> v = v1;
+        v += v2;
+        CHECK(v == DynVector<int>{ 11, 22, 33 });
+        v -= v1;
+        CHECK(v == v2);
+        v *= 3;
+        CHECK(v == DynVector<int>{ 30, 60, 90 });
+        v /= 30;
+        CHECK(v == v1);
+    }
+
+    SECTION("Arena allocation")
+    {
+        std::array<std::byte, 1024> buffer;
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        GHULBUS_MATH_NAMESPACE::pmr::DynVector<double> v1({ 1.0, 2.0 }, &arena);
+        GHULBUS_MATH_NAMESPACE::pmr::DynVector<double> v2({ 3.0, 4.0 }, &arena);
+        auto const sum = v1 + v2;
+        CHECK(sum.get_allocator().resource() == &arena);
+        CHECK(sum[0] == 4.0);
+        CHECK(sum[1] == 6.0);
+        auto const* p = reinterpret_cast<std::byte const*>(sum.data());
+        CHECK(p >= buffer.data());
+        CHECK(p < buffer.data() + buffer.size());
+    }
+}
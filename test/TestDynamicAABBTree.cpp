@@ -0,0 +1,201 @@
+#include <gbMath/DynamicAABBTree.hpp>
+#include <gbMath/VectorIO3.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+TEST_CASE("DynamicAABBTree")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB2;
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::DynamicAABBTree2;
+    using GHULBUS_MATH_NAMESPACE::DynamicAABBTree3;
+    using GHULBUS_MATH_NAMESPACE::Point2;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using Tree = DynamicAABBTree3<double>;
+    using ProxyId = Tree::ProxyId;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> pos_dist(0.0, 100.0);
+    std::uniform_real_distribution<double> size_dist(0.5, 3.0);
+    auto const random_box = [&]() {
+        Point3<double> const p(pos_dist(rng), pos_dist(rng), pos_dist(rng));
+        return AABB3<double>(p, p + Vector3<double>(size_dist(rng), size_dist(rng), size_dist(rng)));
+    };
+
+    SECTION("Empty tree")
+    {
+        Tree tree(0.1);
+        CHECK(tree.empty());
+        CHECK(tree.size() == 0);
+        CHECK(tree.height() == -1);
+        CHECK(tree.margin() == 0.1);
+        int count = 0;
+        tree.query(AABB3<double>(Point3<double>(0, 0, 0), Point3<double>(1, 1, 1)), [&](ProxyId) { ++count; });
+        CHECK(count == 0);
+    }
+
+    SECTION("Insert fattens box")
+    {
+        Tree tree(0.5);
+        ProxyId const id = tree.insert(AABB3<double>(Point3<double>(1, 2, 3), Point3<double>(4, 5, 6)), 17);
+        CHECK(tree.size() == 1);
+        CHECK(tree.height() == 0);
+        CHECK(tree.fat_bounds(id) == AABB3<double>(Point3<double>(0.5, 1.5, 2.5), Point3<double>(4.5, 5.5, 6.5)));
+        CHECK(tree.user_data(id) == 17);
+        tree.remove(id);
+        CHECK(tree.empty());
+        CHECK(tree.height() == -1);
+    }
+
+    std::vector<AABB3<double>> boxes;
+    std::vector<ProxyId> ids;
+    Tree tree(0.25);
+    for (std::size_t i = 0; i < 500; ++i) {
+        boxes.push_back(random_box());
+        ids.push_back(tree.insert(boxes.back(), i));
+    }
+
+    auto const brute_force_query = [&](AABB3<double> const& q) {
+        std::vector<std::size_t> ret;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            if (intersects(tree.fat_bounds(ids[i]), q)) { ret.push_back(i); }
+        }
+        return ret;
+    };
+    auto const tree_query = [&](AABB3<double> const& q) {
+        std::vector<std::size_t> ret;
+        tree.query(q, [&](ProxyId id) { ret.push_back(tree.user_data(id)); });
+        std::sort(begin(ret), end(ret));
+        return ret;
+    };
+
+    SECTION("Tree stays balanced")
+    {
+        CHECK(tree.size() == 500);
+        // a perfectly balanced tree would have height 9
+        CHECK(tree.height() <= 18);
+    }
+
+    SECTION("Query matches brute force")
+    {
+        for (int i = 0; i < 50; ++i) {
+            AABB3<double> const q = random_box();
+            CHECK(tree_query(q) == brute_force_query(q));
+        }
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            auto const hits = tree_query(boxes[i]);
+            CHECK(std::find(begin(hits), end(hits), i) != end(hits));
+        }
+    }
+
+    SECTION("Query can be stopped early")
+    {
+        int count = 0;
+        tree.query(AABB3<double>(Point3<double>(0, 0, 0), Point3<double>(100, 100, 100)),
+                   [&](ProxyId) { ++count; return count < 3; });
+        CHECK(count == 3);
+    }
+
+    SECTION("Remove")
+    {
+        for (std::size_t i = 0; i < boxes.size(); i += 2) {
+            tree.remove(ids[i]);
+        }
+        CHECK(tree.size() == 250);
+        CHECK(tree.height() <= 16);
+        std::vector<std::size_t> remaining;
+        tree.query(AABB3<double>(Point3<double>(-10, -10, -10), Point3<double>(110, 110, 110)),
+                   [&](ProxyId id) { remaining.push_back(tree.user_data(id)); });
+        std::sort(begin(remaining), end(remaining));
+        REQUIRE(remaining.size() == 250);
+        for (std::size_t i = 0; i < remaining.size(); ++i) {
+            CHECK(remaining[i] == 2*i + 1);
+        }
+        // freed nodes are reused
+        ProxyId const id = tree.insert(random_box(), 1000);
+        CHECK(id < 2 * boxes.size());
+    }
+
+    SECTION("Move within margin does not touch the tree")
+    {
+        AABB3<double> const moved(boxes[0].min + Vector3<double>(0.1, -0.1, 0.2),
+                                  boxes[0].max + Vector3<double>(0.1, -0.1, 0.2));
+        AABB3<double> const old_fat = tree.fat_bounds(ids[0]);
+        CHECK(!tree.move(ids[0], moved));
+        CHECK(tree.fat_bounds(ids[0]) == old_fat);
+    }
+
+    SECTION("Move outside margin re-inserts")
+    {
+        for (int step = 0; step < 20; ++step) {
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                Vector3<double> const d(std::sin(double(i + step)), std::cos(double(i * 3 + step)), 0.5);
+                boxes[i] = AABB3<double>(boxes[i].min + d, boxes[i].max + d);
+                tree.move(ids[i], boxes[i]);
+            }
+        }
+        CHECK(tree.size() == 500);
+        CHECK(tree.height() <= 18);
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            CHECK(GHULBUS_MATH_NAMESPACE::DynamicAABBTreeTraits::BoxTraits<AABB3<double>>::contains(
+                tree.fat_bounds(ids[i]), boxes[i]));
+        }
+        for (int i = 0; i < 20; ++i) {
+            AABB3<double> const q = random_box();
+            CHECK(tree_query(q) == brute_force_query(q));
+        }
+    }
+
+    SECTION("Shrinking box re-inserts")
+    {
+        Tree t(0.1);
+        ProxyId const id = t.insert(AABB3<double>(Point3<double>(0, 0, 0), Point3<double>(10, 10, 10)), 0);
+        CHECK(t.move(id, AABB3<double>(Point3<double>(4, 4, 4), Point3<double>(5, 5, 5))));
+        CHECK(t.fat_bounds(id) == AABB3<double>(Point3<double>(3.9, 3.9, 3.9), Point3<double>(5.1, 5.1, 5.1)));
+    }
+
+    SECTION("Overlapping pairs match brute force")
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> expected;
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            for (std::size_t j = i + 1; j < boxes.size(); ++j) {
+                if (intersects(tree.fat_bounds(ids[i]), tree.fat_bounds(ids[j]))) { expected.emplace_back(i, j); }
+            }
+        }
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        tree.query_pairs([&](ProxyId a, ProxyId b) {
+                CHECK(a < b);
+                std::size_t const ia = tree.user_data(a);
+                std::size_t const ib = tree.user_data(b);
+                pairs.emplace_back(std::min(ia, ib), std::max(ia, ib));
+            });
+        std::sort(begin(pairs), end(pairs));
+        CHECK(!expected.empty());
+        CHECK(pairs == expected);
+    }
+
+    SECTION("AABB2 tree")
+    {
+        DynamicAABBTree2<int> tiles(0);
+        for (int y = 0; y < 16; ++y) {
+            for (int x = 0; x < 16; ++x) {
+                tiles.insert(AABB2<int>(Point2<int>(x * 10, y * 10), Point2<int>(x * 10 + 9, y * 10 + 9)),
+                             static_cast<std::size_t>(y * 16 + x));
+            }
+        }
+        CHECK(tiles.size() == 256);
+        CHECK(tiles.height() <= 16);
+        std::vector<std::size_t> hits;
+        tiles.query(AABB2<int>(Point2<int>(15, 25), Point2<int>(32, 30)),
+                    [&](auto id) { hits.push_back(tiles.user_data(id)); });
+        std::sort(begin(hits), end(hits));
+        CHECK(hits == std::vector<std::size_t>{ 33, 34, 35, 49, 50, 51 });
+    }
+}
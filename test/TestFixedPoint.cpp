@@ -0,0 +1,347 @@
+#include <gbMath/FixedPoint.hpp>
+#include <gbMath/AABB2.hpp>
+#include <gbMath/Circle2.hpp>
+#include <gbMath/Matrix2.hpp>
+#include <gbMath/Transform2.hpp>
+#include <gbMath/Vector2.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+TEST_CASE("FixedPoint")
+{
+    using GHULBUS_MATH_NAMESPACE::Q16_16;
+    using GHULBUS_MATH_NAMESPACE::Q32_32;
+    namespace traits = GHULBUS_MATH_NAMESPACE::traits;
+
+    SECTION("Construction and conversion")
+    {
+        CHECK(Q16_16().raw() == 0);
+        CHECK(Q16_16(1).raw() == 0x10000);
+        CHECK(Q16_16(-3).raw() == -3 * 0x10000);
+        CHECK(Q16_16(0.5).raw() == 0x8000);
+        CHECK(Q16_16(-0.25f).raw() == -0x4000);
+        CHECK(Q32_32(1).raw() == (std::int64_t{ 1 } << 32));
+        CHECK(Q16_16::from_raw(42).raw() == 42);
+        // rounding to nearest
+        CHECK(Q16_16(1.4 / 65536.0).raw() == 1);
+        CHECK(Q16_16(1.6 / 65536.0).raw() == 2);
+        CHECK(Q16_16(-1.6 / 65536.0).raw() == -2);
+        // saturation
+        CHECK(Q16_16(40000) == std::numeric_limits<Q16_16>::max());
+        CHECK(Q16_16(-40000) == std::numeric_limits<Q16_16>::lowest());
+        CHECK(Q16_16(std::uint64_t{ 1 } << 40) == std::numeric_limits<Q16_16>::max());
+        CHECK(Q16_16(1e10) == std::numeric_limits<Q16_16>::max());
+        CHECK(Q16_16(-1e10f) == std::numeric_limits<Q16_16>::lowest());
+        CHECK(Q32_32(1e30) == std::numeric_limits<Q32_32>::max());
+        CHECK(Q16_16(std::numeric_limits<double>::infinity()) == std::numeric_limits<Q16_16>::max());
+        CHECK(Q16_16(std::numeric_limits<double>::quiet_NaN()).raw() == 0);
+        // back to float and int
+        CHECK(static_cast<double>(Q16_16(2.75)) == 2.75);
+        CHECK(static_cast<float>(Q32_32(-0.125)) == -0.125f);
+        CHECK(static_cast<int>(Q16_16(2.75)) == 2);
+        CHECK(static_cast<int>(Q16_16(-2.75)) == -2);
+        CHECK(static_cast<double>(Q32_32(1234.5678)) == Approx(1234.5678).epsilon(1e-12));
+    }
+
+    SECTION("Arithmetic")
+    {
+        CHECK(Q16_16(1.5) + Q16_16(2.25) == Q16_16(3.75));
+        CHECK(Q16_16(1.5) - Q16_16(2.25) == Q16_16(-0.75));
+        CHECK(Q16_16(1.5) * Q16_16(-2.25) == Q16_16(-3.375));
+        CHECK(Q16_16(-3.375) / Q16_16(1.5) == Q16_16(-2.25));
+        CHECK(Q32_32(1.5) * Q32_32(-2.25) == Q32_32(-3.375));
+        CHECK(Q32_32(-3.375) / Q32_32(-1.5) == Q32_32(2.25));
+        CHECK(-Q16_16(2) == Q16_16(-2));
+        CHECK(Q16_16(1) < Q16_16(2));
+        CHECK(Q16_16(-1) < Q16_16(0.5));
+        // products and quotients round to nearest
+        CHECK(Q16_16(1) / Q16_16(3) == Q16_16::from_raw(21845));
+        CHECK(Q16_16(2) / Q16_16(3) == Q16_16::from_raw(43691));
+        CHECK(Q16_16(-2) / Q16_16(3) == Q16_16::from_raw(-43691));
+        CHECK(Q16_16::from_raw(3) * Q16_16(0.5) == Q16_16::from_raw(2));
+        CHECK(Q32_32(1) / Q32_32(3) == Q32_32::from_raw(1431655765));
+        // large intermediates do not overflow
+        CHECK(Q16_16(30000) * Q16_16(0.5) == Q16_16(15000));
+        CHECK(Q16_16(100) / Q16_16(200) == Q16_16(0.5));
+        CHECK(Q32_32(2000000000) * Q32_32(0.25) == Q32_32(500000000));
+        CHECK(Q32_32(1000000000) / Q32_32(2000000000) == Q32_32(0.5));
+        // saturation
+        auto const max16 = std::numeric_limits<Q16_16>::max();
+        auto const min16 = std::numeric_limits<Q16_16>::lowest();
+        CHECK(max16 + Q16_16(1) == max16);
+        CHECK(min16 - Q16_16(1) == min16);
+        CHECK(Q16_16(-30000) + Q16_16(-30000) == min16);
+        CHECK(Q16_16(300) * Q16_16(300) == max16);
+        CHECK(Q16_16(300) * Q16_16(-300) == min16);
+        CHECK(Q16_16(30000) / Q16_16(0.5) == max16);
+        CHECK(Q32_32(100000) * Q32_32(100000) == std::numeric_limits<Q32_32>::max());
+        CHECK(-min16 == max16);
+        CHECK(Q16_16(-32768) * Q16_16(1) == min16);
+        // division by zero
+        CHECK(Q16_16(1) / Q16_16(0) == max16);
+        CHECK(Q16_16(-1) / Q16_16(0) == min16);
+        CHECK(Q16_16(0) / Q16_16(0) == Q16_16(0));
+
+        Q32_32 q(1);
+        q += Q32_32(2);
+        q *= Q32_32(1.5);
+        q -= Q32_32(0.5);
+        q /= Q32_32(2);
+        CHECK(q == Q32_32(2));
+    }
+
+    SECTION("Emulated 128 bit arithmetic")
+    {
+        using GHULBUS_MATH_NAMESPACE::fixed_point_detail::UInt128;
+        UInt128 const p = UInt128::multiply(0xffffffffffffffffu, 0xffffffffffffffffu);
+        CHECK(p.hi == 0xfffffffffffffffeu);
+        CHECK(p.lo == 1u);
+        UInt128 const s = UInt128{ 0, 0xffffffffffffffffu } + 1u;
+        CHECK(s.hi == 1u);
+        CHECK(s.lo == 0u);
+        CHECK(((UInt128{ 0, 0x1234 } << 32) >> 32).lo == 0x1234u);
+        std::uint64_t q = 0;
+        CHECK(!UInt128{ 5, 0 }.divide(5, q));
+        REQUIRE(UInt128{ 4, 7 }.divide(5, q));
+        CHECK(q == 0xccccccccccccccceu);
+
+        std::mt19937_64 rng(42);
+        for (int i = 0; i < 1000; ++i) {
+            std::uint64_t const a = rng();
+            std::uint64_t const b = rng() >> (i % 64);
+            UInt128 const prod = UInt128::multiply(a, b);
+            if (b != 0) {
+                // (a * b) / b == a
+                std::uint64_t quotient = 0;
+                REQUIRE(prod.divide(b, quotient));
+                CHECK(quotient == a);
+            }
+#ifdef __SIZEOF_INT128__
+            using GHULBUS_MATH_NAMESPACE::fixed_point_detail::NativeUInt128;
+            NativeUInt128 const expected = static_cast<NativeUInt128>(a) * b;
+            CHECK(prod.hi == static_cast<std::uint64_t>(expected >> 64));
+            CHECK(prod.lo == static_cast<std::uint64_t>(expected));
+#endif
+        }
+    }
+
+#ifdef __SIZEOF_INT128__
+    SECTION("Emulated 128 bit arithmetic matches native 128 bit arithmetic")
+    {
+        // the emulation is only used by WideArithmetic on platforms without __int128, so compare it here
+        using GHULBUS_MATH_NAMESPACE::fixed_point_detail::NativeUInt128;
+        using GHULBUS_MATH_NAMESPACE::fixed_point_detail::UInt128;
+        auto const to_native = [](UInt128 const& u) { return (static_cast<NativeUInt128>(u.hi) << 64) | u.lo; };
+        std::mt19937_64 rng(4711);
+        int mismatches = 0;
+        for (int i = 0; i < 100000; ++i) {
+            std::uint64_t const a = rng() >> (rng() % 64);
+            std::uint64_t const b = rng() >> (rng() % 64);
+            int const shift = 1 + static_cast<int>(rng() % 63);
+            if (to_native(UInt128::multiply(a, b)) != static_cast<NativeUInt128>(a) * b) { ++mismatches; }
+
+            // dividends with arbitrary high words, including quotients that overflow 64 bits
+            UInt128 const dividend{ rng() >> (rng() % 64), rng() };
+            std::uint64_t const d = std::max<std::uint64_t>(rng() >> (rng() % 64), 1);
+            NativeUInt128 const native_quotient = to_native(dividend) / d;
+            std::uint64_t q = 0;
+            bool const fits = dividend.divide(d, q);
+            if (fits != ((native_quotient >> 64) == 0)) { ++mismatches; }
+            if (fits && (q != static_cast<std::uint64_t>(native_quotient))) { ++mismatches; }
+
+            // rounded fixed-point multiplication and division as computed by WideArithmetic<std::int64_t>
+            NativeUInt128 const native_product =
+                ((static_cast<NativeUInt128>(a) * b) + (static_cast<NativeUInt128>(1) << (shift - 1))) >> shift;
+            if (to_native((UInt128::multiply(a, b) + (std::uint64_t{ 1 } << (shift - 1))) >> shift) != native_product) {
+                ++mismatches;
+            }
+            if (b != 0) {
+                NativeUInt128 const native_ratio = ((static_cast<NativeUInt128>(a) << shift) + (b >> 1)) / b;
+                std::uint64_t ratio = 0;
+                bool const ratio_fits = ((UInt128{ 0, a } << shift) + (b >> 1)).divide(b, ratio);
+                if (ratio_fits != ((native_ratio >> 64) == 0)) { ++mismatches; }
+                if (ratio_fits && (ratio != static_cast<std::uint64_t>(native_ratio))) { ++mismatches; }
+            }
+        }
+        CHECK(mismatches == 0);
+    }
+#endif
+
+    SECTION("Square root")
+    {
+        using GHULBUS_MATH_NAMESPACE::sqrt;
+        CHECK(sqrt(Q16_16(0)) == Q16_16(0));
+        CHECK(sqrt(Q16_16(-4)) == Q16_16(0));
+        CHECK(sqrt(std::numeric_limits<Q32_32>::lowest()) == Q32_32(0));
+        CHECK(sqrt(Q16_16(4)) == Q16_16(2));
+        CHECK(sqrt(Q16_16(0.25)) == Q16_16(0.5));
+        CHECK(sqrt(Q16_16(2)) == Q16_16::from_raw(92682));
+        CHECK(sqrt(Q32_32(2)) == Q32_32::from_raw(6074001000));
+        CHECK(sqrt(std::numeric_limits<Q16_16>::max()) == Q16_16(181.01933598375618));
+        CHECK(sqrt(std::numeric_limits<Q32_32>::max()).raw() == 199032864766430);
+        // largest number of fractional bits, where the remainder exceeds the width of the representation
+        using Q1_30 = GHULBUS_MATH_NAMESPACE::FixedPoint<std::int32_t, 30>;
+        CHECK(sqrt(std::numeric_limits<Q1_30>::max()).raw() == 1518500250);
+        using Q1_62 = GHULBUS_MATH_NAMESPACE::FixedPoint<std::int64_t, 62>;
+        CHECK(sqrt(std::numeric_limits<Q1_62>::max()).raw() == 6521908912666391106);
+        // results are rounded to nearest
+        std::mt19937 rng(42);
+        for (int i = 0; i < 10000; ++i) {
+            Q16_16 const x = Q16_16::from_raw(static_cast<std::int32_t>(rng() >> 1));
+            double const expected = std::sqrt(static_cast<double>(x.raw()) * 65536.0);
+            CHECK(std::abs(static_cast<double>(sqrt(x).raw()) - expected) <= 0.5);
+        }
+    }
+
+    SECTION("Sine and cosine")
+    {
+        using GHULBUS_MATH_NAMESPACE::cos;
+        using GHULBUS_MATH_NAMESPACE::sin;
+        CHECK(sin(Q16_16(0)) == Q16_16(0));
+        CHECK(cos(Q16_16(0)) == Q16_16(1));
+        CHECK(sin(Q32_32(0)) == Q32_32(0));
+        CHECK(cos(Q32_32(0)) == Q32_32(1));
+        for (int i = -2000; i <= 2000; ++i) {
+            double const x = i * 0.01;
+            double const error16 = std::max(std::abs(static_cast<double>(sin(Q16_16(x))) - std::sin(x)),
+                                            std::abs(static_cast<double>(cos(Q16_16(x))) - std::cos(x)));
+            CHECK(error16 < 1e-4);
+            double const error32 = std::max(std::abs(static_cast<double>(sin(Q32_32(x))) - std::sin(x)),
+                                            std::abs(static_cast<double>(cos(Q32_32(x))) - std::cos(x)));
+            CHECK(error32 < 1e-8);
+        }
+        // the argument reduction does not lose accuracy for large arguments
+        CHECK(std::abs(static_cast<double>(sin(Q16_16(1000))) - std::sin(1000.0)) < 1e-4);
+        CHECK(std::abs(static_cast<double>(sin(Q16_16(10000))) - std::sin(10000.0)) < 1e-4);
+        CHECK(std::abs(static_cast<double>(sin(Q16_16(30000))) - std::sin(30000.0)) < 1e-4);
+        double max_error16 = 0.0;
+        double max_error32 = 0.0;
+        for (int i = 0; i <= 4000; ++i) {
+            // inputs are converted back to double exactly, so std::sin sees the same argument
+            double const x16 = static_cast<double>(Q16_16(-32767.0 + i * 16.383 + 0.123));
+            max_error16 = std::max({ max_error16,
+                                     std::abs(static_cast<double>(sin(Q16_16(x16))) - std::sin(x16)),
+                                     std::abs(static_cast<double>(cos(Q16_16(x16))) - std::cos(x16)) });
+            double const x32 = static_cast<double>(Q32_32(-1e6 + i * 500.0 + 0.123));
+            max_error32 = std::max({ max_error32,
+                                     std::abs(static_cast<double>(sin(Q32_32(x32))) - std::sin(x32)),
+                                     std::abs(static_cast<double>(cos(Q32_32(x32))) - std::cos(x32)) });
+        }
+        CHECK(max_error16 < 1e-4);
+        CHECK(max_error32 < 1e-8);
+        // compile time and run time evaluation agree
+        constexpr Q32_32 sin_ct = sin(Q32_32(1));
+        constexpr Q16_16 cos_ct = cos(Q16_16(-7.5));
+        Q32_32 runtime_input(1);
+        CHECK(sin(runtime_input) == sin_ct);
+        CHECK(cos(Q16_16(-7.5)) == cos_ct);
+    }
+
+    SECTION("Traits")
+    {
+        static_assert(traits::Constants<Q16_16>::Zero().raw() == 0);
+        CHECK(traits::Constants<Q16_16>::One() == Q16_16(1));
+        CHECK(traits::Constants<Q32_32>::One() == Q32_32(1));
+        CHECK(traits::Pi<Q16_16>::value == Q16_16(3.14159265358979));
+        CHECK(traits::Pi<Q32_32>::value == Q32_32(3.14159265358979323846));
+        CHECK(std::numeric_limits<Q16_16>::epsilon().raw() == 1);
+        CHECK(std::numeric_limits<Q16_16>::max().raw() == std::numeric_limits<std::int32_t>::max());
+        CHECK(std::numeric_limits<Q32_32>::lowest().raw() == std::numeric_limits<std::int64_t>::min());
+    }
+}
+
+TEST_CASE("FixedPoint geometry")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB2;
+    using GHULBUS_MATH_NAMESPACE::Circle2;
+    using GHULBUS_MATH_NAMESPACE::Matrix2;
+    using GHULBUS_MATH_NAMESPACE::Point2;
+    using GHULBUS_MATH_NAMESPACE::Q16_16;
+    using GHULBUS_MATH_NAMESPACE::Q32_32;
+    using GHULBUS_MATH_NAMESPACE::Transform2;
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using Q = Q16_16;
+
+    SECTION("Vector2")
+    {
+        Vector2<Q> const v1(Q(1.5), Q(-2));
+        Vector2<Q> const v2(Q(0.5), Q(4));
+        CHECK(v1 + v2 == Vector2<Q>(Q(2), Q(2)));
+        CHECK(v1 - v2 == Vector2<Q>(Q(1), Q(-6)));
+        CHECK(v1 * Q(2) == Vector2<Q>(Q(3), Q(-4)));
+        CHECK(dot(v1, v2) == Q(-7.25));
+        Point2<Q32_32> p(Q32_32(1), Q32_32(2));
+        p += Vector2<Q32_32>(Q32_32(0.25), Q32_32(0.5));
+        CHECK(p == Point2<Q32_32>(Q32_32(1.25), Q32_32(2.5)));
+        CHECK(p - Point2<Q32_32>(Q32_32(1), Q32_32(1)) == Vector2<Q32_32>(Q32_32(0.25), Q32_32(1.5)));
+    }
+
+    SECTION("Matrix2")
+    {
+        Matrix2<Q> const m(Q(1), Q(2),
+                           Q(3), Q(4));
+        CHECK(determinant(m) == Q(-2));
+        CHECK(transpose(m) == Matrix2<Q>(Q(1), Q(3), Q(2), Q(4)));
+        CHECK(m * m == Matrix2<Q>(Q(7), Q(10), Q(15), Q(22)));
+        CHECK(m * Vector2<Q>(Q(1), Q(-1)) == Vector2<Q>(Q(-1), Q(-1)));
+        CHECK(adjugate(m) == Matrix2<Q>(Q(4), Q(-2), Q(-3), Q(1)));
+    }
+
+    SECTION("Transform2")
+    {
+        using GHULBUS_MATH_NAMESPACE::cos;
+        using GHULBUS_MATH_NAMESPACE::make_scale2;
+        using GHULBUS_MATH_NAMESPACE::make_translation;
+        using GHULBUS_MATH_NAMESPACE::sin;
+        Transform2<Q> const t = make_translation(Q(1), Q(2)) * make_scale2(Q(0.5));
+        CHECK(t * Point2<Q>(Q(4), Q(-2)) == Point2<Q>(Q(3), Q(1)));
+        CHECK(t * Vector2<Q>(Q(4), Q(-2)) == Vector2<Q>(Q(2), Q(-1)));
+        CHECK(t.translation() == Vector2<Q>(Q(1), Q(2)));
+        // a rotation built from the fixed-point trigonometric functions
+        Q32_32 const angle = GHULBUS_MATH_NAMESPACE::traits::Pi<Q32_32>::value / Q32_32(2);
+        Q32_32 const s = sin(angle);
+        Q32_32 const c = cos(angle);
+        Q32_32 const z(0);
+        Transform2<Q32_32> const rotation(c, -s, z,
+                                          s,  c, z,
+                                          z,  z, Q32_32(1));
+        Point2<Q32_32> const rotated = rotation * Point2<Q32_32>(Q32_32(2), Q32_32(0));
+        CHECK(static_cast<double>(rotated.x) == Approx(0.0).margin(1e-8));
+        CHECK(static_cast<double>(rotated.y) == Approx(2.0).margin(1e-8));
+        // deterministic: the same computation gives bit-identical results
+        CHECK(rotation * Point2<Q32_32>(Q32_32(2), Q32_32(0)) == rotated);
+    }
+
+    SECTION("AABB2")
+    {
+        using GHULBUS_MATH_NAMESPACE::empty_aabb2;
+        AABB2<Q> const b = AABB2<Q>::from_points({ Point2<Q>(Q(1), Q(-1)), Point2<Q>(Q(-2), Q(3)),
+                                                   Point2<Q>(Q(0.5), Q(0.5)) });
+        CHECK(b.min == Point2<Q>(Q(-2), Q(-1)));
+        CHECK(b.max == Point2<Q>(Q(1), Q(3)));
+        CHECK(intersects(b, Point2<Q>(Q(0), Q(0))));
+        CHECK(!intersects(b, Point2<Q>(Q(2), Q(0))));
+        CHECK(distance_squared(b, Point2<Q>(Q(3), Q(5))) == Q(8));
+        CHECK(closest_point(b, Point2<Q>(Q(3), Q(0))) == Point2<Q>(Q(1), Q(0)));
+        AABB2<Q> const e = empty_aabb2<Q>();
+        CHECK(enclose(e, Point2<Q>(Q(1), Q(2))).min == Point2<Q>(Q(1), Q(2)));
+    }
+
+    SECTION("Circle2")
+    {
+        using GHULBUS_MATH_NAMESPACE::collides;
+        Circle2<Q> const c(Point2<Q>(Q(1), Q(1)), Q(2));
+        CHECK(collides(c, Point2<Q>(Q(2), Q(2))));
+        CHECK(!collides(c, Point2<Q>(Q(3), Q(3))));
+        CHECK(collides(c, Circle2<Q>(Point2<Q>(Q(4), Q(1)), Q(1.5))));
+        CHECK(!collides(c, Circle2<Q>(Point2<Q>(Q(5), Q(1)), Q(1.5))));
+        CHECK(collides(c, AABB2<Q>(Point2<Q>(Q(2.5), Q(0)), Point2<Q>(Q(4), Q(1)))));
+        CHECK(!collides(c, AABB2<Q>(Point2<Q>(Q(3.5), Q(0)), Point2<Q>(Q(4), Q(1)))));
+    }
+}
@@ -0,0 +1,220 @@
+#include <gbMath/Half.hpp>
+
+#include <catch.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+TEST_CASE("Half")
+{
+    using GHULBUS_MATH_NAMESPACE::BFloat16;
+    using GHULBUS_MATH_NAMESPACE::Color4;
+    using GHULBUS_MATH_NAMESPACE::Half;
+    using GHULBUS_MATH_NAMESPACE::Normal3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::Vector4;
+    using GHULBUS_MATH_NAMESPACE::half_detail::bfloat16_bits_to_float;
+    using GHULBUS_MATH_NAMESPACE::half_detail::float_to_bfloat16_bits;
+    using GHULBUS_MATH_NAMESPACE::half_detail::float_to_half_bits;
+    using GHULBUS_MATH_NAMESPACE::half_detail::half_bits_to_float;
+    namespace traits = GHULBUS_MATH_NAMESPACE::traits;
+    float const inf = std::numeric_limits<float>::infinity();
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+
+    SECTION("Half conversion")
+    {
+        CHECK(float_to_half_bits(0.f) == 0x0000);
+        CHECK(float_to_half_bits(-0.f) == 0x8000);
+        CHECK(float_to_half_bits(1.f) == 0x3c00);
+        CHECK(float_to_half_bits(-2.f) == 0xc000);
+        CHECK(float_to_half_bits(65504.f) == 0x7bff);
+        CHECK(float_to_half_bits(0.333251953125f) == 0x3555);
+        // overflow, infinity and NaN
+        CHECK(float_to_half_bits(65536.f) == 0x7c00);
+        CHECK(float_to_half_bits(-1e10f) == 0xfc00);
+        CHECK(float_to_half_bits(inf) == 0x7c00);
+        CHECK(float_to_half_bits(-inf) == 0xfc00);
+        CHECK((float_to_half_bits(nan) & 0x7fff) > 0x7c00);
+        // denormals and underflow
+        CHECK(float_to_half_bits(std::ldexp(1.f, -24)) == 0x0001);
+        CHECK(float_to_half_bits(std::ldexp(1.f, -14) - std::ldexp(1.f, -24)) == 0x03ff);
+        CHECK(float_to_half_bits(std::ldexp(1.f, -26)) == 0x0000);
+        // ties round to even
+        CHECK(float_to_half_bits(1.f + std::ldexp(1.f, -11)) == 0x3c00);
+        CHECK(float_to_half_bits(1.f + 3.f * std::ldexp(1.f, -11)) == 0x3c02);
+        CHECK(float_to_half_bits(65519.f) == 0x7bff);
+        CHECK(float_to_half_bits(65520.f) == 0x7c00);
+
+        CHECK(half_bits_to_float(0x3c00) == 1.f);
+        CHECK(half_bits_to_float(0xc000) == -2.f);
+        CHECK(half_bits_to_float(0x7bff) == 65504.f);
+        CHECK(half_bits_to_float(0x0001) == std::ldexp(1.f, -24));
+        CHECK(half_bits_to_float(0x7c00) == inf);
+        CHECK(half_bits_to_float(0xfc00) == -inf);
+        CHECK(std::isnan(half_bits_to_float(0x7e00)));
+        CHECK(std::signbit(half_bits_to_float(0x8000)));
+        // all non-NaN values survive a round trip
+        for (std::uint32_t i = 0; i < 0x10000; ++i) {
+            auto const h = static_cast<std::uint16_t>(i);
+            if ((h & 0x7fff) > 0x7c00) {
+                CHECK(std::isnan(half_bits_to_float(h)));
+            } else if (float_to_half_bits(half_bits_to_float(h)) != h) {
+                FAIL_CHECK("Round trip failed for " << i);
+            }
+        }
+        static_assert(float_to_half_bits(1.f) == 0x3c00);
+        static_assert(half_bits_to_float(0x3c00) == 1.f);
+    }
+
+    SECTION("BFloat16 conversion")
+    {
+        CHECK(float_to_bfloat16_bits(0.f) == 0x0000);
+        CHECK(float_to_bfloat16_bits(-0.f) == 0x8000);
+        CHECK(float_to_bfloat16_bits(1.f) == 0x3f80);
+        CHECK(float_to_bfloat16_bits(-2.f) == 0xc000);
+        CHECK(float_to_bfloat16_bits(inf) == 0x7f80);
+        CHECK(float_to_bfloat16_bits(-inf) == 0xff80);
+        CHECK(float_to_bfloat16_bits(std::numeric_limits<float>::max()) == 0x7f80);
+        CHECK((float_to_bfloat16_bits(nan) & 0x7fff) > 0x7f80);
+        // NaNs with a payload only in the truncated bits stay NaN
+        CHECK((float_to_bfloat16_bits(std::bit_cast<float>(0x7f800001u)) & 0x7fff) > 0x7f80);
+        // ties round to even
+        CHECK(float_to_bfloat16_bits(std::bit_cast<float>(0x3f808000u)) == 0x3f80);
+        CHECK(float_to_bfloat16_bits(std::bit_cast<float>(0x3f818000u)) == 0x3f82);
+        CHECK(float_to_bfloat16_bits(std::bit_cast<float>(0x3f808001u)) == 0x3f81);
+
+        CHECK(bfloat16_bits_to_float(0x3f80) == 1.f);
+        CHECK(bfloat16_bits_to_float(0xc000) == -2.f);
+        CHECK(bfloat16_bits_to_float(0x7f80) == inf);
+        // all non-NaN values survive a round trip
+        for (std::uint32_t i = 0; i < 0x10000; ++i) {
+            auto const b = static_cast<std::uint16_t>(i);
+            if ((b & 0x7fff) > 0x7f80) {
+                CHECK(std::isnan(bfloat16_bits_to_float(b)));
+            } else if (float_to_bfloat16_bits(bfloat16_bits_to_float(b)) != b) {
+                FAIL_CHECK("Round trip failed for " << i);
+            }
+        }
+    }
+
+    SECTION("Arithmetic")
+    {
+        static_assert(sizeof(Half) == 2);
+        static_assert(sizeof(BFloat16) == 2);
+        CHECK(Half().bits() == 0);
+        CHECK(Half(1.f).bits() == 0x3c00);
+        CHECK(Half::from_bits(0x3c00) == Half(1.f));
+        CHECK(static_cast<float>(Half(0.1f)) == half_bits_to_float(float_to_half_bits(0.1f)));
+        CHECK(Half(1.f) + Half(2.f) == Half(3.f));
+        CHECK(Half(1.f) - Half(2.f) == Half(-1.f));
+        CHECK(Half(3.f) * Half(0.5f) == Half(1.5f));
+        CHECK(Half(3.f) / Half(2.f) == Half(1.5f));
+        CHECK(-Half(2.f) == Half(-2.f));
+        CHECK((-Half(0.f)).bits() == 0x8000);
+        CHECK(Half(0.f) == -Half(0.f));
+        CHECK(Half(1.f) < Half(2.f));
+        CHECK(!(Half(nan) == Half(nan)));
+        // results are rounded to 16 bit
+        CHECK(Half(2048.f) + Half(1.f) == Half(2048.f));
+        CHECK(BFloat16(256.f) + BFloat16(1.f) == BFloat16(256.f));
+        Half h(1.f);
+        h += Half(2.f);
+        CHECK(h == Half(3.f));
+        h -= Half(1.f);
+        CHECK(h == Half(2.f));
+        h *= Half(4.f);
+        CHECK(h == Half(8.f));
+        h /= Half(2.f);
+        CHECK(h == Half(4.f));
+        // mixed arithmetic is performed in float
+        CHECK(Half(1.f) + 0.25f == 1.25f);
+        CHECK(BFloat16(2.f) * 3 == 6.f);
+        CHECK(BFloat16(1.f) + BFloat16(0.5f) == BFloat16(1.5f));
+    }
+
+    SECTION("Traits")
+    {
+        static_assert(traits::Constants<Half>::Zero().bits() == 0);
+        CHECK(traits::Constants<Half>::One() == Half(1.f));
+        CHECK(traits::Constants<BFloat16>::Zero() == BFloat16(0.f));
+        CHECK(traits::Constants<BFloat16>::One() == BFloat16(1.f));
+        CHECK(traits::Pi<Half>::value == Half(traits::Pi<float>::value));
+        CHECK(traits::Pi<BFloat16>::value == BFloat16(traits::Pi<float>::value));
+    }
+
+    SECTION("Vector types")
+    {
+        static_assert(sizeof(Vector3<Half>) == 6);
+        static_assert(sizeof(Vector4<BFloat16>) == 8);
+        Vector3<Half> const v1(Half(1.f), Half(2.f), Half(3.f));
+        Vector3<Half> const v2(Half(0.5f), Half(0.5f), Half(0.5f));
+        CHECK(v1 + v2 == Vector3<Half>(Half(1.5f), Half(2.5f), Half(3.5f)));
+        CHECK(v1 - v2 == Vector3<Half>(Half(0.5f), Half(1.5f), Half(2.5f)));
+        CHECK(v1 * Half(2.f) == Vector3<Half>(Half(2.f), Half(4.f), Half(6.f)));
+        CHECK(dot(v1, v2) == Half(3.f));
+        CHECK(v1 != v2);
+        CHECK(Vector3<float>(v1) == Vector3<float>(1.f, 2.f, 3.f));
+        Color4<Half> const c(Half(0.25f), Half(0.5f), Half(1.f));
+        CHECK(c.a == traits::Constants<Half>::One());
+    }
+
+    SECTION("Bulk conversion")
+    {
+        std::vector<float> scalars;
+        std::vector<Point3<float>> points;
+        std::vector<Vector4<float>> vectors;
+        std::vector<Color4<float>> colors;
+        for (int i = 0; i < 1000; ++i) {
+            float const f = static_cast<float>(i) * 0.37f - 100.f;
+            scalars.push_back(f);
+            points.emplace_back(f, -f, f * 0.001f);
+            vectors.emplace_back(f, f + 1.f, f * f, 1.f / f);
+            colors.emplace_back(f * 0.001f, 0.5f, f, 1.f);
+        }
+
+        std::vector<Half> half_scalars(scalars.size());
+        convert(std::span<float const>(scalars), std::span<Half>(half_scalars));
+        std::vector<float> float_scalars(scalars.size());
+        convert(std::span<Half const>(half_scalars), std::span<float>(float_scalars));
+        std::vector<BFloat16> bfloat_scalars(scalars.size());
+        convert(std::span<Half const>(half_scalars), std::span<BFloat16>(bfloat_scalars));
+        for (std::size_t i = 0; i < scalars.size(); ++i) {
+            CHECK(half_scalars[i].bits() == float_to_half_bits(scalars[i]));
+            CHECK(float_scalars[i] == half_bits_to_float(half_scalars[i].bits()));
+            CHECK(bfloat_scalars[i] == BFloat16(static_cast<float>(half_scalars[i])));
+        }
+
+        std::vector<Point3<Half>> half_points(points.size());
+        convert(std::span<Point3<float> const>(points), std::span<Point3<Half>>(half_points));
+        std::vector<Point3<float>> float_points(points.size());
+        convert(std::span<Point3<Half> const>(half_points), std::span<Point3<float>>(float_points));
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            CHECK(half_points[i] == Point3<Half>(Half(points[i].x), Half(points[i].y), Half(points[i].z)));
+            CHECK(float_points[i] == Point3<float>(half_points[i]));
+            // relative error of binary16 is bounded by 2^-11 for values in the normal range
+            CHECK(float_points[i].x == Approx(points[i].x).epsilon(1.0 / 2048.0).margin(1e-4));
+        }
+
+        std::vector<Vector4<BFloat16>> bfloat_vectors(vectors.size());
+        convert(std::span<Vector4<float> const>(vectors), std::span<Vector4<BFloat16>>(bfloat_vectors));
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            CHECK(bfloat_vectors[i] == Vector4<BFloat16>(BFloat16(vectors[i].x), BFloat16(vectors[i].y),
+                                                         BFloat16(vectors[i].z), BFloat16(vectors[i].w)));
+        }
+
+        std::vector<Color4<Half>> half_colors(colors.size());
+        convert(std::span<Color4<float> const>(colors), std::span<Color4<Half>>(half_colors));
+        std::vector<Color4<float>> float_colors(colors.size());
+        convert(std::span<Color4<Half> const>(half_colors), std::span<Color4<float>>(float_colors));
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            CHECK(half_colors[i] == Color4<Half>(Half(colors[i].r), Half(colors[i].g), Half(colors[i].b),
+                                                 Half(colors[i].a)));
+            CHECK(float_colors[i].g == 0.5f);
+        }
+    }
+}
@@ -0,0 +1,193 @@
+#include <gbMath/KdTree3.hpp>
+#include <gbMath/VectorIO3.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+TEST_CASE("KdTree3")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::KdTree3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using Neighbor = KdTree3<double>::Neighbor;
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    auto const random_point = [&]() { return Point3<double>(dist(rng), dist(rng), dist(rng)); };
+
+    std::vector<Point3<double>> points;
+    for (int i = 0; i < 3000; ++i) { points.push_back(random_point()); }
+    // duplicates and points on a plane exercise degenerate splits
+    for (int i = 0; i < 100; ++i) { points.push_back(points[i]); }
+    for (int i = 0; i < 200; ++i) { points.push_back(Point3<double>(dist(rng), dist(rng), 0.5)); }
+
+    auto const brute_force_nearest = [&](Point3<double> const& q, std::size_t k) {
+        std::vector<Neighbor> all;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            all.push_back(Neighbor{ i, dot(points[i] - q, points[i] - q) });
+        }
+        std::sort(begin(all), end(all), [](Neighbor const& lhs, Neighbor const& rhs) {
+                return lhs.distance_squared < rhs.distance_squared;
+            });
+        all.erase(begin(all) + static_cast<std::ptrdiff_t>(std::min(k, all.size())), end(all));
+        return all;
+    };
+
+    SECTION("Empty tree")
+    {
+        KdTree3<double> tree;
+        CHECK(tree.empty());
+        CHECK(tree.size() == 0);
+        Neighbor const n = tree.nearest(Point3<double>(0, 0, 0));
+        CHECK(n.index == KdTree3<double>::null_index);
+        CHECK(n.distance_squared == std::numeric_limits<double>::infinity());
+        int count = 0;
+        tree.query(Sphere3<double>(Point3<double>(0, 0, 0), 100.0), [&](std::size_t, double) { ++count; });
+        tree.query(AABB3<double>(Point3<double>(-1, -1, -1), Point3<double>(1, 1, 1)), [&](std::size_t) { ++count; });
+        CHECK(count == 0);
+    }
+
+    SECTION("Single point")
+    {
+        std::vector<Point3<double>> const single{ Point3<double>(1, 2, 3) };
+        KdTree3<double> tree(single);
+        CHECK(tree.size() == 1);
+        CHECK(tree.bounds() == AABB3<double>(Point3<double>(1, 2, 3), Point3<double>(1, 2, 3)));
+        std::vector<Neighbor> result(3);
+        CHECK(tree.nearest(Point3<double>(0, 0, 0), result) == 1);
+        CHECK(result[0].index == 0);
+        CHECK(result[0].distance_squared == 14.0);
+        CHECK(result[1].index == KdTree3<double>::null_index);
+        CHECK(result[2].index == KdTree3<double>::null_index);
+    }
+
+    for (std::size_t const leaf_size : { std::size_t{ 1 }, std::size_t{ 5 }, std::size_t{ 16 }, std::size_t{ 64 } }) {
+        KdTree3<double> const tree(points, leaf_size);
+        CHECK(tree.size() == points.size());
+        CHECK(tree.leaf_size() == leaf_size);
+
+        SECTION("Nearest neighbor matches brute force, leaf size " + std::to_string(leaf_size))
+        {
+            for (int q = 0; q < 100; ++q) {
+                Point3<double> const query = random_point();
+                Neighbor const n = tree.nearest(query);
+                CHECK(n.distance_squared == brute_force_nearest(query, 1)[0].distance_squared);
+                CHECK(dot(points[n.index] - query, points[n.index] - query) == n.distance_squared);
+            }
+            // query points from the set find themselves
+            for (std::size_t i = 0; i < points.size(); i += 37) {
+                CHECK(tree.nearest(points[i]).distance_squared == 0.0);
+            }
+        }
+
+        SECTION("k nearest neighbors match brute force, leaf size " + std::to_string(leaf_size))
+        {
+            std::vector<Neighbor> result(10);
+            for (int q = 0; q < 50; ++q) {
+                Point3<double> const query = random_point();
+                CHECK(tree.nearest(query, result) == 10);
+                auto const expected = brute_force_nearest(query, 10);
+                for (std::size_t i = 0; i < 10; ++i) {
+                    CHECK(result[i].distance_squared == expected[i].distance_squared);
+                }
+            }
+        }
+
+        SECTION("Radius query matches brute force, leaf size " + std::to_string(leaf_size))
+        {
+            for (int q = 0; q < 50; ++q) {
+                Sphere3<double> const s(random_point(), 2.0);
+                std::vector<std::size_t> found;
+                tree.query(s, [&](std::size_t index, double d2) {
+                        CHECK(d2 == dot(points[index] - s.center, points[index] - s.center));
+                        found.push_back(index);
+                    });
+                std::sort(begin(found), end(found));
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (collides(s, points[i])) { expected.push_back(i); }
+                }
+                CHECK(found == expected);
+            }
+        }
+
+        SECTION("Box query matches brute force, leaf size " + std::to_string(leaf_size))
+        {
+            for (int q = 0; q < 50; ++q) {
+                Point3<double> const p = random_point();
+                AABB3<double> const box(p, p + Vector3<double>(3, 2, 1));
+                std::vector<std::size_t> found;
+                tree.query(box, [&](std::size_t index) { found.push_back(index); });
+                std::sort(begin(found), end(found));
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < points.size(); ++i) {
+                    if (intersects(box, points[i])) { expected.push_back(i); }
+                }
+                CHECK(found == expected);
+            }
+        }
+    }
+
+    SECTION("Build with parallel_for")
+    {
+        std::size_t task_count = 0;
+        KdTree3<double> const tree(points, 8, [&task_count](std::size_t count, auto&& f) {
+                task_count = count;
+                // run the tasks in reverse order to check that they are independent
+                for (std::size_t i = count; i > 0; --i) { f(i - 1); }
+            });
+        CHECK(task_count == 16);
+        KdTree3<double> const sequential_tree(points, 8);
+        for (int q = 0; q < 20; ++q) {
+            Point3<double> const query = random_point();
+            CHECK(tree.nearest(query).index == sequential_tree.nearest(query).index);
+        }
+    }
+
+    SECTION("Batched queries")
+    {
+        KdTree3<double> const tree(points);
+        std::vector<Point3<double>> queries;
+        for (int i = 0; i < 200; ++i) { queries.push_back(random_point()); }
+        std::size_t const k = 4;
+        std::vector<Neighbor> results(queries.size() * k);
+        tree.nearest(queries, k, results);
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            auto const expected = brute_force_nearest(queries[i], k);
+            for (std::size_t j = 0; j < k; ++j) {
+                CHECK(results[i * k + j].distance_squared == expected[j].distance_squared);
+            }
+        }
+
+        std::vector<std::tuple<std::size_t, std::size_t>> found;
+        tree.query(queries, 1.5, [&](std::size_t qi, std::size_t index, double) { found.emplace_back(qi, index); });
+        std::sort(begin(found), end(found));
+        std::vector<std::tuple<std::size_t, std::size_t>> expected;
+        for (std::size_t qi = 0; qi < queries.size(); ++qi) {
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                if (collides(Sphere3<double>(queries[qi], 1.5), points[i])) { expected.emplace_back(qi, i); }
+            }
+        }
+        CHECK(found == expected);
+    }
+
+    SECTION("Float")
+    {
+        std::vector<Point3<float>> fpoints;
+        for (auto const& p : points) {
+            fpoints.emplace_back(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z));
+        }
+        KdTree3<float> const tree(fpoints);
+        auto const n = tree.nearest(fpoints[123]);
+        CHECK(n.distance_squared == 0.f);
+    }
+}
@@ -105,6 +105,50 @@ TEST_CASE("Line3")
         CHECK(length(l.v) == Approx(1.f));
     }
 
+    SECTION("Normalized line")
+    {
+        Line3<float> const l(Point3<float>(1.f, 2.f, 3.f), Point3<float>(-4.f, 5.f, -6.f));
+        GHULBUS_MATH_NAMESPACE::NormalizedLine3<float> const nl(l);
+        CHECK(nl.p == l.p);
+        CHECK(nl.v == normalized(l).v);
+        CHECK(nl.evaluate_at_parameter(2.f) == nl.p + nl.v * 2.f);
+        Line3<float> const converted = nl;
+        CHECK(converted.v == nl.v);
+    }
+
+    SECTION("Segment-segment closest points")
+    {
+        // crossing segments
+        Line3<float> const s1(Point3<float>(-1.f, 0.f, 0.f), Point3<float>(1.f, 0.f, 0.f));
+        Line3<float> const s2(Point3<float>(0.f, -1.f, 2.f), Point3<float>(0.f, 3.f, 2.f));
+        auto params = closest_parameters_segment(s1, s2);
+        CHECK(params.s == 0.5f);
+        CHECK(params.t == 0.25f);
+        CHECK(distance_squared_segment(s1, s2) == 4.f);
+        // closest points at end points
+        Line3<float> const s3(Point3<float>(3.f, 1.f, 0.f), Point3<float>(5.f, 4.f, 0.f));
+        params = closest_parameters_segment(s1, s3);
+        CHECK(params.s == 1.f);
+        CHECK(params.t == 0.f);
+        CHECK(distance_squared_segment(s1, s3) == 5.f);
+        // parallel segments
+        Line3<float> const s4(Point3<float>(0.f, 1.f, 0.f), Point3<float>(4.f, 1.f, 0.f));
+        CHECK(distance_squared_segment(s1, s4) == 1.f);
+        CHECK(distance_squared_segment(s4, s1) == 1.f);
+        Line3<float> const s5(Point3<float>(3.f, 1.f, 0.f), Point3<float>(6.f, 1.f, 0.f));
+        CHECK(distance_squared_segment(s1, s5) == 5.f);
+        // degenerate segments
+        Line3<float> const p1(Point3<float>(0.5f, 2.f, 0.f), Vector3<float>(0.f, 0.f, 0.f));
+        params = closest_parameters_segment(s1, p1);
+        CHECK(params.s == 0.75f);
+        CHECK(params.t == 0.f);
+        params = closest_parameters_segment(p1, s1);
+        CHECK(params.s == 0.f);
+        CHECK(params.t == 0.75f);
+        CHECK(distance_squared_segment(p1, s1) == 4.f);
+        CHECK(distance_squared_segment(p1, p1) == 0.f);
+    }
+
     SECTION("Distance Point-Line")
     {
         Test_PointLineDistance<float>()();
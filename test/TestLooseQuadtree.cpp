@@ -0,0 +1,231 @@
+#include <gbMath/LooseQuadtree.hpp>
+#include <gbMath/VectorIO2.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("LooseQuadtree")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB2;
+    using GHULBUS_MATH_NAMESPACE::Circle2;
+    using GHULBUS_MATH_NAMESPACE::Line2;
+    using GHULBUS_MATH_NAMESPACE::LooseQuadtree;
+    using GHULBUS_MATH_NAMESPACE::Point2;
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using Tree = LooseQuadtree<double>;
+    using ElementId = Tree::ElementId;
+
+    AABB2<double> const world(Point2<double>(0, 0), Point2<double>(1000, 1000));
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> pos_dist(0.0, 1000.0);
+    std::uniform_real_distribution<double> size_dist(0.1, 20.0);
+    auto const random_box = [&]() {
+        Point2<double> const p(pos_dist(rng), pos_dist(rng));
+        return AABB2<double>(p, p + Vector2<double>(size_dist(rng), size_dist(rng)));
+    };
+
+    SECTION("Empty tree")
+    {
+        Tree tree(world);
+        CHECK(tree.empty());
+        CHECK(tree.size() == 0);
+        CHECK(tree.node_count() == 1);
+        CHECK(tree.max_depth() == 8);
+        CHECK(tree.world() == world);
+        int count = 0;
+        tree.query(world, [&](ElementId) { ++count; });
+        tree.query(Circle2<double>(Point2<double>(500, 500), 1000), [&](ElementId) { ++count; });
+        tree.query(Line2<double>(Point2<double>(0, 0), Vector2<double>(1, 1)), 1000.0,
+                   [&](ElementId, double) { ++count; });
+        CHECK(count == 0);
+    }
+
+    SECTION("Elements are placed by size")
+    {
+        Tree tree(world, 4);
+        // large elements stay near the root, small elements go to the deepest level
+        tree.insert(AABB2<double>(Point2<double>(100, 100), Point2<double>(900, 900)), 0);
+        CHECK(tree.node_count() == 1);
+        tree.insert(AABB2<double>(Point2<double>(10, 10), Point2<double>(11, 11)), 1);
+        CHECK(tree.node_count() == 5);
+        // elements outside the world are kept at the root
+        tree.insert(AABB2<double>(Point2<double>(-50, -50), Point2<double>(-49, -49)), 2);
+        CHECK(tree.node_count() == 5);
+        CHECK(tree.size() == 3);
+        std::vector<std::size_t> hits;
+        tree.query(AABB2<double>(Point2<double>(-60, -60), Point2<double>(20, 20)),
+                   [&](ElementId id) { hits.push_back(tree.user_data(id)); });
+        std::sort(begin(hits), end(hits));
+        CHECK(hits == std::vector<std::size_t>{ 1, 2 });
+    }
+
+    std::vector<AABB2<double>> boxes;
+    for (int i = 0; i < 2000; ++i) { boxes.push_back(random_box()); }
+    std::vector<std::size_t> payload(boxes.size());
+    std::iota(begin(payload), end(payload), std::size_t{ 0 });
+
+    Tree tree(world);
+    std::vector<ElementId> ids = tree.insert(std::span<AABB2<double> const>(boxes),
+                                             std::span<std::size_t const>(payload));
+    REQUIRE(ids.size() == boxes.size());
+    CHECK(tree.size() == boxes.size());
+
+    auto const collect = [&](auto const& shape) {
+        std::vector<std::size_t> ret;
+        tree.query(shape, [&](ElementId id) { ret.push_back(tree.user_data(id)); });
+        std::sort(begin(ret), end(ret));
+        return ret;
+    };
+
+    SECTION("Bulk load assigns ids in input order")
+    {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            CHECK(tree.user_data(ids[i]) == i);
+            CHECK(tree.bounds(ids[i]) == boxes[i]);
+        }
+    }
+
+    SECTION("Bulk load matches incremental insertion")
+    {
+        Tree incremental(world);
+        for (std::size_t i = 0; i < boxes.size(); ++i) { incremental.insert(boxes[i], i); }
+        CHECK(incremental.node_count() == tree.node_count());
+        AABB2<double> const range(Point2<double>(200, 300), Point2<double>(400, 350));
+        std::vector<std::size_t> hits;
+        incremental.query(range, [&](ElementId id) { hits.push_back(incremental.user_data(id)); });
+        std::sort(begin(hits), end(hits));
+        CHECK(hits == collect(range));
+    }
+
+    SECTION("AABB2 range query matches brute force")
+    {
+        for (int q = 0; q < 50; ++q) {
+            Point2<double> const p(pos_dist(rng), pos_dist(rng));
+            AABB2<double> const range(p, p + Vector2<double>(size_dist(rng) * 5, size_dist(rng) * 5));
+            std::vector<std::size_t> expected;
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                if (intersects(boxes[i], range)) { expected.push_back(i); }
+            }
+            CHECK(collect(range) == expected);
+        }
+    }
+
+    SECTION("Circle2 query matches brute force")
+    {
+        for (int q = 0; q < 50; ++q) {
+            Circle2<double> const circle(Point2<double>(pos_dist(rng), pos_dist(rng)), size_dist(rng) * 3);
+            std::vector<std::size_t> expected;
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                if (collides(circle, boxes[i])) { expected.push_back(i); }
+            }
+            CHECK(collect(circle) == expected);
+        }
+    }
+
+    SECTION("Line2 ray query matches brute force")
+    {
+        for (int q = 0; q < 20; ++q) {
+            Line2<double> const ray(Point2<double>(pos_dist(rng), pos_dist(rng)),
+                                    Vector2<double>(pos_dist(rng) - 500.0, pos_dist(rng) - 500.0));
+            double const t_max = 0.5;
+            std::vector<std::pair<std::size_t, double>> expected;
+            for (std::size_t i = 0; i < boxes.size(); ++i) {
+                double const t = GHULBUS_MATH_NAMESPACE::loose_quadtree_detail::ray_entry(
+                    boxes[i], ray, Vector2<double>(1.0 / ray.v.x, 1.0 / ray.v.y));
+                if (t <= t_max) { expected.emplace_back(i, t); }
+            }
+            std::vector<std::pair<std::size_t, double>> hits;
+            tree.query(ray, t_max, [&](ElementId id, double t) { hits.emplace_back(tree.user_data(id), t); });
+            std::sort(begin(hits), end(hits));
+            CHECK(hits == expected);
+
+            auto const [nearest_id, nearest_t] = tree.query_nearest(ray, t_max);
+            if (expected.empty()) {
+                CHECK(nearest_id == Tree::null_index);
+            } else {
+                auto const it = std::min_element(begin(expected), end(expected),
+                    [](auto const& lhs, auto const& rhs) { return lhs.second < rhs.second; });
+                REQUIRE(nearest_id != Tree::null_index);
+                CHECK(nearest_t == it->second);
+            }
+        }
+    }
+
+    SECTION("Ray hit parameter")
+    {
+        Tree t(world);
+        t.insert(AABB2<double>(Point2<double>(10, 10), Point2<double>(20, 20)), 0);
+        t.insert(AABB2<double>(Point2<double>(50, 10), Point2<double>(60, 20)), 1);
+        auto const [id, t_hit] = t.query_nearest(Line2<double>(Point2<double>(0, 15), Vector2<double>(2, 0)), 100.0);
+        REQUIRE(id != Tree::null_index);
+        CHECK(t.user_data(id) == 0);
+        CHECK(t_hit == 5.0);
+        // the ray is limited by t_max
+        CHECK(t.query_nearest(Line2<double>(Point2<double>(0, 15), Vector2<double>(2, 0)), 4.0).first ==
+              Tree::null_index);
+        // the ray starts inside a box
+        CHECK(t.query_nearest(Line2<double>(Point2<double>(55, 15), Vector2<double>(-1, 0)), 100.0).second == 0.0);
+    }
+
+    SECTION("Query can be stopped early")
+    {
+        int count = 0;
+        tree.query(world, [&](ElementId) { ++count; return count < 5; });
+        CHECK(count == 5);
+    }
+
+    SECTION("Remove and update")
+    {
+        std::size_t const initial_nodes = tree.node_count();
+        for (std::size_t i = 0; i < boxes.size(); i += 2) {
+            tree.remove(ids[i]);
+        }
+        CHECK(tree.size() == boxes.size() / 2);
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 1; i < boxes.size(); i += 2) { expected.push_back(i); }
+        CHECK(collect(world) == expected);
+        CHECK(tree.node_count() <= initial_nodes);
+
+        // move the remaining elements around
+        std::uniform_real_distribution<double> offset_dist(-30.0, 30.0);
+        for (int step = 0; step < 10; ++step) {
+            for (std::size_t i = 1; i < boxes.size(); i += 2) {
+                Vector2<double> const d(offset_dist(rng), offset_dist(rng));
+                boxes[i] = AABB2<double>(boxes[i].min + d, boxes[i].max + d);
+                tree.update(ids[i], boxes[i]);
+            }
+        }
+        for (int q = 0; q < 20; ++q) {
+            Circle2<double> const circle(Point2<double>(pos_dist(rng), pos_dist(rng)), 60.0);
+            std::vector<std::size_t> expected_hits;
+            for (std::size_t i = 1; i < boxes.size(); i += 2) {
+                if (collides(circle, boxes[i])) { expected_hits.push_back(i); }
+            }
+            CHECK(collect(circle) == expected_hits);
+        }
+
+        // removing everything returns all nodes but the root to the pool
+        for (std::size_t i = 1; i < boxes.size(); i += 2) {
+            tree.remove(ids[i]);
+        }
+        CHECK(tree.empty());
+        CHECK(tree.node_count() == 1);
+        // freed elements are reused
+        ElementId const id = tree.insert(random_box(), 42);
+        CHECK(id < boxes.size());
+    }
+
+    SECTION("Clear")
+    {
+        tree.clear();
+        CHECK(tree.empty());
+        CHECK(tree.node_count() == 1);
+        CHECK(collect(world).empty());
+    }
+}
@@ -0,0 +1,171 @@
+#include <gbMath/MappedArray.hpp>
+#include <gbMath/VectorBatch.hpp>
+
+#include <catch.hpp>
+
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+class TemporaryFile {
+private:
+    std::filesystem::path m_path;
+public:
+    explicit TemporaryFile(std::string const& name)
+        :m_path(std::filesystem::temp_directory_path() / name)
+    {}
+
+    ~TemporaryFile()
+    {
+        std::error_code ec;
+        std::filesystem::remove(m_path, ec);
+    }
+
+    std::filesystem::path const& path() const
+    {
+        return m_path;
+    }
+
+    void write(std::string const& contents) const
+    {
+        std::ofstream fout(m_path, std::ios_base::binary | std::ios_base::trunc);
+        fout.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    template<typename T>
+    std::string write(std::vector<T> const& values, std::endian byte_order = std::endian::native) const
+    {
+        std::ostringstream sstr;
+        GHULBUS_MATH_NAMESPACE::write_binary(sstr, std::span<T const>(values), byte_order);
+        write(sstr.str());
+        return sstr.str();
+    }
+};
+}
+
+TEST_CASE("MappedArray")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::MappedArray;
+    using GHULBUS_MATH_NAMESPACE::MappedFile;
+    using GHULBUS_MATH_NAMESPACE::MappedPointCloud3;
+    using GHULBUS_MATH_NAMESPACE::MappedTransforms3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Transform3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    TemporaryFile const file("gbMath_TestMappedArray.bin");
+    std::vector<Point3<float>> points;
+    for (int i = 0; i < 5000; ++i) {
+        points.emplace_back(static_cast<float>(i), static_cast<float>(-i), 0.5f * static_cast<float>(i % 100));
+    }
+
+    SECTION("MappedFile")
+    {
+        file.write(std::string("hello"));
+        auto const mapped = MappedFile::open(file.path());
+        REQUIRE(mapped);
+        CHECK(mapped->size() == 5);
+        CHECK(mapped->bytes()[0] == std::byte{ 'h' });
+        CHECK(mapped->bytes()[4] == std::byte{ 'o' });
+        mapped->advise_sequential();
+
+        file.write(std::string());
+        auto const empty_file = MappedFile::open(file.path());
+        REQUIRE(empty_file);
+        CHECK(empty_file->empty());
+
+        CHECK(!MappedFile::open(file.path().parent_path() / "gbMath_TestMappedArray_does_not_exist.bin"));
+    }
+
+    SECTION("Point cloud")
+    {
+        file.write(points);
+        auto cloud = MappedPointCloud3<float>::open(file.path());
+        REQUIRE(cloud);
+        CHECK(cloud->size() == points.size());
+        CHECK(cloud->header().count == points.size());
+        CHECK(std::vector<Point3<float>>(cloud->begin(), cloud->end()) == points);
+        CHECK((*cloud)[1234] == points[1234]);
+        cloud->file().advise_sequential();
+
+        CHECK(AABB3<float>::from_points(cloud->elements()) == AABB3<float>::from_points(std::span(points)));
+
+        Transform3<float> const t(1, 0, 0, 5,
+                                  0, 1, 0, 6,
+                                  0, 0, 1, 7,
+                                  0, 0, 0, 1);
+        AABB3<float> const bounds = transformed_bounds(t, cloud->elements());
+        CHECK(bounds.min == Point3<float>(5, 6 - 4999, 7));
+        CHECK(bounds.max == Point3<float>(5 + 4999, 6, 7 + 49.5f));
+        std::vector<Point3<float>> transformed(cloud->size());
+        transform(t, cloud->elements(), std::span<Point3<float>>(transformed));
+        CHECK(transformed[10] == t * points[10]);
+
+        // the mapping is kept alive by moves
+        MappedPointCloud3<float> moved = std::move(*cloud);
+        CHECK(cloud->empty());
+        CHECK(moved.size() == points.size());
+        CHECK(moved[4999] == points[4999]);
+    }
+
+    SECTION("Compatible element types can be mapped")
+    {
+        file.write(points);
+        auto const vectors = MappedArray<Vector3<float>>::open(file.path());
+        REQUIRE(vectors);
+        CHECK((*vectors)[3] == Vector3<float>(3, -3, 1.5f));
+    }
+
+    SECTION("Transforms")
+    {
+        std::vector<Transform3<double>> transforms;
+        for (int i = 0; i < 10; ++i) {
+            transforms.emplace_back(1, 0, 0, i, 0, 1, 0, 2 * i, 0, 0, 1, 3 * i, 0, 0, 0, 1);
+        }
+        file.write(transforms);
+        auto const mapped = MappedTransforms3<double>::open(file.path());
+        REQUIRE(mapped);
+        REQUIRE(mapped->size() == 10);
+        CHECK((*mapped)[7].m == transforms[7].m);
+        CHECK((*mapped)[7].translation() == Vector3<double>(7, 14, 21));
+    }
+
+    SECTION("Validation")
+    {
+        // wrong element type
+        file.write(points);
+        CHECK(!MappedPointCloud3<double>::open(file.path()));
+        CHECK(!MappedTransforms3<float>::open(file.path()));
+
+        // truncated payload
+        std::string const data = file.write(points);
+        file.write(data.substr(0, data.size() - 1));
+        CHECK(!MappedPointCloud3<float>::open(file.path()));
+
+        // truncated header
+        file.write(data.substr(0, 10));
+        CHECK(!MappedPointCloud3<float>::open(file.path()));
+
+        // no header
+        file.write(std::string(100, '\0'));
+        CHECK(!MappedPointCloud3<float>::open(file.path()));
+
+        // non-native byte order
+        constexpr std::endian other = (std::endian::native == std::endian::little) ? std::endian::big :
+                                                                                     std::endian::little;
+        file.write(points, other);
+        CHECK(!MappedPointCloud3<float>::open(file.path()));
+
+        // empty array
+        file.write(std::vector<Point3<float>>{});
+        auto const empty_cloud = MappedPointCloud3<float>::open(file.path());
+        REQUIRE(empty_cloud);
+        CHECK(empty_cloud->empty());
+    }
+}
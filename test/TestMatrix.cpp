@@ -8,6 +8,7 @@
 
 #include <iterator>
 #include <numeric>
+#include <type_traits>
 
 TEST_CASE("Matrix")
 {
@@ -777,6 +778,262 @@ TEST_CASE("LU Decomposition")
     }
 }
 
+TEST_CASE("Singular Value Decomposition")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::SingularValueDecomposition;
+    using GHULBUS_MATH_NAMESPACE::identityN;
+    using Catch::Approx;
+
+    SECTION("Diagonal matrix")
+    {
+        Matrix<double, 3, 3> const m(2.0, 0.0, 0.0,
+                                     0.0, -5.0, 0.0,
+                                     0.0, 0.0, 3.0);
+        SingularValueDecomposition<double, 3, 3> const svd = sv_decompose(m);
+        CHECK(svd.singular_values == Vector<double, 3>(5.0, 3.0, 2.0));
+        CHECK(svd.getReconstruction() == m);
+    }
+
+    SECTION("Tall matrix")
+    {
+        Matrix<double, 4, 2> const m(1.0, 2.0,
+                                     3.0, 4.0,
+                                     5.0, 6.0,
+                                     7.0, 8.0);
+        auto const svd = sv_decompose(m);
+        static_assert(std::same_as<decltype(svd.u), Matrix<double, 4, 2>>);
+        static_assert(std::same_as<decltype(svd.v), Matrix<double, 2, 2>>);
+        CHECK(svd.singular_values[0] == Approx(14.2690954992));
+        CHECK(svd.singular_values[1] == Approx(0.6268282324));
+        auto const reconstruction = svd.getReconstruction();
+        for (std::size_t i = 0; i < m.m.size(); ++i) {
+            CHECK(reconstruction[i] == Approx(m[i]));
+        }
+        auto const utu = transpose(svd.u) * svd.u;
+        auto const vtv = transpose(svd.v) * svd.v;
+        auto const id = identityN<double, 2>();
+        for (std::size_t i = 0; i < id.m.size(); ++i) {
+            CHECK(utu[i] == Approx(id[i]).margin(1e-12));
+            CHECK(vtv[i] == Approx(id[i]).margin(1e-12));
+        }
+    }
+
+    SECTION("Wide matrix")
+    {
+        Matrix<float, 2, 3> const m(3.f, 2.f,  2.f,
+                                    2.f, 3.f, -2.f);
+        auto const svd = sv_decompose(m);
+        static_assert(std::same_as<decltype(svd.u), Matrix<float, 2, 2>>);
+        static_assert(std::same_as<decltype(svd.v), Matrix<float, 3, 2>>);
+        CHECK(svd.singular_values[0] == Approx(5.f));
+        CHECK(svd.singular_values[1] == Approx(3.f));
+        auto const reconstruction = svd.getReconstruction();
+        for (std::size_t i = 0; i < m.m.size(); ++i) {
+            CHECK(reconstruction[i] == Approx(m[i]).margin(1e-5f));
+        }
+    }
+
+    SECTION("Rank deficient matrices have orthonormal singular vectors")
+    {
+        auto const check_orthonormal = [](auto const& q) {
+            constexpr std::size_t n = std::remove_cvref_t<decltype(q)>::Columns::value;
+            auto const qtq = transpose(q) * q;
+            bool is_identity = true;
+            for (std::size_t r = 0; r < n; ++r) {
+                for (std::size_t c = 0; c < n; ++c) {
+                    is_identity = is_identity && (qtq(r, c) == Approx((r == c) ? 1.0 : 0.0).margin(1e-12));
+                }
+            }
+            return is_identity;
+        };
+
+        Matrix<double, 3, 2> const tall(1.0, 0.0,
+                                        2.0, 0.0,
+                                        3.0, 0.0);
+        auto const svd_tall = sv_decompose(tall);
+        CHECK(svd_tall.singular_values[1] == 0.0);
+        CHECK(check_orthonormal(svd_tall.u));
+        CHECK(check_orthonormal(svd_tall.v));
+        CHECK(svd_tall.getReconstruction() == tall);
+
+        Matrix<double, 2, 3> const wide(0.0, 0.0, 0.0,
+                                        1.0, 2.0, 2.0);
+        auto const svd_wide = sv_decompose(wide);
+        CHECK(svd_wide.singular_values == Vector<double, 2>(3.0, 0.0));
+        CHECK(check_orthonormal(svd_wide.u));
+        CHECK(check_orthonormal(svd_wide.v));
+
+        Matrix<double, 3, 3> const zero;
+        auto const svd_zero = sv_decompose(zero);
+        CHECK(svd_zero.singular_values == Vector<double, 3>(0.0, 0.0, 0.0));
+        CHECK(check_orthonormal(svd_zero.u));
+        CHECK(check_orthonormal(svd_zero.v));
+        CHECK(svd_zero.getReconstruction() == zero);
+    }
+
+    SECTION("Pseudo-inverse")
+    {
+        // full column rank: pinv(A) * A == I
+        Matrix<double, 3, 2> const m(1.0, 2.0,
+                                     3.0, 4.0,
+                                     5.0, 7.0);
+        Matrix<double, 2, 3> const pinv = sv_decompose(m).getPseudoInverse();
+        auto const id = pinv * m;
+        CHECK(id(0, 0) == Approx(1.0));
+        CHECK(id(0, 1) == Approx(0.0).margin(1e-12));
+        CHECK(id(1, 0) == Approx(0.0).margin(1e-12));
+        CHECK(id(1, 1) == Approx(1.0));
+
+        // square, invertible: pseudo-inverse is the inverse
+        Matrix<double, 3, 3> const sq(1.0, 2.0, 1.0,
+                                      3.0, 2.0, 4.0,
+                                      4.0, 4.0, 3.0);
+        auto const inv = sv_decompose(sq).getPseudoInverse();
+        auto const lu_inv = lu_decompose(sq).getInverse();
+        for (std::size_t i = 0; i < inv.m.size(); ++i) {
+            CHECK(inv[i] == Approx(lu_inv[i]));
+        }
+
+        // rank deficient
+        Matrix<double, 2, 2> const singular(1.0, 2.0,
+                                            2.0, 4.0);
+        auto const svd = sv_decompose(singular);
+        CHECK(svd.singular_values[0] == Approx(5.0));
+        CHECK(svd.singular_values[1] == Approx(0.0).margin(1e-12));
+        auto const spinv = svd.getPseudoInverse();
+        CHECK(spinv(0, 0) == Approx(0.04));
+        CHECK(spinv(0, 1) == Approx(0.08));
+        CHECK(spinv(1, 0) == Approx(0.08));
+        CHECK(spinv(1, 1) == Approx(0.16));
+    }
+}
+
+TEST_CASE("Column-Major Matrix")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order;
+    using ColMatrix23 = Matrix<int, 2, 3, Order::ColumnMajor>;
+
+    SECTION("Static Properties")
+    {
+        static_assert(Matrix<float, 3, 2>::StorageOrder::value == Order::RowMajor);
+        static_assert(Matrix<float, 3, 2, Order::ColumnMajor>::StorageOrder::value == Order::ColumnMajor);
+        static_assert(Matrix<float, 3, 2>::storage_index(1, 0) == 2);
+        static_assert(Matrix<float, 3, 2, Order::ColumnMajor>::storage_index(1, 0) == 1);
+        static_assert(sizeof(Matrix<float, 3, 2, Order::ColumnMajor>) == sizeof(float) * 6);
+    }
+
+    SECTION("Construction from values is in row-major order")
+    {
+        ColMatrix23 const m(1, 2, 3,
+                            4, 5, 6);
+        CHECK(m(0, 0) == 1);  CHECK(m(0, 1) == 2);  CHECK(m(0, 2) == 3);
+        CHECK(m(1, 0) == 4);  CHECK(m(1, 1) == 5);  CHECK(m(1, 2) == 6);
+        CHECK(m.m == std::array<int, 6>{ 1, 4, 2, 5, 3, 6 });
+    }
+
+    SECTION("Construction from array")
+    {
+        using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_ColumnMajor;
+        using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_RowMajor;
+        int const arr[] = { 1, 2, 3, 4, 5, 6 };
+        ColMatrix23 const mc(arr, InputOrder_ColumnMajor{});
+        CHECK(mc.m == std::array<int, 6>{ 1, 2, 3, 4, 5, 6 });
+        CHECK(mc(1, 0) == 2);
+        CHECK(mc(0, 1) == 3);
+        ColMatrix23 const mr(arr, InputOrder_RowMajor{});
+        CHECK(mr == ColMatrix23(1, 2, 3, 4, 5, 6));
+    }
+
+    SECTION("Conversion between storage orders")
+    {
+        Matrix<int, 2, 3> const row_major(1, 2, 3,
+                                          4, 5, 6);
+        ColMatrix23 const col_major(row_major);
+        CHECK(col_major == ColMatrix23(1, 2, 3, 4, 5, 6));
+        CHECK(Matrix<int, 2, 3>(col_major) == row_major);
+        Matrix<float, 2, 3, Order::ColumnMajor> const mf(col_major);
+        CHECK(mf(1, 2) == 6.f);
+        Matrix<float, 3, 3, Order::ColumnMajor> const m3(GHULBUS_MATH_NAMESPACE::Matrix3<float>(1.f, 2.f, 3.f,
+                                                                                                4.f, 5.f, 6.f,
+                                                                                                7.f, 8.f, 9.f));
+        CHECK(m3(0, 1) == 2.f);
+        CHECK(m3.m[1] == 4.f);
+    }
+
+    SECTION("Row and column access")
+    {
+        ColMatrix23 m(1, 2, 3,
+                      4, 5, 6);
+        CHECK(m.row(1) == Vector<int, 3>(4, 5, 6));
+        CHECK(m.column(2) == Vector<int, 2>(3, 6));
+        m.set_row(0, Vector<int, 3>(7, 8, 9));
+        m.set_column(1, Vector<int, 2>(-1, -2));
+        CHECK(m == ColMatrix23(7, -1, 9,
+                               4, -2, 6));
+        m.swap_rows(0, 1);
+        CHECK(m == ColMatrix23(4, -2, 6,
+                               7, -1, 9));
+        m.swap_columns(0, 2);
+        CHECK(m == ColMatrix23(6, -2, 4,
+                               9, -1, 7));
+    }
+
+    SECTION("Matrix-matrix multiplication matches row-major result")
+    {
+        ColMatrix23 const m1(1, 2, 3,
+                             4, 5, 6);
+        Matrix<int, 3, 2, Order::ColumnMajor> const m2(7, 8,
+                                                       9, 10,
+                                                       11, 12);
+        auto const product = m1 * m2;
+        static_assert(std::same_as<decltype(product), Matrix<int, 2, 2, Order::ColumnMajor> const>);
+        CHECK(Matrix<int, 2, 2>(product) == Matrix<int, 2, 3>(m1) * Matrix<int, 3, 2>(m2));
+        CHECK(product == Matrix<int, 2, 2, Order::ColumnMajor>(58, 64,
+                                                               139, 154));
+    }
+
+    SECTION("Matrix-vector multiplication")
+    {
+        ColMatrix23 const m(1, 2, 3,
+                            4, 5, 6);
+        CHECK(m * Vector<int, 3>(1, -1, 2) == Vector<int, 2>(5, 11));
+    }
+
+    SECTION("Transpose, identity and trace")
+    {
+        ColMatrix23 const m(1, 2, 3,
+                            4, 5, 6);
+        auto const mt = transpose(m);
+        static_assert(std::same_as<decltype(mt), Matrix<int, 3, 2, Order::ColumnMajor> const>);
+        CHECK(mt == Matrix<int, 3, 2, Order::ColumnMajor>(1, 4,
+                                                          2, 5,
+                                                          3, 6));
+        auto const id = GHULBUS_MATH_NAMESPACE::identityN<int, 3, Order::ColumnMajor>();
+        CHECK(id * mt == mt);
+        CHECK(trace(m * mt) == 1 + 4 + 9 + 16 + 25 + 36);
+    }
+
+    SECTION("LU decomposition")
+    {
+        using Catch::Approx;
+        Matrix<double, 3, 3, Order::ColumnMajor> const m(2.0, 1.0, 1.0,
+                                                         4.0, -6.0, 0.0,
+                                                         -2.0, 7.0, 2.0);
+        auto const lu = lu_decompose(m);
+        REQUIRE(lu);
+        CHECK(lu.getDeterminant() == Approx(lu_decompose(Matrix<double, 3, 3>(m)).getDeterminant()));
+        auto const x = lu.solveFor(Vector<double, 3>(5.0, -2.0, 9.0));
+        auto const r = m * x;
+        CHECK(r[0] == Approx(5.0));
+        CHECK(r[1] == Approx(-2.0));
+        CHECK(r[2] == Approx(9.0));
+    }
+}
+
 TEST_CASE("Fixed-Size Matrix Interaction")
 {
     using GHULBUS_MATH_NAMESPACE::Matrix;
@@ -0,0 +1,164 @@
+#include <gbMath/Matrix3Decomposition.hpp>
+#include <gbMath/MatrixIO3.hpp>
+#include <gbMath/Transform3.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+namespace {
+template<typename T>
+void checkRotation(GHULBUS_MATH_NAMESPACE::Matrix3<T> const& r, T epsilon)
+{
+    using Catch::Approx;
+    auto const id = GHULBUS_MATH_NAMESPACE::identity3<T>();
+    auto const rtr = transpose(r) * r;
+    for (std::size_t i = 0; i < 9; ++i) {
+        CHECK(rtr[i] == Approx(id[i]).margin(epsilon));
+    }
+    CHECK(determinant(r) == Approx(1).epsilon(epsilon));
+}
+
+template<typename T>
+void checkMatrixEqual(GHULBUS_MATH_NAMESPACE::Matrix3<T> const& m1, GHULBUS_MATH_NAMESPACE::Matrix3<T> const& m2,
+                      T epsilon)
+{
+    using Catch::Approx;
+    for (std::size_t i = 0; i < 9; ++i) {
+        CHECK(m1[i] == Approx(m2[i]).margin(epsilon));
+    }
+}
+
+template<typename T>
+GHULBUS_MATH_NAMESPACE::Matrix3<T> reconstruct(GHULBUS_MATH_NAMESPACE::SingularValueDecomposition3<T> const& svd)
+{
+    GHULBUS_MATH_NAMESPACE::Matrix3<T> const sigma(svd.sigma.x, 0, 0,
+                                                   0, svd.sigma.y, 0,
+                                                   0, 0, svd.sigma.z);
+    return svd.u * sigma * transpose(svd.v);
+}
+
+template<typename T>
+GHULBUS_MATH_NAMESPACE::Matrix3<T> upperLeft(GHULBUS_MATH_NAMESPACE::Transform3<T> const& t)
+{
+    return GHULBUS_MATH_NAMESPACE::Matrix3<T>(t.m.m11, t.m.m12, t.m.m13,
+                                              t.m.m21, t.m.m22, t.m.m23,
+                                              t.m.m31, t.m.m32, t.m.m33);
+}
+}
+
+TEST_CASE("Matrix3 Decomposition")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::identity3;
+    using Catch::Approx;
+
+    SECTION("SVD of identity")
+    {
+        auto const svd = sv_decompose(identity3<float>());
+        CHECK(svd.sigma.x == Approx(1.f));
+        CHECK(svd.sigma.y == Approx(1.f));
+        CHECK(svd.sigma.z == Approx(1.f));
+        checkRotation(svd.u, 1e-6f);
+        checkRotation(svd.v, 1e-6f);
+        checkMatrixEqual(reconstruct(svd), identity3<float>(), 1e-6f);
+    }
+
+    SECTION("SVD of general matrix")
+    {
+        Matrix3<float> const m(1.f, 2.f, 3.f,
+                               -4.f, 5.f, 6.f,
+                               7.f, -8.f, 10.f);
+        auto const svd = sv_decompose(m);
+        CHECK(svd.sigma.x >= svd.sigma.y);
+        CHECK(svd.sigma.y >= std::abs(svd.sigma.z));
+        CHECK(svd.sigma.x * svd.sigma.y * svd.sigma.z == Approx(determinant(m)).epsilon(1e-4f));
+        checkRotation(svd.u, 1e-5f);
+        checkRotation(svd.v, 1e-5f);
+        checkMatrixEqual(reconstruct(svd), m, 1e-4f);
+    }
+
+    SECTION("SVD of double precision matrix with explicit sweep count")
+    {
+        Matrix3<double> const m(0.5, -2.0, 1.0,
+                                3.0, 0.25, -1.0,
+                                -1.0, 1.0, 4.0);
+        auto const svd = sv_decompose(m, 10);
+        checkRotation(svd.u, 1e-12);
+        checkRotation(svd.v, 1e-12);
+        checkMatrixEqual(reconstruct(svd), m, 1e-12);
+    }
+
+    SECTION("SVD of reflection has negative smallest singular value")
+    {
+        Matrix3<float> const m(2.f, 0.f, 0.f,
+                               0.f, -1.f, 0.f,
+                               0.f, 0.f, 3.f);
+        auto const svd = sv_decompose(m);
+        CHECK(svd.sigma.x == Approx(3.f));
+        CHECK(svd.sigma.y == Approx(2.f));
+        CHECK(svd.sigma.z == Approx(-1.f));
+        checkRotation(svd.u, 1e-6f);
+        checkRotation(svd.v, 1e-6f);
+        checkMatrixEqual(reconstruct(svd), m, 1e-6f);
+    }
+
+    SECTION("SVD of rank deficient matrix")
+    {
+        Matrix3<float> const m(1.f, 2.f, 3.f,
+                               2.f, 4.f, 6.f,
+                               1.f, 1.f, 1.f);
+        auto const svd = sv_decompose(m);
+        CHECK(svd.sigma.z == Approx(0.f).margin(1e-5f));
+        checkRotation(svd.u, 1e-5f);
+        checkRotation(svd.v, 1e-5f);
+        checkMatrixEqual(reconstruct(svd), m, 1e-5f);
+    }
+
+    SECTION("Polar decomposition extracts rotation from scaled transform")
+    {
+        using GHULBUS_MATH_NAMESPACE::make_rotation;
+        using GHULBUS_MATH_NAMESPACE::make_scale;
+        auto const rotation = upperLeft(make_rotation(0.7f, Vector3<float>(1.f, 2.f, -1.f)));
+        auto const scale = upperLeft(make_scale(2.f, 0.5f, 3.f));
+        Matrix3<float> const m = rotation * scale;
+        auto const polar = polar_decompose(m);
+        checkRotation(polar.r, 1e-5f);
+        checkMatrixEqual(polar.r, rotation, 1e-5f);
+        checkMatrixEqual(polar.s, transpose(polar.s), 1e-5f);
+        checkMatrixEqual(polar.r * polar.s, m, 1e-5f);
+    }
+
+    SECTION("Polar decomposition of sheared matrix")
+    {
+        Matrix3<float> const m(1.f, 0.5f, 0.f,
+                               0.f, 1.f, 0.f,
+                               0.f, 0.f, 1.f);
+        auto const polar = polar_decompose(m);
+        checkRotation(polar.r, 1e-5f);
+        checkMatrixEqual(polar.s, transpose(polar.s), 1e-5f);
+        checkMatrixEqual(polar.r * polar.s, m, 1e-5f);
+    }
+
+    SECTION("Batched polar decomposition")
+    {
+        using GHULBUS_MATH_NAMESPACE::make_rotation_x;
+        using GHULBUS_MATH_NAMESPACE::make_rotation_z;
+        std::vector<Matrix3<float>> matrices;
+        std::vector<Matrix3<float>> expected;
+        for (int i = 0; i < 17; ++i) {
+            auto const r = upperLeft(make_rotation_z(0.1f * static_cast<float>(i)) *
+                                     make_rotation_x(-0.2f * static_cast<float>(i)));
+            expected.push_back(r);
+            matrices.push_back(r * Matrix3<float>(1.f + static_cast<float>(i), 0.f, 0.f,
+                                                  0.f, 2.f, 0.f,
+                                                  0.f, 0.f, 0.5f));
+        }
+        std::vector<Matrix3<float>> rotations(matrices.size());
+        polar_decompose(std::span<Matrix3<float> const>(matrices), std::span<Matrix3<float>>(rotations));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            checkMatrixEqual(rotations[i], expected[i], 1e-5f);
+        }
+    }
+}
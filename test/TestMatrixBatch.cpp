@@ -0,0 +1,177 @@
+#include <gbMath/MatrixBatch.hpp>
+
+#include <catch.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace {
+template<typename Matrix_T>
+std::vector<Matrix_T> makeTestMatrices(std::size_t count)
+{
+    using T = typename Matrix_T::ValueType;
+    constexpr std::size_t n_elements = sizeof(Matrix_T) / sizeof(T);
+    std::vector<Matrix_T> ret(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t e = 0; e < n_elements; ++e) {
+            // diagonally dominant, so all matrices are well-conditioned
+            T const diagonal = ((e % 5) == 0) ? static_cast<T>(10) : static_cast<T>(0);
+            ret[i][e] = diagonal + static_cast<T>(static_cast<int>((i * 7 + e * 3) % 11) - 5);
+        }
+    }
+    return ret;
+}
+}
+
+TEST_CASE("Matrix Batch")
+{
+    using GHULBUS_MATH_NAMESPACE::BatchLanes;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::Matrix4;
+    using Catch::Approx;
+
+    SECTION("BatchLanes arithmetic")
+    {
+        BatchLanes<float, 4> a;
+        BatchLanes<float, 4> b(2.f);
+        for (std::size_t i = 0; i < 4; ++i) {
+            CHECK(a[i] == 0.f);
+            CHECK(b[i] == 2.f);
+            a[i] = static_cast<float>(i);
+        }
+        auto const c = (a + b) * a - b / 2.f;
+        for (std::size_t i = 0; i < 4; ++i) {
+            float const f = static_cast<float>(i);
+            CHECK(c[i] == (f + 2.f) * f - 1.f);
+        }
+        CHECK((-c)[3] == -c[3]);
+    }
+
+    SECTION("Matrix3 determinant")
+    {
+        // 19 is not a multiple of the batch width, so this also exercises the remainder block
+        auto const matrices = makeTestMatrices<Matrix3<float>>(19);
+        std::vector<float> determinants(matrices.size());
+        determinant(std::span<Matrix3<float> const>(matrices), std::span<float>(determinants));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            CHECK(determinants[i] == determinant(matrices[i]));
+        }
+    }
+
+    SECTION("Matrix4 determinant")
+    {
+        auto const matrices = makeTestMatrices<Matrix4<double>>(11);
+        std::vector<double> determinants(matrices.size());
+        determinant(std::span<Matrix4<double> const>(matrices), std::span<double>(determinants));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            CHECK(determinants[i] == Approx(determinant(matrices[i])));
+        }
+    }
+
+    SECTION("Integer adjugate")
+    {
+        std::vector<Matrix4<int>> matrices;
+        for (auto const& m : makeTestMatrices<Matrix4<float>>(5)) { matrices.emplace_back(m); }
+        std::vector<Matrix4<int>> adjugates(matrices.size());
+        adjugate(std::span<Matrix4<int> const>(matrices), std::span<Matrix4<int>>(adjugates));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            CHECK(adjugates[i] == adjugate(matrices[i]));
+        }
+        std::vector<Matrix3<int>> matrices3;
+        for (auto const& m : makeTestMatrices<Matrix3<float>>(5)) { matrices3.emplace_back(m); }
+        std::vector<Matrix3<int>> adjugates3(matrices3.size());
+        adjugate(std::span<Matrix3<int> const>(matrices3), std::span<Matrix3<int>>(adjugates3));
+        for (std::size_t i = 0; i < matrices3.size(); ++i) {
+            CHECK(adjugates3[i] == adjugate(matrices3[i]));
+        }
+    }
+
+    SECTION("Matrix3 inverse")
+    {
+        auto const matrices = makeTestMatrices<Matrix3<float>>(13);
+        std::vector<Matrix3<float>> inverses(matrices.size());
+        inverse(std::span<Matrix3<float> const>(matrices), std::span<Matrix3<float>>(inverses));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            auto const expected = inverse(matrices[i]);
+            for (std::size_t e = 0; e < 9; ++e) {
+                CHECK(inverses[i][e] == Approx(expected[e]).margin(1e-6f));
+            }
+        }
+    }
+
+    SECTION("Matrix4 inverse in place")
+    {
+        auto matrices = makeTestMatrices<Matrix4<float>>(21);
+        auto const original = matrices;
+        inverse(std::span<Matrix4<float> const>(matrices), std::span<Matrix4<float>>(matrices));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            auto const expected = inverse(original[i]);
+            for (std::size_t e = 0; e < 16; ++e) {
+                CHECK(matrices[i][e] == Approx(expected[e]).margin(1e-6f));
+            }
+        }
+    }
+
+    SECTION("Multiply")
+    {
+        auto const lhs = makeTestMatrices<Matrix4<float>>(9);
+        auto const rhs = makeTestMatrices<Matrix4<float>>(12);
+        std::vector<Matrix4<float>> products(lhs.size());
+        multiply(std::span<Matrix4<float> const>(lhs), std::span<Matrix4<float> const>(rhs),
+                 std::span<Matrix4<float>>(products));
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            CHECK(products[i] == lhs[i] * rhs[i]);
+        }
+
+        auto const lhs3 = makeTestMatrices<Matrix3<int>>(3);
+        auto const rhs3 = makeTestMatrices<Matrix3<int>>(4);
+        std::vector<Matrix3<int>> products3(lhs3.size());
+        multiply<int, 2>(std::span<Matrix3<int> const>(lhs3), std::span<Matrix3<int> const>(rhs3),
+                         std::span<Matrix3<int>>(products3));
+        for (std::size_t i = 0; i < lhs3.size(); ++i) {
+            CHECK(products3[i] == lhs3[i] * rhs3[i]);
+        }
+    }
+
+    SECTION("Blocks distributed with parallel_for")
+    {
+        std::vector<std::size_t> block_counts;
+        auto const reverse_for = [&block_counts](std::size_t count, auto&& f) {
+            block_counts.push_back(count);
+            // run the blocks in reverse order to check that they are independent
+            for (std::size_t i = count; i > 0; --i) { f(i - 1); }
+        };
+
+        auto const matrices = makeTestMatrices<Matrix4<double>>(11);
+        std::span<Matrix4<double> const> const in(matrices);
+        std::vector<double> determinants(matrices.size());
+        determinant<double, 4>(in, std::span<double>(determinants), reverse_for);
+        std::vector<Matrix4<double>> adjugates(matrices.size());
+        adjugate<double, 4>(in, std::span<Matrix4<double>>(adjugates), reverse_for);
+        std::vector<Matrix4<double>> inverses(matrices.size());
+        inverse<double, 4>(in, std::span<Matrix4<double>>(inverses), reverse_for);
+        std::vector<Matrix4<double>> products(matrices.size());
+        multiply<double, 4>(in, in, std::span<Matrix4<double>>(products), reverse_for);
+        CHECK(block_counts == std::vector<std::size_t>{ 3, 3, 3, 3 });
+
+        std::vector<double> expected_determinants(matrices.size());
+        determinant<double, 4>(in, std::span<double>(expected_determinants));
+        std::vector<Matrix4<double>> expected_inverses(matrices.size());
+        inverse<double, 4>(in, std::span<Matrix4<double>>(expected_inverses));
+        for (std::size_t i = 0; i < matrices.size(); ++i) {
+            CHECK(determinants[i] == expected_determinants[i]);
+            CHECK(adjugates[i] == adjugate(matrices[i]));
+            CHECK(inverses[i] == expected_inverses[i]);
+            CHECK(products[i] == matrices[i] * matrices[i]);
+        }
+
+        std::vector<Matrix3<int>> const matrices3 = makeTestMatrices<Matrix3<int>>(8);
+        std::vector<int> determinants3(matrices3.size());
+        determinant<int, 4>(std::span<Matrix3<int> const>(matrices3), std::span<int>(determinants3), reverse_for);
+        CHECK(block_counts.back() == 2);
+        for (std::size_t i = 0; i < matrices3.size(); ++i) {
+            CHECK(determinants3[i] == determinant(matrices3[i]));
+        }
+    }
+}
@@ -2,7 +2,11 @@
 
 #include <catch.hpp>
 
+#include <array>
+#include <iomanip>
 #include <sstream>
+#include <string_view>
+#include <version>
 
 TEST_CASE("MatrixIO")
 {
@@ -49,4 +53,58 @@ TEST_CASE("MatrixIO")
         CHECK(sstr.str() == "[ [-42] ]");
 
     }
+
+    SECTION("Column-major Matrix MxN ostream insertion")
+    {
+        using GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order;
+        sstr << Matrix<int, 2, 3, Order::ColumnMajor>(1, 2, 3,
+                                                      4, 5, 6);
+        CHECK(sstr.str() == "[ [1 2 3] [4 5 6] ]");
+    }
+}
+
+#ifdef __cpp_lib_format
+TEST_CASE("MatrixIO format")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix2;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::Matrix4;
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+
+    SECTION("Default format")
+    {
+        CHECK(std::format("{}", Matrix2<int>(1, 2, 3, 4)) == "[ [1 2] [3 4] ]");
+        CHECK(std::format("{}", Matrix3<char>(1, 2, 3, 4, 5, 6, 7, 8, 9)) == "[ [1 2 3] [4 5 6] [7 8 9] ]");
+        CHECK(std::format("{}", Matrix4<int>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16)) ==
+              "[ [1 2 3 4] [5 6 7 8] [9 10 11 12] [13 14 15 16] ]");
+        using GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order;
+        CHECK(std::format("{}", Matrix<int, 2, 3, Order::ColumnMajor>(1, 2, 3, 4, 5, 6)) == "[ [1 2 3] [4 5 6] ]");
+    }
+
+    SECTION("Format spec is applied to each element")
+    {
+        CHECK(std::format("{:.1f}", Matrix2<double>(1, 2.25, 3, 4)) == "[ [1.0 2.2] [3.0 4.0] ]");
+        CHECK(std::format("{:02}", Matrix3<int>(1, 2, 3, 4, 5, 6, 7, 8, 9)) ==
+              "[ [01 02 03] [04 05 06] [07 08 09] ]");
+        CHECK(std::format("{:x}", Matrix<int, 1, 2>(10, 11)) == "[ [a b] ]");
+    }
+
+    SECTION("Stream width applies to the whole matrix")
+    {
+        std::stringstream sstr;
+        sstr << std::setw(20) << Matrix2<int>(1, 2, 3, 4) << 5;
+        CHECK(sstr.str() == "     [ [1 2] [3 4] ]5");
+        sstr.str("");
+        sstr << std::left << std::setfill('-') << std::setw(17) << Matrix2<int>(1, 2, 3, 4) << '|';
+        CHECK(sstr.str() == "[ [1 2] [3 4] ]--|");
+    }
+
+    SECTION("Bounded formatting")
+    {
+        std::array<char, 10> buffer;
+        auto const res = GHULBUS_MATH_NAMESPACE::format_to_buffer(buffer, "{}", Matrix2<int>(1, 2, 3, 4));
+        CHECK(res.str == "[ [1 2] [3");
+        CHECK(res.truncated);
+    }
 }
+#endif
@@ -0,0 +1,130 @@
+#include <gbMath/MatrixView.hpp>
+
+#include <catch.hpp>
+
+TEST_CASE("MatrixView")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::MatrixView;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_ColumnMajor;
+    using GHULBUS_MATH_NAMESPACE::MatrixPolicies::InputOrder_RowMajor;
+
+    SECTION("Static Properties")
+    {
+        static_assert(std::same_as<MatrixView<float, 3, 2>::ValueType, float>);
+        static_assert(std::same_as<MatrixView<float const, 3, 2>::ValueType, float>);
+        static_assert(MatrixView<float, 3, 2>::Rows::value == 3);
+        static_assert(MatrixView<float, 3, 2>::Columns::value == 2);
+        static_assert(std::is_trivially_copyable_v<MatrixView<float, 3, 2>>);
+    }
+
+    SECTION("Row-major and column-major views of the same memory")
+    {
+        int arr[] = { 1, 2, 3, 4, 5, 6 };
+        MatrixView<int, 2, 3> const mr(arr, InputOrder_RowMajor{});
+        CHECK(mr.dimension() == std::pair<std::size_t, std::size_t>(2, 3));
+        CHECK(!mr.is_square());
+        CHECK(mr.to_matrix() == Matrix<int, 2, 3>(1, 2, 3,
+                                                  4, 5, 6));
+        MatrixView<int, 2, 3> const mc(arr, InputOrder_ColumnMajor{});
+        CHECK(mc.to_matrix() == Matrix<int, 2, 3>(1, 3, 5,
+                                                  2, 4, 6));
+        mc(1, 2) = 42;
+        CHECK(arr[5] == 42);
+    }
+
+    SECTION("Sub-matrix view with explicit strides")
+    {
+        Matrix<int, 4, 4> m(1, 2, 3, 4,
+                            5, 6, 7, 8,
+                            9, 10, 11, 12,
+                            13, 14, 15, 16);
+        MatrixView<int, 2, 2> const sub(&m(1, 1), 4, 1);
+        CHECK(sub.to_matrix() == Matrix<int, 2, 2>(6, 7,
+                                                   10, 11));
+        sub *= 10;
+        CHECK(m(2, 2) == 110);
+        CHECK(m(2, 3) == 12);
+        CHECK(trace(sub) == 170);
+    }
+
+    SECTION("View of owning matrix respects storage order")
+    {
+        using GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order;
+        Matrix<int, 2, 3, Order::ColumnMajor> mc(1, 2, 3,
+                                                 4, 5, 6);
+        MatrixView vc(mc);
+        static_assert(std::same_as<decltype(vc), MatrixView<int, 2, 3>>);
+        CHECK(vc(0, 2) == 3);
+        CHECK(vc(1, 0) == 4);
+        Matrix<int, 2, 3> const mr(1, 2, 3,
+                                   4, 5, 6);
+        MatrixView vr(mr);
+        static_assert(std::same_as<decltype(vr), MatrixView<int const, 2, 3>>);
+        CHECK(vr == MatrixView<int const, 2, 3>(vc));
+    }
+
+    SECTION("Row and column views")
+    {
+        Matrix<int, 2, 3> m(1, 2, 3,
+                            4, 5, 6);
+        MatrixView<int, 2, 3> const mv(m);
+        CHECK(mv.row(1).to_vector() == Vector<int, 3>(4, 5, 6));
+        CHECK(mv.column(2).to_vector() == Vector<int, 2>(3, 6));
+        mv.column(0).assign(Vector<int, 2>(-1, -4));
+        CHECK(m == Matrix<int, 2, 3>(-1, 2, 3,
+                                     -4, 5, 6));
+    }
+
+    SECTION("Transpose does not copy")
+    {
+        Matrix<int, 2, 3> m(1, 2, 3,
+                            4, 5, 6);
+        auto const mt = transpose(MatrixView<int, 2, 3>(m));
+        static_assert(std::same_as<decltype(mt), MatrixView<int, 3, 2> const>);
+        CHECK(mt.to_matrix() == transpose(m));
+        mt(2, 1) = 0;
+        CHECK(m(1, 2) == 0);
+    }
+
+    SECTION("Arithmetic")
+    {
+        int arr1[] = { 1, 2, 3, 4 };
+        int arr2[] = { 10, 30, 20, 40 };
+        MatrixView<int const, 2, 2> const a(arr1, InputOrder_RowMajor{});
+        MatrixView<int const, 2, 2> const b(arr2, InputOrder_ColumnMajor{});
+        CHECK(a + b == Matrix<int, 2, 2>(11, 22, 33, 44));
+        CHECK(b - a == Matrix<int, 2, 2>(9, 18, 27, 36));
+        CHECK(a * 2 == Matrix<int, 2, 2>(2, 4, 6, 8));
+        CHECK(2 * a == Matrix<int, 2, 2>(2, 4, 6, 8));
+        CHECK(b / 10 == Matrix<int, 2, 2>(1, 2, 3, 4));
+        CHECK(a * b == a.to_matrix() * b.to_matrix());
+        CHECK(a * Vector<int, 2>(1, -1) == Vector<int, 2>(-1, -1));
+
+        int out[] = { 0, 0, 0, 0 };
+        MatrixView<int, 2, 2> const o(out, InputOrder_RowMajor{});
+        o.assign(a);
+        o += b;
+        o -= a;
+        CHECK(o == b);
+        o /= 10;
+        CHECK(o == a);
+    }
+
+    SECTION("LU decomposition")
+    {
+        using Catch::Approx;
+        double arr[] = { 2.0, 4.0, -2.0,
+                         1.0, -6.0, 7.0,
+                         1.0, 0.0, 2.0 };
+        MatrixView<double const, 3, 3> const mv(arr, InputOrder_ColumnMajor{});
+        auto const lu = lu_decompose(mv);
+        REQUIRE(lu);
+        auto const x = lu.solveFor(Vector<double, 3>(5.0, -2.0, 9.0));
+        auto const r = mv * x;
+        CHECK(r[0] == Approx(5.0));
+        CHECK(r[1] == Approx(-2.0));
+        CHECK(r[2] == Approx(9.0));
+    }
+}
@@ -77,4 +77,23 @@ TEST_CASE("OBB3")
                         Vector3<float>(4.f, 5.f, 6.f));
         CHECK(intersects(ob1, ob2));
     }
+
+    SECTION("OBB-Point closest point and distance")
+    {
+        // box rotated by 90 degrees around z, so its local x axis points along global y
+        OBB3<float> const o(Point3<float>(1.f, 2.f, 3.f),
+                            Matrix3<float>( 0.f, 1.f, 0.f,
+                                           -1.f, 0.f, 0.f,
+                                            0.f, 0.f, 1.f),
+                            Vector3<float>(4.f, 1.f, 2.f));
+        CHECK(closest_point(o, Point3<float>(1.5f, 3.f, 2.f)) == Point3<float>(1.5f, 3.f, 2.f));
+        CHECK(closest_point(o, Point3<float>(1.f, 10.f, 3.f)) == Point3<float>(1.f, 6.f, 3.f));
+        CHECK(closest_point(o, Point3<float>(5.f, 2.f, 0.f)) == Point3<float>(2.f, 2.f, 1.f));
+        CHECK(distance_squared(o, Point3<float>(1.5f, 3.f, 2.f)) == 0.f);
+        CHECK(distance_squared(o, Point3<float>(1.f, 10.f, 3.f)) == 16.f);
+        CHECK(distance_squared(o, Point3<float>(5.f, 2.f, 0.f)) == 10.f);
+        CHECK(signed_distance(o, Point3<float>(1.f, 10.f, 3.f)) == 4.f);
+        CHECK(signed_distance(o, Point3<float>(1.f, 2.f, 3.f)) == -1.f);
+        CHECK(signed_distance(o, Point3<float>(1.f, 2.f, 4.5f)) == -0.5f);
+    }
 }
@@ -0,0 +1,138 @@
+#include <gbMath/PackedColor.hpp>
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+TEST_CASE("PackedColor")
+{
+    using GHULBUS_MATH_NAMESPACE::Color4;
+    using GHULBUS_MATH_NAMESPACE::ColorRGB10A2;
+    using GHULBUS_MATH_NAMESPACE::ColorRGBA16F;
+    using GHULBUS_MATH_NAMESPACE::ColorRGBA8;
+    using GHULBUS_MATH_NAMESPACE::pack_rgb10a2;
+    using GHULBUS_MATH_NAMESPACE::pack_rgba16f;
+    using GHULBUS_MATH_NAMESPACE::pack_rgba8;
+    using GHULBUS_MATH_NAMESPACE::premultiplied;
+    using GHULBUS_MATH_NAMESPACE::unpack;
+    using GHULBUS_MATH_NAMESPACE::unpremultiplied;
+    float const inf = std::numeric_limits<float>::infinity();
+    float const nan = std::numeric_limits<float>::quiet_NaN();
+
+    SECTION("RGBA8")
+    {
+        static_assert(sizeof(ColorRGBA8) == 4);
+        CHECK(pack_rgba8(Color4<float>(0.f, 1.f, 0.5f, 0.25f)) == ColorRGBA8{ 0, 255, 128, 64 });
+        CHECK(pack_rgba8(Color4<double>(0.0, 1.0, 0.5, 0.25)) == ColorRGBA8{ 0, 255, 128, 64 });
+        // rounding to nearest
+        CHECK(pack_rgba8(Color4<float>(1.4f / 255.f, 1.6f / 255.f, 254.4f / 255.f, 254.6f / 255.f)) ==
+              ColorRGBA8{ 1, 2, 254, 255 });
+        // saturation
+        CHECK(pack_rgba8(Color4<float>(-0.5f, 1.5f, -inf, inf)) == ColorRGBA8{ 0, 255, 0, 255 });
+        CHECK(pack_rgba8(Color4<float>(nan, nan, nan, nan)) == ColorRGBA8{ 0, 0, 0, 0 });
+
+        CHECK(unpack(ColorRGBA8{ 0, 255, 51, 102 }) == Color4<float>(0.f, 1.f, 0.2f, 0.4f));
+        // all values survive a round trip
+        for (int i = 0; i < 256; ++i) {
+            auto const v = static_cast<std::uint8_t>(i);
+            ColorRGBA8 const c{ v, v, v, v };
+            CHECK(pack_rgba8(unpack(c)) == c);
+            CHECK(pack_rgba8(unpack<double>(c)) == c);
+        }
+    }
+
+    SECTION("RGB10A2")
+    {
+        static_assert(sizeof(ColorRGB10A2) == 4);
+        ColorRGB10A2 const p = pack_rgb10a2(Color4<float>(1.f, 0.f, 0.5f, 1.f));
+        CHECK(p.red() == 1023);
+        CHECK(p.green() == 0);
+        CHECK(p.blue() == 512);
+        CHECK(p.alpha() == 3);
+        CHECK(p.bits == (1023u | (512u << 20) | (3u << 30)));
+        CHECK(pack_rgb10a2(Color4<float>(2.f, -1.f, nan, 0.4f)) == ColorRGB10A2{ 1023u | (1u << 30) });
+
+        Color4<float> const c = unpack(ColorRGB10A2{ 1023u | (341u << 10) | (2u << 30) });
+        CHECK(c.r == 1.f);
+        CHECK(c.g == Approx(1.f / 3.f));
+        CHECK(c.b == 0.f);
+        CHECK(c.a == Approx(2.f / 3.f));
+        for (std::uint32_t i = 0; i < 1024; ++i) {
+            ColorRGB10A2 const rt{ i | ((1023 - i) << 10) | (i << 20) | ((i % 4) << 30) };
+            CHECK(pack_rgb10a2(unpack(rt)) == rt);
+        }
+    }
+
+    SECTION("RGBA16F")
+    {
+        static_assert(sizeof(ColorRGBA16F) == 8);
+        CHECK(pack_rgba16f(Color4<float>(1.f, -2.f, 0.f, 65504.f)) == ColorRGBA16F{ 0x3c00, 0xc000, 0x0000, 0x7bff });
+        CHECK(unpack(ColorRGBA16F{ 0x3c00, 0xc000, 0x0000, 0x7bff }) == Color4<float>(1.f, -2.f, 0.f, 65504.f));
+        CHECK(unpack<double>(ColorRGBA16F{ 0x3800, 0, 0, 0x3c00 }) == Color4<double>(0.5, 0.0, 0.0, 1.0));
+    }
+
+    SECTION("Premultiplied alpha")
+    {
+        CHECK(premultiplied(Color4<float>(1.f, 0.5f, 0.25f, 0.5f)) == Color4<float>(0.5f, 0.25f, 0.125f, 0.5f));
+        CHECK(unpremultiplied(Color4<float>(0.5f, 0.25f, 0.125f, 0.5f)) == Color4<float>(1.f, 0.5f, 0.25f, 0.5f));
+        CHECK(unpremultiplied(Color4<float>(0.f, 0.f, 0.f, 0.f)) == Color4<float>(0.f, 0.f, 0.f, 0.f));
+        CHECK(unpremultiplied(Color4<double>(0.2, 0.1, 0.3, 0.0)) == Color4<double>(0.0, 0.0, 0.0, 0.0));
+    }
+
+    SECTION("Bulk conversion matches single conversion")
+    {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> dist(-0.2f, 1.2f);
+        std::vector<Color4<float>> colors;
+        for (int i = 0; i < 1000; ++i) { colors.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng)); }
+        colors.emplace_back(nan, inf, -inf, 0.f);
+        std::span<Color4<float> const> const in(colors);
+
+        std::vector<ColorRGBA8> rgba8(colors.size());
+        std::vector<ColorRGB10A2> rgb10a2(colors.size());
+        std::vector<ColorRGBA16F> rgba16f(colors.size());
+        pack(in, std::span<ColorRGBA8>(rgba8));
+        pack(in, std::span<ColorRGB10A2>(rgb10a2));
+        pack(in, std::span<ColorRGBA16F>(rgba16f));
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            CHECK(rgba8[i] == pack_rgba8(colors[i]));
+            CHECK(rgb10a2[i] == pack_rgb10a2(colors[i]));
+            CHECK(rgba16f[i] == pack_rgba16f(colors[i]));
+        }
+
+        std::vector<Color4<float>> unpacked(colors.size());
+        unpack(std::span<ColorRGBA8 const>(rgba8), std::span<Color4<float>>(unpacked));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(unpacked[i] == unpack(rgba8[i])); }
+        unpack(std::span<ColorRGB10A2 const>(rgb10a2), std::span<Color4<float>>(unpacked));
+        for (std::size_t i = 0; i < colors.size(); ++i) { CHECK(unpacked[i] == unpack(rgb10a2[i])); }
+        unpack(std::span<ColorRGBA16F const>(rgba16f), std::span<Color4<float>>(unpacked));
+        for (std::size_t i = 0; i < colors.size() - 1; ++i) { CHECK(unpacked[i] == unpack(rgba16f[i])); }
+
+        pack_premultiplied(in, std::span<ColorRGBA8>(rgba8));
+        pack_premultiplied(in, std::span<ColorRGBA16F>(rgba16f));
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            CHECK(rgba8[i] == pack_rgba8(premultiplied(colors[i])));
+            CHECK(rgba16f[i] == pack_rgba16f(premultiplied(colors[i])));
+        }
+        unpack_unpremultiplied(std::span<ColorRGBA8 const>(rgba8), std::span<Color4<float>>(unpacked));
+        for (std::size_t i = 0; i < colors.size(); ++i) {
+            CHECK(unpacked[i] == unpremultiplied(unpack(rgba8[i])));
+        }
+        unpack_unpremultiplied(std::span<ColorRGBA16F const>(rgba16f), std::span<Color4<float>>(unpacked));
+        for (std::size_t i = 0; i < 10; ++i) {
+            CHECK(unpacked[i] == unpremultiplied(unpack(rgba16f[i])));
+        }
+
+        std::vector<Color4<float>> premultiplied_colors = colors;
+        premultiply(std::span<Color4<float>>(premultiplied_colors));
+        for (std::size_t i = 0; i < 10; ++i) { CHECK(premultiplied_colors[i] == premultiplied(colors[i])); }
+        unpremultiply(std::span<Color4<float>>(premultiplied_colors));
+        for (std::size_t i = 0; i < 10; ++i) {
+            CHECK(premultiplied_colors[i] == unpremultiplied(premultiplied(colors[i])));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include <gbMath/Plane3.hpp>
+#include <gbMath/VectorIO3.hpp>
+
+#include <catch.hpp>
+
+TEST_CASE("Plane3")
+{
+    using GHULBUS_MATH_NAMESPACE::Plane3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::doNotInitialize;
+
+    SECTION("Default constructor initializes to 0")
+    {
+        Plane3<int> plane;
+        CHECK(plane.n == Vector3<int>(0, 0, 0));
+        CHECK(plane.d == 0);
+    }
+
+    SECTION("Construction to uninitialized")
+    {
+        Plane3<int> plane{doNotInitialize};
+        plane.n = Vector3<int>(0, 0, 1);
+        plane.d = 5;
+        CHECK(plane == Plane3<int>(Vector3<int>(0, 0, 1), 5));
+    }
+
+    SECTION("Construction from normal and point")
+    {
+        Plane3<int> const plane(Vector3<int>(0, 2, 0), Point3<int>(7, 3, -1));
+        CHECK(plane.n == Vector3<int>(0, 2, 0));
+        CHECK(plane.d == 6);
+    }
+
+    SECTION("Construction from three points")
+    {
+        Plane3<int> const plane(Point3<int>(0, 0, 4), Point3<int>(1, 0, 4), Point3<int>(0, 1, 4));
+        CHECK(plane.n == Vector3<int>(0, 0, 1));
+        CHECK(plane.d == 4);
+    }
+
+    SECTION("Normalized")
+    {
+        Plane3<double> const plane = normalized(Plane3<double>(Vector3<double>(0, 0, 2), 6.0));
+        CHECK(plane.n == Vector3<double>(0, 0, 1));
+        CHECK(plane.d == 3.0);
+    }
+
+    SECTION("Signed distance")
+    {
+        Plane3<double> const plane(Vector3<double>(0, 3, 0), Point3<double>(0, 1, 0));
+        CHECK(signed_distance(plane, Point3<double>(5, 4, 2)) == Approx(3.0));
+        CHECK(signed_distance(plane, Point3<double>(5, -1, 2)) == Approx(-2.0));
+        CHECK(signed_distance(plane, Point3<double>(5, 1, 2)) == 0.0);
+        Plane3<double> const unit_plane(Vector3<double>(0, 1, 0), 1.0);
+        CHECK(signed_distance_unit(unit_plane, Point3<double>(5, 4, 2)) == 3.0);
+        CHECK(signed_distance_unit(unit_plane, Point3<double>(5, -1, 2)) == -2.0);
+    }
+
+    SECTION("Closest point")
+    {
+        Plane3<double> const plane(Vector3<double>(0, 0, 2), Point3<double>(0, 0, 1));
+        CHECK(closest_point(plane, Point3<double>(3, 4, 5)) == Point3<double>(3, 4, 1));
+        CHECK(closest_point(plane, Point3<double>(3, 4, -5)) == Point3<double>(3, 4, 1));
+    }
+}
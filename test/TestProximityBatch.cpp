@@ -0,0 +1,100 @@
+#include <gbMath/ProximityBatch.hpp>
+
+#include <catch.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+TEST_CASE("Proximity Batch")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::AABB3SoA;
+    using GHULBUS_MATH_NAMESPACE::Line3;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::OBB3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Point3SoA;
+    using GHULBUS_MATH_NAMESPACE::Segment3SoA;
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3SoA;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> zs;
+    std::vector<float> ws;
+    for (int i = 0; i < 41; ++i) {
+        float const f = static_cast<float>(i);
+        xs.push_back(0.5f * f - 10.f);
+        ys.push_back(7.f - 0.25f * f);
+        zs.push_back((i % 5 == 0) ? 1.f : (0.1f * f));
+        ws.push_back(0.3f + 0.05f * f);
+    }
+    std::size_t const n = xs.size();
+    std::vector<float> out(n);
+    AABB3<float> const box(Point3<float>(-2.f, -1.f, 0.f), Point3<float>(3.f, 2.f, 2.f));
+
+    SECTION("Point queries")
+    {
+        Point3SoA<float> const points{ xs, ys, zs };
+        REQUIRE(points.size() == n);
+        distance_squared(box, points, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == distance_squared(box, points[i]));
+        }
+        signed_distance(box, points, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == signed_distance(box, points[i]));
+        }
+        OBB3<float> const obb(Point3<float>(1.f, 2.f, 3.f),
+                              Matrix3<float>(0.f, 1.f, 0.f, -1.f, 0.f, 0.f, 0.f, 0.f, 1.f),
+                              Vector3<float>(4.f, 1.f, 2.f));
+        signed_distance(obb, points, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == signed_distance(obb, points[i]));
+        }
+    }
+
+    SECTION("Sphere queries")
+    {
+        Sphere3SoA<float> const spheres{ xs, ys, zs, ws };
+        signed_distance(box, spheres, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == signed_distance(box, spheres[i]));
+        }
+    }
+
+    SECTION("Box queries")
+    {
+        std::vector<float> max_x(n);
+        std::vector<float> max_y(n);
+        std::vector<float> max_z(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            max_x[i] = xs[i] + ws[i];
+            max_y[i] = ys[i] + 2.f * ws[i];
+            max_z[i] = zs[i] + 0.5f;
+        }
+        AABB3SoA<float> const boxes{ xs, ys, zs, max_x, max_y, max_z };
+        distance_squared(box, boxes, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == distance_squared(box, boxes[i]));
+        }
+    }
+
+    SECTION("Segment queries")
+    {
+        std::vector<float> zero(n, 0.f);
+        Segment3SoA<float> const segments{ xs, ys, zs, ws, zs, ys };
+        Segment3SoA<float> const degenerate{ xs, ys, zs, zero, zero, zero };
+        Line3<float> const s(Point3<float>(-1.f, 0.f, 1.f), Vector3<float>(2.f, 1.f, 0.f));
+        distance_squared_segment(s, segments, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == distance_squared_segment(s, segments[i]));
+        }
+        distance_squared_segment(s, degenerate, std::span<float>(out));
+        for (std::size_t i = 0; i < n; ++i) {
+            CHECK(out[i] == distance_squared_segment(s, degenerate[i]));
+        }
+    }
+}
@@ -0,0 +1,168 @@
+#include <gbMath/QuantizedVector3.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace {
+/** Spherical Fibonacci point set, evenly covering the unit sphere.
+ */
+std::vector<GHULBUS_MATH_NAMESPACE::Normal3<double>> sphere_points(int n)
+{
+    std::vector<GHULBUS_MATH_NAMESPACE::Normal3<double>> ret;
+    double const golden_angle = 3.14159265358979323846 * (3.0 - std::sqrt(5.0));
+    for (int i = 0; i < n; ++i) {
+        double const z = 1.0 - (2.0 * i + 1.0) / n;
+        double const r = std::sqrt(1.0 - z * z);
+        ret.emplace_back(r * std::cos(golden_angle * i), r * std::sin(golden_angle * i), z);
+    }
+    return ret;
+}
+
+template<typename Int_T>
+double max_angular_error_degrees(std::vector<GHULBUS_MATH_NAMESPACE::Normal3<double>> const& normals)
+{
+    double ret = 0.0;
+    for (auto const& n : normals) {
+        auto const decoded = GHULBUS_MATH_NAMESPACE::decode_octahedral<double>(
+            GHULBUS_MATH_NAMESPACE::encode_octahedral<Int_T>(n));
+        double const d = std::clamp(n.x * decoded.x + n.y * decoded.y + n.z * decoded.z, -1.0, 1.0);
+        ret = std::max(ret, std::acos(d) * 180.0 / 3.14159265358979323846);
+    }
+    return ret;
+}
+}
+
+TEST_CASE("QuantizedVector3")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::decode_octahedral;
+    using GHULBUS_MATH_NAMESPACE::dequantize;
+    using GHULBUS_MATH_NAMESPACE::encode_octahedral;
+    using GHULBUS_MATH_NAMESPACE::Normal3;
+    using GHULBUS_MATH_NAMESPACE::OctahedralNormal16;
+    using GHULBUS_MATH_NAMESPACE::OctahedralNormal8;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::QuantizedPoint3;
+    using GHULBUS_MATH_NAMESPACE::quantize;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    SECTION("Octahedral encoding of axes")
+    {
+        CHECK(encode_octahedral<std::int16_t>(Normal3<float>(0.f, 0.f, 1.f)) == OctahedralNormal16{ 0, 0 });
+        CHECK(encode_octahedral<std::int16_t>(Normal3<float>(1.f, 0.f, 0.f)) == OctahedralNormal16{ 32767, 0 });
+        CHECK(encode_octahedral<std::int16_t>(Normal3<float>(0.f, -1.f, 0.f)) == OctahedralNormal16{ 0, -32767 });
+        CHECK(encode_octahedral<std::int16_t>(Normal3<float>(0.f, 0.f, -1.f)) == OctahedralNormal16{ 32767, 32767 });
+        CHECK(encode_octahedral<std::int8_t>(Normal3<float>(-1.f, 0.f, 0.f)) == OctahedralNormal8{ -127, 0 });
+        // input does not need to be normalized
+        CHECK(encode_octahedral<std::int8_t>(Vector3<double>(0.0, 5.0, 0.0)) == OctahedralNormal8{ 0, 127 });
+        // zero vector maps to +z
+        CHECK(encode_octahedral<std::int8_t>(Vector3<double>(0.0, 0.0, 0.0)) == OctahedralNormal8{ 0, 0 });
+
+        CHECK(decode_octahedral(OctahedralNormal16{ 0, 0 }) == Normal3<float>(0.f, 0.f, 1.f));
+        CHECK(decode_octahedral(OctahedralNormal16{ 32767, 0 }) == Normal3<float>(1.f, 0.f, 0.f));
+        CHECK(decode_octahedral<double>(OctahedralNormal8{ 127, 127 }) == Normal3<double>(0.0, 0.0, -1.0));
+        // the unused minimum value is treated as -1
+        CHECK(decode_octahedral(OctahedralNormal8{ -128, 0 }) == Normal3<float>(-1.f, 0.f, 0.f));
+    }
+
+    SECTION("Octahedral decoding yields unit vectors")
+    {
+        bool all_unit = true;
+        for (int x = -128; x < 128; ++x) {
+            for (int y = -128; y < 128; ++y) {
+                auto const n = decode_octahedral(OctahedralNormal8{ static_cast<std::int8_t>(x),
+                                                                   static_cast<std::int8_t>(y) });
+                all_unit = all_unit && (std::abs(n.x * n.x + n.y * n.y + n.z * n.z - 1.f) < 1e-6f);
+            }
+        }
+        CHECK(all_unit);
+    }
+
+    SECTION("Octahedral angular error bounds")
+    {
+        auto const normals = sphere_points(100000);
+        CHECK(max_angular_error_degrees<std::int8_t>(normals) < 1.2);
+        CHECK(max_angular_error_degrees<std::int16_t>(normals) < 0.005);
+    }
+
+    SECTION("Octahedral round trip is stable")
+    {
+        bool all_stable = true;
+        for (auto const& n : sphere_points(1000)) {
+            auto const e = encode_octahedral<std::int16_t>(n);
+            all_stable = all_stable && (encode_octahedral<std::int16_t>(decode_octahedral<double>(e)) == e);
+        }
+        CHECK(all_stable);
+    }
+
+    SECTION("Point quantization")
+    {
+        AABB3<float> const bounds(Point3<float>(-1.f, 0.f, 10.f), Point3<float>(1.f, 4.f, 12.f));
+        CHECK(quantize(bounds, bounds.min) == QuantizedPoint3{ 0, 0, 0 });
+        CHECK(quantize(bounds, bounds.max) == QuantizedPoint3{ 65535, 65535, 65535 });
+        CHECK(quantize(bounds, Point3<float>(0.f, 1.f, 11.f)) == QuantizedPoint3{ 32768, 16384, 32768 });
+        // points outside the box are clamped
+        CHECK(quantize(bounds, Point3<float>(-5.f, 9.f, 11.f)) == QuantizedPoint3{ 0, 65535, 32768 });
+
+        CHECK(dequantize(bounds, QuantizedPoint3{ 0, 0, 0 }) == bounds.min);
+        CHECK(dequantize(bounds, QuantizedPoint3{ 65535, 65535, 65535 }) == bounds.max);
+
+        // error bound of half a quantization step per axis
+        AABB3<double> const box(Point3<double>(-100.0, -3.0, 7.0), Point3<double>(100.0, 5.0, 7.5));
+        Vector3<double> const bound = (box.max - box.min) / 131070.0;
+        bool all_within = true;
+        for (int i = 0; i < 10000; ++i) {
+            double const t = i / 9999.0;
+            Point3<double> const p(box.min.x + t * 200.0, box.min.y + (1.0 - t) * 8.0,
+                                   box.min.z + std::fmod(t * 17.0, 1.0) * 0.5);
+            Point3<double> const r = dequantize(box, quantize(box, p));
+            all_within = all_within && (std::abs(r.x - p.x) <= bound.x * 1.0001) &&
+                         (std::abs(r.y - p.y) <= bound.y * 1.0001) && (std::abs(r.z - p.z) <= bound.z * 1.0001);
+        }
+        CHECK(all_within);
+    }
+
+    SECTION("Point quantization with degenerate box")
+    {
+        AABB3<float> const flat(Point3<float>(0.f, 2.f, 0.f), Point3<float>(1.f, 2.f, 1.f));
+        CHECK(quantize(flat, Point3<float>(0.5f, 2.f, 1.f)) == QuantizedPoint3{ 32768, 0, 65535 });
+        CHECK(dequantize(flat, QuantizedPoint3{ 0, 1234, 65535 }) == Point3<float>(0.f, 2.f, 1.f));
+    }
+
+    SECTION("Bulk functions match single element functions")
+    {
+        auto const normals_d = sphere_points(777);
+        std::vector<Normal3<float>> normals;
+        for (auto const& n : normals_d) { normals.push_back(Normal3<float>(n)); }
+
+        std::vector<OctahedralNormal16> encoded(normals.size());
+        encode_octahedral(std::span<Normal3<float> const>(normals), std::span<OctahedralNormal16>(encoded));
+        std::vector<Normal3<float>> decoded(normals.size());
+        decode_octahedral(std::span<OctahedralNormal16 const>(encoded), std::span<Normal3<float>>(decoded));
+        bool all_match = true;
+        for (std::size_t i = 0; i < normals.size(); ++i) {
+            all_match = all_match && (encoded[i] == encode_octahedral<std::int16_t>(normals[i])) &&
+                        (decoded[i] == decode_octahedral(encoded[i]));
+        }
+        CHECK(all_match);
+
+        AABB3<float> const bounds(Point3<float>(-1.f, -1.f, -1.f), Point3<float>(1.f, 1.f, 1.f));
+        std::vector<Point3<float>> points;
+        for (auto const& n : normals) { points.push_back(Point3<float>(n.x, n.y, n.z)); }
+        std::vector<QuantizedPoint3> quantized(points.size());
+        quantize(bounds, std::span<Point3<float> const>(points), std::span<QuantizedPoint3>(quantized));
+        std::vector<Point3<float>> restored(points.size());
+        dequantize(bounds, std::span<QuantizedPoint3 const>(quantized), std::span<Point3<float>>(restored));
+        all_match = true;
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            all_match = all_match && (quantized[i] == quantize(bounds, points[i])) &&
+                        (restored[i] == dequantize(bounds, quantized[i]));
+        }
+        CHECK(all_match);
+    }
+}
@@ -0,0 +1,160 @@
+#include <gbMath/SparseMatrix.hpp>
+
+#include <gbMath/Matrix.hpp>
+
+#include <catch.hpp>
+
+#include <vector>
+
+TEST_CASE("SparseMatrix")
+{
+    using GHULBUS_MATH_NAMESPACE::SparseMatrix;
+    using GHULBUS_MATH_NAMESPACE::SparseMatrixEntry;
+    using Catch::Approx;
+
+    // [ 4 0 1 ]
+    // [ 0 2 0 ]
+    // [ 1 3 5 ]
+    // [ 0 0 0 ]
+    std::vector<SparseMatrixEntry<double>> const entries{
+        { 2, 2, 5.0 }, { 0, 0, 3.0 }, { 1, 1, 2.0 }, { 2, 1, 3.0 },
+        { 0, 2, 1.0 }, { 0, 0, 1.0 }, { 2, 0, 1.0 }
+    };
+    SparseMatrix<double> const m(4, 3, entries);
+
+    SECTION("Default construction")
+    {
+        SparseMatrix<float> const empty;
+        CHECK(empty.rows() == 0);
+        CHECK(empty.columns() == 0);
+        CHECK(empty.non_zeros() == 0);
+        CHECK(empty.row_offsets().size() == 1);
+    }
+
+    SECTION("Assembly from entries")
+    {
+        CHECK(m.rows() == 4);
+        CHECK(m.columns() == 3);
+        CHECK(m.non_zeros() == 6);
+        CHECK(std::vector<std::size_t>(m.row_offsets().begin(), m.row_offsets().end()) ==
+              std::vector<std::size_t>{ 0, 2, 3, 6, 6 });
+        CHECK(std::vector<std::size_t>(m.column_indices().begin(), m.column_indices().end()) ==
+              std::vector<std::size_t>{ 0, 2, 1, 0, 1, 2 });
+        CHECK(m(0, 0) == 4.0);
+        CHECK(m(0, 1) == 0.0);
+        CHECK(m(0, 2) == 1.0);
+        CHECK(m(2, 1) == 3.0);
+        CHECK(m(3, 2) == 0.0);
+    }
+
+    SECTION("Construction from CSR arrays")
+    {
+        SparseMatrix<double> const m2(4, 3, { 0, 2, 3, 6, 6 }, { 0, 2, 1, 0, 1, 2 },
+                                      { 4.0, 1.0, 2.0, 1.0, 3.0, 5.0 });
+        for (std::size_t i = 0; i < 4; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                CHECK(m2(i, j) == m(i, j));
+            }
+        }
+    }
+
+    SECTION("Matrix-vector multiplication")
+    {
+        std::vector<double> const x{ 1.0, -1.0, 2.0 };
+        std::vector<double> y(4, 42.0);
+        m.multiply(x, y);
+        CHECK(y == std::vector<double>{ 6.0, -2.0, 8.0, 0.0 });
+    }
+
+    SECTION("Matrix-vector multiplication of row range")
+    {
+        std::vector<double> const x{ 1.0, -1.0, 2.0 };
+        std::vector<double> y(4, 42.0);
+        m.multiply(x, y, 1, 3);
+        CHECK(y == std::vector<double>{ 42.0, -2.0, 8.0, 42.0 });
+        m.multiply(x, y, 0, 1);
+        m.multiply(x, y, 3, 4);
+        CHECK(y == std::vector<double>{ 6.0, -2.0, 8.0, 0.0 });
+    }
+
+    SECTION("Values can be modified in place")
+    {
+        SparseMatrix<double> m2 = m;
+        for (auto& v : m2.values()) { v *= 2.0; }
+        CHECK(m2(2, 2) == 10.0);
+        CHECK(m2.non_zeros() == m.non_zeros());
+    }
+
+    SECTION("Inverse diagonal")
+    {
+        SparseMatrix<double> const square(3, 3, std::vector<SparseMatrixEntry<double>>(entries.begin(), entries.end()));
+        auto const inv_diag = square.inverse_diagonal();
+        REQUIRE(inv_diag.size() == 3);
+        CHECK(inv_diag[0] == Approx(0.25));
+        CHECK(inv_diag[1] == Approx(0.5));
+        CHECK(inv_diag[2] == Approx(0.2));
+    }
+}
+
+TEST_CASE("BlockSparseMatrix3")
+{
+    using GHULBUS_MATH_NAMESPACE::BlockSparseMatrix3;
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::SparseMatrixEntry;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using Catch::Approx;
+
+    Matrix3<double> const b00(4.0, 1.0, 0.0,
+                              1.0, 4.0, 1.0,
+                              0.0, 1.0, 4.0);
+    Matrix3<double> const b01(1.0, 2.0, 3.0,
+                              0.0, -1.0, 0.0,
+                              0.5, 0.0, 1.0);
+    Matrix3<double> const b11(5.0, 0.0, 0.0,
+                              0.0, 6.0, 0.0,
+                              0.0, 0.0, 7.0);
+    std::vector<SparseMatrixEntry<Matrix3<double>>> const entries{
+        { 0, 0, b00 }, { 0, 1, b01 }, { 1, 1, b11 }
+    };
+    BlockSparseMatrix3<double> const m(2, 2, entries);
+
+    SECTION("Block access")
+    {
+        CHECK(m.non_zeros() == 3);
+        CHECK(m(0, 1) == b01);
+        CHECK(m(1, 0) == Matrix3<double>());
+    }
+
+    SECTION("Matrix-vector multiplication matches dense product")
+    {
+        std::vector<Vector3<double>> const x{ Vector3<double>(1.0, 2.0, 3.0), Vector3<double>(-1.0, 0.5, 2.0) };
+        std::vector<Vector3<double>> y(2);
+        m.multiply(x, y);
+
+        Matrix<double, 6, 6> dense;
+        for (std::size_t i = 0; i < 3; ++i) {
+            for (std::size_t j = 0; j < 3; ++j) {
+                dense(i, j) = b00[i * 3 + j];
+                dense(i, j + 3) = b01[i * 3 + j];
+                dense(i + 3, j + 3) = b11[i * 3 + j];
+            }
+        }
+        auto const expected = dense * Vector<double, 6>(1.0, 2.0, 3.0, -1.0, 0.5, 2.0);
+        CHECK(y[0].x == Approx(expected[0]));
+        CHECK(y[0].y == Approx(expected[1]));
+        CHECK(y[0].z == Approx(expected[2]));
+        CHECK(y[1].x == Approx(expected[3]));
+        CHECK(y[1].y == Approx(expected[4]));
+        CHECK(y[1].z == Approx(expected[5]));
+    }
+
+    SECTION("Duplicate blocks are summed")
+    {
+        std::vector<SparseMatrixEntry<Matrix3<double>>> const dup{ { 1, 0, b00 }, { 1, 0, b11 } };
+        BlockSparseMatrix3<double> const m2(2, 2, dup);
+        CHECK(m2.non_zeros() == 1);
+        CHECK(m2(1, 0) == b00 + b11);
+    }
+}
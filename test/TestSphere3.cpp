@@ -222,4 +222,14 @@ TEST_CASE("Sphere3")
         CHECK(!p.doesHitSphere());
         CHECK(!p);
     }
+
+    SECTION("Sphere-AABB signed distance")
+    {
+        using GHULBUS_MATH_NAMESPACE::AABB3;
+        AABB3<float> const b(Point3<float>(0.f, 0.f, 0.f), Point3<float>(4.f, 6.f, 8.f));
+        CHECK(signed_distance(Sphere3<float>(Point3<float>(7.f, 10.f, 4.f), 2.f), b) == 3.f);
+        CHECK(signed_distance(b, Sphere3<float>(Point3<float>(7.f, 10.f, 4.f), 2.f)) == 3.f);
+        CHECK(signed_distance(Sphere3<float>(Point3<float>(5.f, 3.f, 4.f), 2.f), b) == -1.f);
+        CHECK(signed_distance(Sphere3<float>(Point3<float>(2.f, 3.f, 4.f), 1.f), b) == -3.f);
+    }
 }
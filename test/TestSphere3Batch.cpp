@@ -0,0 +1,89 @@
+#include <gbMath/Sphere3Batch.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+TEST_CASE("Sphere3 Batch")
+{
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3SoA;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Line3;
+    using GHULBUS_MATH_NAMESPACE::NormalizedLine3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    std::vector<float> const center_x{ 10.f,  5.f, 1.f, 20.f, -5.f,  5.f };
+    std::vector<float> const center_y{  0.f,  0.f, 1.f,  0.f,  0.f, 10.f };
+    std::vector<float> const center_z{  0.f,  0.f, 1.f,  0.f,  0.f,  0.f };
+    std::vector<float> const radius  {  2.f,  1.f, 2.f,  5.f,  1.f,  1.f };
+    Sphere3SoA<float> const spheres{ center_x, center_y, center_z, radius };
+    float const inf = std::numeric_limits<float>::infinity();
+
+    SECTION("One ray against many spheres")
+    {
+        NormalizedLine3<float> const ray(Line3<float>(Point3<float>(-1.f, 0.f, 0.f), Vector3<float>(3.f, 0.f, 0.f)));
+        std::vector<float> t(spheres.size());
+        intersect_p(ray, spheres, std::span<float>(t));
+        for (std::size_t i = 0; i < spheres.size(); ++i) {
+            auto const expected = intersect_p(spheres[i], ray);
+            if (expected) {
+                CHECK(t[i] == *expected);
+            } else {
+                CHECK(t[i] == inf);
+            }
+        }
+        CHECK(t[0] == 9.f);
+        CHECK(t[1] == 5.f);
+        CHECK(t[2] == Approx(2.f - std::sqrt(2.f)));
+        CHECK(t[4] == inf);
+        CHECK(t[5] == inf);
+    }
+
+    SECTION("Nearest hit")
+    {
+        auto hit = intersect_nearest(NormalizedLine3<float>(Line3<float>(Point3<float>(3.f, 0.f, 0.f),
+                                                                         Vector3<float>(1.f, 0.f, 0.f))), spheres);
+        REQUIRE(hit);
+        CHECK(hit->index == 1);
+        CHECK(hit->t == 1.f);
+
+        // ray origin inside a sphere
+        hit = intersect_nearest(NormalizedLine3<float>(Line3<float>(Point3<float>(1.f, 1.f, 1.f),
+                                                                    Vector3<float>(0.f, 1.f, 0.f))), spheres);
+        REQUIRE(hit);
+        CHECK(hit->index == 2);
+        CHECK(hit->t == 0.f);
+
+        hit = intersect_nearest(NormalizedLine3<float>(Line3<float>(Point3<float>(0.f, 0.f, 50.f),
+                                                                    Vector3<float>(0.f, 0.f, 1.f))), spheres);
+        CHECK(!hit);
+
+        hit = intersect_nearest(NormalizedLine3<float>(Line3<float>(Point3<float>(0.f, 0.f, 0.f),
+                                                                    Vector3<float>(1.f, 0.f, 0.f))),
+                                Sphere3SoA<float>{});
+        CHECK(!hit);
+    }
+
+    SECTION("Many rays against one sphere")
+    {
+        Sphere3<double> const s(Point3<double>(1.0, 1.0, 1.0), 2.0);
+        std::vector<NormalizedLine3<double>> rays{
+            NormalizedLine3<double>(Line3<double>(Point3<double>(-5.0, 1.0, 1.0), Vector3<double>(2.0, 0.0, 0.0))),
+            NormalizedLine3<double>(Line3<double>(Point3<double>(5.0, 0.0, 0.0), Vector3<double>(1.0, 0.0, 0.0))),
+            NormalizedLine3<double>(Line3<double>(Point3<double>(-5.0, 3.0, 1.0), Vector3<double>(1.0, 0.0, 0.0))),
+            NormalizedLine3<double>(Line3<double>(Point3<double>(1.0, 1.0, 1.0), Vector3<double>(-1.0, 0.0, 0.0))),
+            NormalizedLine3<double>(Line3<double>(Point3<double>(-5.0, -1.0, 0.0), Vector3<double>(1.0, 2.0, 3.0))),
+        };
+        std::vector<double> t(rays.size());
+        intersect_p(s, std::span<NormalizedLine3<double> const>(rays), std::span<double>(t));
+        CHECK(t[0] == 4.0);
+        CHECK(t[1] == std::numeric_limits<double>::infinity());
+        CHECK(t[2] == 6.0);
+        CHECK(t[3] == 0.0);
+        CHECK(t[4] == std::numeric_limits<double>::infinity());
+    }
+}
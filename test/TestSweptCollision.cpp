@@ -0,0 +1,174 @@
+#include <gbMath/SweptCollision.hpp>
+#include <gbMath/VectorIO3.hpp>
+
+#include <catch.hpp>
+
+#include <cmath>
+
+TEST_CASE("SweptCollision")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::Plane3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Sphere3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::time_of_impact;
+
+    Vector3<double> const zero(0, 0, 0);
+
+    SECTION("Sphere3 vs. Sphere3")
+    {
+        Sphere3<double> const s0(Point3<double>(0, 0, 0), 1.0);
+        Sphere3<double> const s1(Point3<double>(10, 0, 0), 2.0);
+        // head-on: gap of 7 closed at relative speed 10
+        auto const t = time_of_impact(s0, Vector3<double>(10, 0, 0), s1, zero);
+        REQUIRE(t);
+        CHECK(*t == Approx(0.7));
+        // motion split between both spheres gives the same result
+        auto const t_split = time_of_impact(s0, Vector3<double>(5, 0, 0), s1, Vector3<double>(-5, 0, 0));
+        REQUIRE(t_split);
+        CHECK(*t_split == Approx(0.7));
+        // not far enough
+        CHECK(!time_of_impact(s0, Vector3<double>(6, 0, 0), s1, zero));
+        // moving apart
+        CHECK(!time_of_impact(s0, Vector3<double>(-10, 0, 0), s1, zero));
+        // passing by
+        CHECK(!time_of_impact(s0, Vector3<double>(20, 0, 0),
+                              Sphere3<double>(Point3<double>(10, 3.5, 0), 2.0), zero));
+        // grazing
+        auto const t_graze = time_of_impact(s0, Vector3<double>(20, 0, 0),
+                                            Sphere3<double>(Point3<double>(10, 3, 0), 2.0), zero);
+        REQUIRE(t_graze);
+        CHECK(*t_graze == Approx(0.5));
+        // already overlapping
+        CHECK(time_of_impact(s0, zero, Sphere3<double>(Point3<double>(2, 0, 0), 1.5), zero) == 0.0);
+        // no relative motion
+        CHECK(!time_of_impact(s0, Vector3<double>(1, 1, 1), s1, Vector3<double>(1, 1, 1)));
+    }
+
+    SECTION("Fast Sphere3 tunneling through small Sphere3")
+    {
+        // a discrete test at t = 0 and t = 1 misses this entirely
+        Sphere3<double> const bullet(Point3<double>(-100, 0, 0), 0.1);
+        Sphere3<double> const target(Point3<double>(0, 0, 0), 0.5);
+        auto const t = time_of_impact(bullet, Vector3<double>(200, 0, 0), target, zero);
+        REQUIRE(t);
+        CHECK(*t == Approx(99.4 / 200.0));
+    }
+
+    SECTION("Sphere3 vs. AABB3")
+    {
+        AABB3<double> const box(Point3<double>(0, 0, 0), Point3<double>(2, 2, 2));
+        SECTION("Face")
+        {
+            Sphere3<double> const s(Point3<double>(-5, 1, 1), 1.0);
+            auto const t = time_of_impact(s, Vector3<double>(8, 0, 0), box, zero);
+            REQUIRE(t);
+            CHECK(*t == Approx(0.5));
+            // box moving towards the sphere instead
+            auto const t_box = time_of_impact(s, zero, box, Vector3<double>(-8, 0, 0));
+            REQUIRE(t_box);
+            CHECK(*t_box == Approx(0.5));
+            CHECK(!time_of_impact(s, Vector3<double>(3.9, 0, 0), box, zero));
+            CHECK(!time_of_impact(s, Vector3<double>(-8, 0, 0), box, zero));
+        }
+        SECTION("Edge")
+        {
+            // moving along z, passing the edge at x = y = 0 diagonally
+            double const offset = -1.0 / std::sqrt(2.0);
+            Sphere3<double> const s(Point3<double>(offset, offset, -5), 1.0);
+            auto const t = time_of_impact(s, Vector3<double>(0, 0, 10), box, zero);
+            REQUIRE(t);
+            // the sphere center is exactly at distance 1 from the edge line and touches once it reaches z = 0
+            CHECK(*t == Approx(0.5));
+            // moving towards the edge
+            Sphere3<double> const s2(Point3<double>(-3, -3, 1), 1.0);
+            auto const t2 = time_of_impact(s2, Vector3<double>(6, 6, 0), box, zero);
+            REQUIRE(t2);
+            CHECK(*t2 == Approx((3.0 - 1.0 / std::sqrt(2.0)) / 6.0));
+        }
+        SECTION("Corner")
+        {
+            Sphere3<double> const s(Point3<double>(-3, -3, -3), 1.0);
+            auto const t = time_of_impact(s, Vector3<double>(6, 6, 6), box, zero);
+            REQUIRE(t);
+            CHECK(*t == Approx((3.0 - 1.0 / std::sqrt(3.0)) / 6.0));
+            // passes close to the corner, inside the expanded box but outside the rounded box
+            Sphere3<double> const s_miss(Point3<double>(-0.9, -0.9, -5), 1.0);
+            CHECK(!time_of_impact(s_miss, Vector3<double>(0, 0, 10), box, zero));
+        }
+        SECTION("Already overlapping")
+        {
+            CHECK(time_of_impact(Sphere3<double>(Point3<double>(-0.5, 1, 1), 1.0), zero, box, zero) == 0.0);
+            CHECK(time_of_impact(Sphere3<double>(Point3<double>(1, 1, 1), 0.1), zero, box, zero) == 0.0);
+        }
+        SECTION("Tunneling through thin box")
+        {
+            AABB3<double> const wall(Point3<double>(-0.01, -10, -10), Point3<double>(0.01, 10, 10));
+            Sphere3<double> const s(Point3<double>(-50, 0, 0), 0.25);
+            auto const t = time_of_impact(s, Vector3<double>(100, 0, 0), wall, zero);
+            REQUIRE(t);
+            CHECK(*t == Approx((50.0 - 0.26) / 100.0));
+        }
+    }
+
+    SECTION("AABB3 vs. AABB3")
+    {
+        AABB3<double> const a(Point3<double>(0, 0, 0), Point3<double>(1, 1, 1));
+        AABB3<double> const b(Point3<double>(5, 0, 0), Point3<double>(6, 1, 1));
+        auto const t = time_of_impact(a, Vector3<double>(8, 0, 0), b, zero);
+        REQUIRE(t);
+        CHECK(*t == Approx(0.5));
+        auto const t_both = time_of_impact(a, Vector3<double>(4, 0, 0), b, Vector3<double>(-4, 0, 0));
+        REQUIRE(t_both);
+        CHECK(*t_both == Approx(0.5));
+        CHECK(!time_of_impact(a, Vector3<double>(3, 0, 0), b, zero));
+        CHECK(!time_of_impact(a, Vector3<double>(8, 3, 0), b, zero));
+        CHECK(!time_of_impact(a, Vector3<double>(-8, 0, 0), b, zero));
+        // diagonal: x overlap starts at 0.5, y overlap starts at 0.75
+        AABB3<double> const c(Point3<double>(5, 7, 0), Point3<double>(6, 8, 1));
+        auto const t_diag = time_of_impact(a, Vector3<double>(8, 8, 0), c, zero);
+        REQUIRE(t_diag);
+        CHECK(*t_diag == Approx(0.75));
+        // already overlapping
+        CHECK(time_of_impact(a, zero, AABB3<double>(Point3<double>(0.5, 0.5, 0.5), Point3<double>(2, 2, 2)), zero)
+              == 0.0);
+        // tunneling through a thin wall
+        AABB3<double> const wall(Point3<double>(10, -10, -10), Point3<double>(10.01, 10, 10));
+        auto const t_wall = time_of_impact(a, Vector3<double>(100, 0, 0), wall, zero);
+        REQUIRE(t_wall);
+        CHECK(*t_wall == Approx(0.09));
+    }
+
+    SECTION("Sphere3 vs. Plane3")
+    {
+        Plane3<double> const plane(Vector3<double>(0, 0, 2), Point3<double>(0, 0, 1));
+        Sphere3<double> const s(Point3<double>(0, 0, 5), 1.0);
+        auto const t = time_of_impact(s, Vector3<double>(1, 0, -6), plane);
+        REQUIRE(t);
+        CHECK(*t == Approx(0.5));
+        CHECK(!time_of_impact(s, Vector3<double>(0, 0, -2), plane));
+        CHECK(!time_of_impact(s, Vector3<double>(0, 0, 6), plane));
+        CHECK(!time_of_impact(s, Vector3<double>(10, 0, 0), plane));
+        // from the negative side
+        Sphere3<double> const s_below(Point3<double>(0, 0, -3), 1.0);
+        auto const t_below = time_of_impact(s_below, Vector3<double>(0, 0, 6), plane);
+        REQUIRE(t_below);
+        CHECK(*t_below == Approx(0.5));
+        // touching
+        CHECK(time_of_impact(Sphere3<double>(Point3<double>(0, 0, 1.5), 1.0), zero, plane) == 0.0);
+        // tunneling
+        auto const t_fast = time_of_impact(s, Vector3<double>(0, 0, -1000), plane);
+        REQUIRE(t_fast);
+        CHECK(*t_fast == Approx(0.003));
+    }
+
+    SECTION("Float")
+    {
+        Sphere3<float> const s(Point3<float>(-5, 1, 1), 1.0f);
+        AABB3<float> const box(Point3<float>(0, 0, 0), Point3<float>(2, 2, 2));
+        auto const t = time_of_impact(s, Vector3<float>(8, 0, 0), box, Vector3<float>(0, 0, 0));
+        REQUIRE(t);
+        CHECK(*t == Approx(0.5f));
+    }
+}
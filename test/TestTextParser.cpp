@@ -0,0 +1,216 @@
+#include <gbMath/TextParser.hpp>
+#include <gbMath/MatrixIO.hpp>
+#include <gbMath/RationalIO.hpp>
+#include <gbMath/VectorIO.hpp>
+
+#include <catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+TEST_CASE("TextParser")
+{
+    using GHULBUS_MATH_NAMESPACE::Matrix;
+    using GHULBUS_MATH_NAMESPACE::Matrix2;
+    using GHULBUS_MATH_NAMESPACE::Matrix3;
+    using GHULBUS_MATH_NAMESPACE::Matrix4;
+    using GHULBUS_MATH_NAMESPACE::parse;
+    using GHULBUS_MATH_NAMESPACE::parse_each;
+    using GHULBUS_MATH_NAMESPACE::Point2;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Rational;
+    using GHULBUS_MATH_NAMESPACE::RationalImpl;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::Vector4;
+    namespace RationalPolicies = GHULBUS_MATH_NAMESPACE::RationalPolicies;
+
+    SECTION("from_chars Vector3")
+    {
+        std::string_view const str = "[1.5 -2 3e2] tail";
+        Vector3<double> v(0, 0, 0);
+        auto const res = from_chars(str.data(), str.data() + str.size(), v);
+        CHECK(res.ec == std::errc{});
+        CHECK(res.ptr == str.data() + 12);
+        CHECK(v == Vector3<double>(1.5, -2, 300));
+    }
+
+    SECTION("from_chars failure leaves value unmodified")
+    {
+        std::string_view const str = "[1 2 x]";
+        Vector3<int> v(7, 8, 9);
+        auto const res = from_chars(str.data(), str.data() + str.size(), v);
+        CHECK(res.ec == std::errc::invalid_argument);
+        CHECK(res.ptr == str.data() + 5);
+        CHECK(v == Vector3<int>(7, 8, 9));
+
+        std::string_view const overflow = "[1 300]";
+        Vector2<unsigned char> c(0, 0);
+        CHECK(from_chars(overflow.data(), overflow.data() + overflow.size(), c).ec == std::errc::result_out_of_range);
+    }
+
+    SECTION("Vectors")
+    {
+        CHECK(parse<Vector2<int>>("[1 2]") == Vector2<int>(1, 2));
+        CHECK(parse<Point2<float>>("[0.25 -4]") == Point2<float>(0.25f, -4.f));
+        CHECK(parse<Point3<int>>("  [ 1\t2\n3 ]  ") == Point3<int>(1, 2, 3));
+        CHECK(parse<Vector4<double>>("[1 2 3 4]") == Vector4<double>(1, 2, 3, 4));
+        CHECK(parse<Vector<int, 5>>("[1 2 3 4 5]") == Vector<int, 5>(1, 2, 3, 4, 5));
+        CHECK(parse<Vector3<unsigned char>>("[0 128 255]") == Vector3<unsigned char>(0, 128, 255));
+        // malformed input
+        CHECK(!parse<Vector3<int>>(""));
+        CHECK(!parse<Vector3<int>>("[1 2]"));
+        CHECK(!parse<Vector3<int>>("[1 2 3 4]"));
+        CHECK(!parse<Vector3<int>>("[1 2 3"));
+        CHECK(!parse<Vector3<int>>("1 2 3"));
+        CHECK(!parse<Vector3<int>>("[1,2,3]"));
+        CHECK(!parse<Vector3<int>>("[1 2 3] [4 5 6]"));
+        CHECK(!parse<Vector3<int>>("[1 2 3.5]"));
+    }
+
+    SECTION("Matrices")
+    {
+        CHECK(parse<Matrix2<int>>("[ [1 2] [3 4] ]") == Matrix2<int>(1, 2, 3, 4));
+        CHECK(parse<Matrix3<double>>("[ [1 2 3] [4 5 6] [7 8 9] ]") == Matrix3<double>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+        CHECK(parse<Matrix4<int>>("[[1 2 3 4][5 6 7 8][9 10 11 12][13 14 15 16]]") ==
+              Matrix4<int>(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16));
+        using ColMatrix = Matrix<int, 2, 3, GHULBUS_MATH_NAMESPACE::MatrixPolicies::Order::ColumnMajor>;
+        CHECK(parse<ColMatrix>("[ [1 2 3] [4 5 6] ]") == ColMatrix(1, 2, 3, 4, 5, 6));
+        CHECK(!parse<Matrix2<int>>("[ [1 2] ]"));
+        CHECK(!parse<Matrix2<int>>("[ [1 2] [3 4]"));
+        CHECK(!parse<Matrix2<int>>("[ [1 2 3] [4 5 6] ]"));
+    }
+
+    SECTION("Rationals")
+    {
+        CHECK(parse<Rational<int>>("1/2") == Rational<int>(1, 2));
+        CHECK(parse<Rational<int>>("-3/6") == Rational<int>(-1, 2));
+        CHECK(parse<Rational<unsigned char>>("42/5") == Rational<unsigned char>(42, 5));
+        CHECK(!parse<Rational<int>>("1"));
+        CHECK(!parse<Rational<int>>("1/"));
+        CHECK(!parse<Rational<int>>("1 /2"));
+        CHECK(!parse<Rational<int>>("1/-"));
+        // a zero denominator is only accepted by the permissive policy
+        auto const permissive = parse<Rational<int>>("1/0");
+        REQUIRE(permissive);
+        CHECK(!isValid(*permissive));
+        CHECK(!parse<RationalImpl<int, RationalPolicies::AbortOnDivByZero>>("1/0"));
+        CHECK(parse<RationalImpl<int, RationalPolicies::AbortOnDivByZero>>("2/4") ==
+              RationalImpl<int, RationalPolicies::AbortOnDivByZero>(1, 2));
+    }
+
+    SECTION("Round trip through ostream inserters")
+    {
+        std::stringstream sstr;
+        sstr << Vector3<int>(-1, 2, 3) << ' ' << Matrix3<int>(1, 2, 3, 4, 5, 6, 7, 8, 9) << ' ' << Rational<int>(3, 4)
+             << ' ' << Matrix<int, 2, 3>(1, 2, 3, 4, 5, 6);
+        std::string const str = sstr.str();
+        char const* it = str.data();
+        char const* const last = str.data() + str.size();
+        Vector3<int> v;
+        auto res = from_chars(it, last, v);
+        REQUIRE(res.ec == std::errc{});
+        CHECK(v == Vector3<int>(-1, 2, 3));
+        Matrix3<int> m;
+        res = from_chars(res.ptr + 1, last, m);
+        REQUIRE(res.ec == std::errc{});
+        CHECK(m == Matrix3<int>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+        Rational<int> r;
+        res = from_chars(res.ptr + 1, last, r);
+        REQUIRE(res.ec == std::errc{});
+        CHECK(r == Rational<int>(3, 4));
+        Matrix<int, 2, 3> mn;
+        res = from_chars(res.ptr + 1, last, mn);
+        REQUIRE(res.ec == std::errc{});
+        CHECK(mn == Matrix<int, 2, 3>(1, 2, 3, 4, 5, 6));
+        CHECK(res.ptr == last);
+    }
+
+    SECTION("parse_each on a character range")
+    {
+        std::string_view const str = " [1 2]\n[3 4]  [5 6]\n";
+        std::vector<Vector2<int>> values;
+        auto res = parse_each<Vector2<int>>(str.data(), str.data() + str.size(),
+                                            [&](Vector2<int> const& v) { values.push_back(v); });
+        CHECK(res.ec == std::errc{});
+        CHECK(res.ptr == str.data() + str.size());
+        CHECK(values == std::vector<Vector2<int>>{ Vector2<int>(1, 2), Vector2<int>(3, 4), Vector2<int>(5, 6) });
+
+        values.clear();
+        std::string_view const invalid = "[1 2] [3 x]";
+        res = parse_each<Vector2<int>>(invalid.data(), invalid.data() + invalid.size(),
+                                       [&](Vector2<int> const& v) { values.push_back(v); });
+        CHECK(res.ec == std::errc::invalid_argument);
+        CHECK(res.ptr == invalid.data() + 9);
+        CHECK(values.size() == 1);
+
+        // stop early
+        int count = 0;
+        res = parse_each<Vector2<int>>(str.data(), str.data() + str.size(),
+                                       [&](Vector2<int> const&) { return ++count < 2; });
+        CHECK(res.ec == std::errc{});
+        CHECK(count == 2);
+    }
+
+    SECTION("parse_each on a stream")
+    {
+        std::stringstream sstr;
+        for (int i = 0; i < 10000; ++i) {
+            sstr << Vector3<int>(i, -i, 2 * i) << ((i % 7 == 0) ? "\n" : "   ");
+        }
+        std::string const data = sstr.str();
+
+        // small buffers force values to be split across block boundaries
+        for (std::size_t const buffer_size : { std::size_t{ 32 }, std::size_t{ 100 }, std::size_t{ 1 << 16 } }) {
+            std::stringstream input(data);
+            int expected = 0;
+            bool all_match = true;
+            std::size_t const count = parse_each<Vector3<int>>(input, [&](Vector3<int> const& v) {
+                    all_match = all_match && (v == Vector3<int>(expected, -expected, 2 * expected));
+                    ++expected;
+                }, buffer_size);
+            CHECK(count == 10000);
+            CHECK(all_match);
+            CHECK(!input.fail());
+            CHECK(input.eof());
+        }
+
+        // no trailing whitespace
+        {
+            std::stringstream input("[1 2 3] [4 5 6]");
+            CHECK(parse_each<Vector3<int>>(input, [](Vector3<int> const&) {}, 8) == 2);
+            CHECK(!input.fail());
+        }
+
+        // syntax error
+        {
+            std::stringstream input("[1 2 3] [4 5 6] [7 x 9] [1 2 3]");
+            CHECK(parse_each<Vector3<int>>(input, [](Vector3<int> const&) {}, 12) == 2);
+            CHECK(input.fail());
+        }
+
+        // truncated input
+        {
+            std::stringstream input("[1 2 3] [4 5");
+            CHECK(parse_each<Vector3<int>>(input, [](Vector3<int> const&) {}) == 1);
+            CHECK(input.fail());
+        }
+
+        // value larger than the buffer
+        {
+            std::stringstream input("[100000 200000 300000] [1 2 3]");
+            CHECK(parse_each<Vector3<int>>(input, [](Vector3<int> const&) {}, 8) == 0);
+            CHECK(input.fail());
+        }
+
+        // stop early
+        {
+            std::stringstream input(data);
+            CHECK(parse_each<Vector3<int>>(input, [](Vector3<int> const& v) { return v.x < 99; }, 64) == 100);
+        }
+    }
+}
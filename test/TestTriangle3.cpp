@@ -0,0 +1,105 @@
+#include <gbMath/Triangle3.hpp>
+
+#include <catch.hpp>
+
+TEST_CASE("Triangle3")
+{
+    using GHULBUS_MATH_NAMESPACE::Triangle3;
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::Line3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::WatertightLine3;
+    using GHULBUS_MATH_NAMESPACE::doNotInitialize;
+
+    Triangle3<float> const tri(Point3<float>(0.f, 0.f, 0.f), Point3<float>(4.f, 0.f, 0.f), Point3<float>(0.f, 4.f, 0.f));
+
+    SECTION("Default construction")
+    {
+        Triangle3<float> t;
+        CHECK(t.a == Point3<float>());
+        CHECK(t.b == Point3<float>());
+        CHECK(t.c == Point3<float>());
+    }
+
+    SECTION("Uninitialized construction")
+    {
+        Triangle3<float> t(doNotInitialize);
+        t = tri;
+        CHECK(t == tri);
+    }
+
+    SECTION("Bounds")
+    {
+        CHECK(bounds(tri) == AABB3<float>(Point3<float>(0.f, 0.f, 0.f), Point3<float>(4.f, 4.f, 0.f)));
+    }
+
+    SECTION("Closest point")
+    {
+        // vertex regions
+        CHECK(closest_point(tri, Point3<float>(-1.f, -1.f, 2.f)) == tri.a);
+        CHECK(closest_point(tri, Point3<float>(5.f, -1.f, 0.f)) == tri.b);
+        CHECK(closest_point(tri, Point3<float>(-1.f, 6.f, 0.f)) == tri.c);
+        // edge regions
+        CHECK(closest_point(tri, Point3<float>(2.f, -3.f, 1.f)) == Point3<float>(2.f, 0.f, 0.f));
+        CHECK(closest_point(tri, Point3<float>(-3.f, 1.f, 0.f)) == Point3<float>(0.f, 1.f, 0.f));
+        CHECK(closest_point(tri, Point3<float>(3.f, 3.f, 0.f)) == Point3<float>(2.f, 2.f, 0.f));
+        // face region
+        CHECK(closest_point(tri, Point3<float>(1.f, 1.f, 5.f)) == Point3<float>(1.f, 1.f, 0.f));
+        CHECK(closest_point(tri, Point3<float>(1.f, 2.f, -5.f)) == Point3<float>(1.f, 2.f, 0.f));
+    }
+
+    SECTION("Ray intersection")
+    {
+        auto is = intersect(tri, Line3<float>(Point3<float>(1.f, 2.f, 5.f), Vector3<float>(0.f, 0.f, -2.f)));
+        REQUIRE(is);
+        CHECK(is->t == 2.5f);
+        CHECK(is->u == 0.25f);
+        CHECK(is->v == 0.25f);
+        CHECK(is->w == 0.5f);
+        // back face is hit as well
+        is = intersect(tri, Line3<float>(Point3<float>(1.f, 2.f, -5.f), Vector3<float>(0.f, 0.f, 1.f)));
+        REQUIRE(is);
+        CHECK(is->t == 5.f);
+        // triangle behind the ray
+        CHECK(!intersect(tri, Line3<float>(Point3<float>(1.f, 2.f, 5.f), Vector3<float>(0.f, 0.f, 1.f))));
+        // miss
+        CHECK(!intersect(tri, Line3<float>(Point3<float>(3.f, 3.f, 5.f), Vector3<float>(0.f, 0.f, -1.f))));
+        // ray parallel to the triangle
+        CHECK(!intersect(tri, Line3<float>(Point3<float>(1.f, 1.f, 1.f), Vector3<float>(1.f, 0.f, 0.f))));
+        // oblique ray
+        auto const t = intersect_p(tri, Line3<float>(Point3<float>(-1.f, 1.f, 1.f), Vector3<float>(2.f, 0.f, -1.f)));
+        REQUIRE(t);
+        CHECK(*t == 1.f);
+        CHECK(intersect_p(tri, WatertightLine3<float>(Line3<float>(Point3<float>(-1.f, 1.f, 1.f),
+                                                                  Vector3<float>(2.f, 0.f, -1.f)))) == t);
+    }
+
+    SECTION("Intersection is watertight on shared edges")
+    {
+        // two triangles forming the square [0,4]x[0,4], sharing the diagonal edge
+        Triangle3<float> const other(Point3<float>(4.f, 0.f, 0.f), Point3<float>(4.f, 4.f, 0.f), Point3<float>(0.f, 4.f, 0.f));
+        for (int i = 1; i < 64; ++i) {
+            float const x = static_cast<float>(i) / 16.f;
+            Point3<float> const on_edge(x, 4.f - x, 0.f);
+            Line3<float> const l(on_edge + Vector3<float>(0.3f, -0.1f, 1.f), Vector3<float>(-0.3f, 0.1f, -1.f));
+            CHECK((intersect(tri, l) || intersect(other, l)));
+            // ray passing exactly through the edge
+            Line3<float> const l_edge(on_edge + Vector3<float>(0.f, 0.f, 1.f), Vector3<float>(0.f, 0.f, -1.f));
+            CHECK((intersect(tri, l_edge) || intersect(other, l_edge)));
+        }
+        // shared vertex
+        Line3<float> const l(Point3<float>(4.f, 0.f, 1.f), Vector3<float>(0.f, 0.f, -1.f));
+        CHECK((intersect(tri, l) || intersect(other, l)));
+    }
+
+    SECTION("Double precision")
+    {
+        Triangle3<double> const tri_d(Point3<double>(0.0, 0.0, 0.0), Point3<double>(0.0, 0.0, 2.0),
+                                      Point3<double>(0.0, 2.0, 0.0));
+        auto const is = intersect(tri_d, Line3<double>(Point3<double>(-3.0, 0.5, 0.5), Vector3<double>(1.0, 0.0, 0.0)));
+        REQUIRE(is);
+        CHECK(is->t == 3.0);
+        CHECK(is->u + is->v + is->w == 1.0);
+    }
+}
@@ -0,0 +1,108 @@
+#include <gbMath/TriangleMesh.hpp>
+
+#include <catch.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+TEST_CASE("TriangleMesh")
+{
+    using GHULBUS_MATH_NAMESPACE::TriangleMesh;
+    using GHULBUS_MATH_NAMESPACE::Triangle3;
+    using GHULBUS_MATH_NAMESPACE::Line3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::WatertightLine3;
+
+    // a stack of 19 triangles parallel to the xy plane at z = 0, 1, 2, ...
+    std::vector<Triangle3<float>> triangles;
+    for (int i = 0; i < 19; ++i) {
+        float const z = static_cast<float>(i);
+        float const offset = (i % 3 == 0) ? 10.f : 0.f;
+        triangles.emplace_back(Point3<float>(offset, 0.f, z), Point3<float>(offset + 4.f, 0.f, z),
+                               Point3<float>(offset, 4.f, z));
+    }
+    TriangleMesh<float> mesh{ std::span<Triangle3<float> const>(triangles) };
+
+    SECTION("Construction")
+    {
+        REQUIRE(mesh.size() == triangles.size());
+        for (std::size_t i = 0; i < triangles.size(); ++i) {
+            CHECK(mesh[i] == triangles[i]);
+            CHECK(mesh.bounds(i) == bounds(triangles[i]));
+        }
+        CHECK(mesh.coordinates(2, 1)[5] == 4.f);
+        mesh.clear();
+        CHECK(mesh.empty());
+    }
+
+    SECTION("Permute")
+    {
+        std::vector<std::size_t> order(triangles.size());
+        for (std::size_t i = 0; i < order.size(); ++i) { order[i] = order.size() - 1 - i; }
+        mesh.permute(order);
+        for (std::size_t i = 0; i < triangles.size(); ++i) {
+            CHECK(mesh[i] == triangles[order[i]]);
+        }
+    }
+
+    SECTION("Nearest intersection")
+    {
+        WatertightLine3<float> const l(Line3<float>(Point3<float>(1.f, 1.f, 100.f), Vector3<float>(0.f, 0.f, -1.f)));
+        auto hit = intersect_nearest(l, mesh);
+        REQUIRE(hit);
+        CHECK(hit->index == 17);
+        CHECK(hit->intersection.t == 83.f);
+        auto const expected = intersect(triangles[17], l);
+        REQUIRE(expected);
+        CHECK(hit->intersection.u == expected->u);
+        CHECK(hit->intersection.v == expected->v);
+        CHECK(hit->intersection.w == expected->w);
+
+        // ranges
+        hit = intersect_nearest<float, 4>(l, mesh, 2, 11);
+        REQUIRE(hit);
+        CHECK(hit->index == 10);
+        CHECK(!intersect_nearest(l, mesh, 3, 4));
+        CHECK(!intersect_nearest(l, mesh, 5, 5));
+        // t_max culls farther hits
+        CHECK(!intersect_nearest(l, mesh, 0, 19, 80.f));
+
+        // ray from inside the stack, pointing up
+        hit = intersect_nearest(WatertightLine3<float>(Line3<float>(Point3<float>(1.f, 1.f, 4.5f),
+                                                                    Vector3<float>(0.f, 0.f, 2.f))), mesh);
+        REQUIRE(hit);
+        CHECK(hit->index == 5);
+        CHECK(hit->intersection.t == 0.25f);
+
+        // miss
+        CHECK(!intersect_nearest(WatertightLine3<float>(Line3<float>(Point3<float>(5.f, 5.f, 100.f),
+                                                                     Vector3<float>(0.f, 0.f, -1.f))), mesh));
+    }
+
+    SECTION("Results match single triangle intersection")
+    {
+        for (int i = 0; i < 50; ++i) {
+            float const f = static_cast<float>(i);
+            Line3<float> const l(Point3<float>(0.1f * f, 12.f - 0.2f * f, -3.f), Vector3<float>(0.05f * f, -0.3f, 1.f));
+            WatertightLine3<float> const wl(l);
+            auto const hit = intersect_nearest(wl, mesh);
+            std::optional<std::size_t> expected_index;
+            float expected_t = 0.f;
+            for (std::size_t j = 0; j < triangles.size(); ++j) {
+                auto const is = intersect(triangles[j], wl);
+                if (is && (!expected_index || (is->t < expected_t))) {
+                    expected_index = j;
+                    expected_t = is->t;
+                }
+            }
+            REQUIRE(hit.has_value() == expected_index.has_value());
+            if (hit) {
+                CHECK(hit->index == *expected_index);
+                CHECK(hit->intersection.t == expected_t);
+            }
+        }
+    }
+}
@@ -473,6 +473,12 @@ TEST_CASE("Vector")
             Vector<float, 4>(1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f)));
     }
 
+    SECTION("Fast vector normalization")
+    {
+        CHECK(normalized_fast(Vector<float, 4>(0.f, 0.f, 30.f, 0.f))[2] == Approx(1.f).epsilon(1e-5));
+        CHECK(length(normalized_fast(Vector<float, 5>(1.f, -2.f, 3.f, -4.f, 5.f))) == Approx(1.f).epsilon(1e-5));
+    }
+
     SECTION("Max component")
     {
         CHECK(max_component(Vector<int, 6>(10, 5, -1, 3, 6, 7)) == 10);
@@ -338,6 +338,14 @@ TEST_CASE("Vector2")
         CHECK(normalized(Vector2<float>(5.f, 5.f)) == Vector2<float>(1.f / std::sqrt(2.f), 1.f / std::sqrt(2.f)));
     }
 
+    SECTION("Fast vector normalization")
+    {
+        CHECK(normalized_fast(Vector2<float>(10.f, 0.f)).x == Approx(1.f).epsilon(1e-5));
+        CHECK(normalized_fast(Vector2<float>(10.f, 0.f)).y == 0.f);
+        CHECK(length(normalized_fast(Vector2<float>(-3.f, 4.f))) == Approx(1.f).epsilon(1e-5));
+        CHECK(normalized_fast(Vector2<double>(5.0, 5.0)) == normalized(Vector2<double>(5.0, 5.0)));
+    }
+
     SECTION("Perp vector")
     {
         Vector2<float> v(1.f, 2.f);
@@ -381,6 +381,15 @@ TEST_CASE("Vector3")
         CHECK(normalized(Vector3<float>(5.f, 5.f, 5.f)).z == Approx(1.f / std::sqrt(3.f)));
     }
 
+    SECTION("Fast vector normalization")
+    {
+        CHECK(normalized_fast(Vector3<float>(0.f, 20.f, 0.f)).y == Approx(1.f).epsilon(1e-5));
+        CHECK(normalized_fast(Vector3<float>(5.f, 5.f, 5.f)).x == Approx(1.f / std::sqrt(3.f)).epsilon(1e-5));
+        CHECK(length(normalized_fast(Vector3<float>(3.f, -5.f, 12.f))) == Approx(1.f).epsilon(1e-5));
+        CHECK(length(normalized_fast(Vector3<float>(1e-10f, 2e-10f, -3e-10f))) == Approx(1.f).epsilon(1e-5));
+        CHECK(length(normalized_fast(Vector3<double>(3.0, -5.0, 12.0))) == Approx(1.0));
+    }
+
     SECTION("Cross product")
     {
         CHECK(cross(Vector3<float>(1.f, 2.f, 3.f), Vector3<float>(4.f, 5.f, 6.f)) == Vector3<float>(-3.f, 6.f, -3.f));
@@ -421,6 +421,12 @@ TEST_CASE("Vector4")
             Vector4<float>(1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f), 1.f / std::sqrt(4.f)));
     }
 
+    SECTION("Fast vector normalization")
+    {
+        CHECK(normalized_fast(Vector4<float>(0.f, 0.f, 0.f, 40.f)).w == Approx(1.f).epsilon(1e-5));
+        CHECK(length(normalized_fast(Vector4<float>(1.f, -2.f, 3.f, -4.f))) == Approx(1.f).epsilon(1e-5));
+    }
+
     SECTION("Max component")
     {
         CHECK(max_component(Vector4<int>(10, 5, -1, 3)) == 10);
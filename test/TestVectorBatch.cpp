@@ -0,0 +1,98 @@
+#include <gbMath/VectorBatch.hpp>
+
+#include <catch.hpp>
+
+#include <span>
+#include <vector>
+
+TEST_CASE("Vector Batch")
+{
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::Vector4;
+    using GHULBUS_MATH_NAMESPACE::Normal3;
+
+    SECTION("Fast normalization of a span of vectors")
+    {
+        std::vector<Vector3<float>> vectors;
+        for (int i = 1; i <= 37; ++i) {
+            vectors.emplace_back(static_cast<float>(i), static_cast<float>(-2 * i + 7), 0.25f * static_cast<float>(i * i));
+        }
+        std::vector<Vector3<float>> normalized(vectors.size());
+        normalized_fast(std::span<Vector3<float> const>(vectors), std::span<Vector3<float>>(normalized));
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            CHECK(normalized[i].x == Approx(GHULBUS_MATH_NAMESPACE::normalized(vectors[i]).x).margin(1e-5));
+            CHECK(normalized[i].y == Approx(GHULBUS_MATH_NAMESPACE::normalized(vectors[i]).y).margin(1e-5));
+            CHECK(normalized[i].z == Approx(GHULBUS_MATH_NAMESPACE::normalized(vectors[i]).z).margin(1e-5));
+        }
+
+        normalize_fast(std::span<Vector3<float>>(vectors));
+        CHECK(vectors == normalized);
+    }
+
+    SECTION("Fast normalization of other vector types")
+    {
+        std::vector<Vector2<float>> v2{ Vector2<float>(3.f, 4.f), Vector2<float>(0.f, -2.f) };
+        normalize_fast(std::span<Vector2<float>>(v2));
+        CHECK(v2[0].x == Approx(0.6f).epsilon(1e-5));
+        CHECK(v2[0].y == Approx(0.8f).epsilon(1e-5));
+        CHECK(v2[1].y == Approx(-1.f).epsilon(1e-5));
+
+        std::vector<Normal3<double>> n3{ Normal3<double>(0.0, 0.0, 3.0) };
+        normalize_fast(std::span<Normal3<double>>(n3));
+        CHECK(n3[0] == Normal3<double>(0.0, 0.0, 1.0));
+
+        std::vector<Vector4<float>> v4{ Vector4<float>(2.f, 2.f, 2.f, 2.f) };
+        std::vector<Vector4<float>> v4_out(1);
+        normalized_fast(std::span<Vector4<float> const>(v4), std::span<Vector4<float>>(v4_out));
+        CHECK(v4_out[0].w == Approx(0.5f).epsilon(1e-5));
+    }
+}
+
+TEST_CASE("Vector Batch Transform")
+{
+    using GHULBUS_MATH_NAMESPACE::AABB3;
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Transform3;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+
+    Transform3<double> const t(0, -1, 0, 10,
+                               1,  0, 0, 20,
+                               0,  0, 2, 30,
+                               0,  0, 0,  1);
+    std::vector<Point3<double>> points;
+    for (int i = 0; i < 25; ++i) {
+        points.emplace_back(i, 2 * i - 20, -i);
+    }
+
+    SECTION("Transform a span of points")
+    {
+        std::vector<Point3<double>> transformed(points.size());
+        transform(t, std::span<Point3<double> const>(points), std::span<Point3<double>>(transformed));
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            CHECK(transformed[i] == t * points[i]);
+        }
+        // in place
+        transform(t, std::span<Point3<double> const>(points), std::span<Point3<double>>(points));
+        CHECK(points == transformed);
+    }
+
+    SECTION("Vectors are not translated")
+    {
+        std::vector<Vector3<double>> vectors{ Vector3<double>(1, 0, 0), Vector3<double>(0, 0, 1) };
+        transform(t, std::span<Vector3<double> const>(vectors), std::span<Vector3<double>>(vectors));
+        CHECK(vectors[0] == Vector3<double>(0, 1, 0));
+        CHECK(vectors[1] == Vector3<double>(0, 0, 2));
+    }
+
+    SECTION("Transformed bounds")
+    {
+        std::vector<Point3<double>> transformed(points.size());
+        transform(t, std::span<Point3<double> const>(points), std::span<Point3<double>>(transformed));
+        AABB3<double> const bounds = transformed_bounds(t, std::span<Point3<double> const>(points));
+        CHECK(bounds == AABB3<double>::from_points(std::span<Point3<double> const>(transformed)));
+        // partial results combine to the bounds of the whole span
+        std::span<Point3<double> const> const all(points);
+        CHECK(union_aabb(transformed_bounds(t, all.first(10)), transformed_bounds(t, all.subspan(10))) == bounds);
+    }
+}
@@ -2,7 +2,11 @@
 
 #include <catch.hpp>
 
+#include <array>
+#include <iomanip>
 #include <sstream>
+#include <string_view>
+#include <version>
 
 TEST_CASE("VectorIO")
 {
@@ -115,3 +119,64 @@ TEST_CASE("VectorIO")
         CHECK(sstr.str() == "[1 2 3 4 5 6]");
     }
 }
+
+#ifdef __cpp_lib_format
+TEST_CASE("VectorIO format")
+{
+    using GHULBUS_MATH_NAMESPACE::Point3;
+    using GHULBUS_MATH_NAMESPACE::Vector2;
+    using GHULBUS_MATH_NAMESPACE::Vector3;
+    using GHULBUS_MATH_NAMESPACE::Vector4;
+    using GHULBUS_MATH_NAMESPACE::Vector;
+
+    SECTION("Default format")
+    {
+        CHECK(std::format("{}", Vector2<int>(1, 2)) == "[1 2]");
+        CHECK(std::format("{}", Point3<double>(1.5, -2, 3)) == "[1.5 -2 3]");
+        CHECK(std::format("{}", Vector4<char>(1, 2, 3, 4)) == "[1 2 3 4]");
+        CHECK(std::format("{}", Vector<int, 5>(1, 2, 3, 4, 5)) == "[1 2 3 4 5]");
+    }
+
+    SECTION("Format spec is applied to each element")
+    {
+        CHECK(std::format("{:.3f}", Vector3<double>(1.5, -2, 3)) == "[1.500 -2.000 3.000]");
+        CHECK(std::format("{:>3}", Vector2<int>(1, 22)) == "[  1  22]");
+        CHECK(std::format("{:+}", Vector4<int>(1, -2, 3, 0)) == "[+1 -2 +3 +0]");
+        CHECK(std::format("{:x}", Vector<int, 3>(10, 11, 255)) == "[a b ff]");
+        CHECK(std::format("{:.1e}", Vector2<float>(1500.f, 0.25f)) == "[1.5e+03 2.5e-01]");
+    }
+
+    SECTION("Stream width applies to the whole vector")
+    {
+        std::stringstream sstr;
+        sstr << std::setw(8) << Vector2<int>(1, 2) << 5;
+        CHECK(sstr.str() == "   [1 2]5");
+        sstr.str("");
+        sstr << std::left << std::setfill('*') << std::setw(8) << Vector2<int>(1, 2) << std::setw(2) << 5;
+        CHECK(sstr.str() == "[1 2]***5*");
+        sstr.str("");
+        sstr << std::right << std::setw(3) << Vector3<int>(1, 2, 3) << std::setw(2) << 5;
+        CHECK(sstr.str() == "[1 2 3]*5");
+    }
+
+    SECTION("Wide character format")
+    {
+        CHECK(std::format(L"{:.1f}", Vector2<double>(1, 2)) == L"[1.0 2.0]");
+    }
+
+    SECTION("Bounded formatting")
+    {
+        std::array<char, 8> buffer;
+        auto const truncated = GHULBUS_MATH_NAMESPACE::format_to_buffer(buffer, "{}", Vector3<int>(100, 200, 300));
+        CHECK(truncated.str == "[100 200");
+        CHECK(truncated.truncated);
+        auto const complete = GHULBUS_MATH_NAMESPACE::format_to_buffer(buffer, "{}", Vector2<int>(1, 2));
+        CHECK(complete.str == "[1 2]");
+        CHECK(!complete.truncated);
+
+        auto const res = std::format_to_n(buffer.data(), 4, "{:.2f}", Vector2<double>(1, 2));
+        CHECK(std::string_view(buffer.data(), res.out) == "[1.0");
+        CHECK(res.size == 11);
+    }
+}
+#endif
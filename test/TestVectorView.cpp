@@ -0,0 +1,87 @@
+#include <gbMath/VectorView.hpp>
+
+#include <catch.hpp>
+
+TEST_CASE("VectorView")
+{
+    using GHULBUS_MATH_NAMESPACE::Vector;
+    using GHULBUS_MATH_NAMESPACE::VectorView;
+
+    SECTION("Static Properties")
+    {
+        static_assert(std::same_as<VectorView<float, 3>::ValueType, float>);
+        static_assert(std::same_as<VectorView<float const, 3>::ValueType, float>);
+        static_assert(std::same_as<VectorView<float const, 3>::ElementType, float const>);
+        static_assert(VectorView<int, 5>::Dimension::value == 5);
+        static_assert(std::is_trivially_copyable_v<VectorView<int, 5>>);
+    }
+
+    SECTION("View of contiguous memory")
+    {
+        int arr[] = { 1, 2, 3 };
+        VectorView<int, 3> const vv(arr);
+        CHECK(vv.dimension() == 3);
+        CHECK(vv[0] == 1);
+        CHECK(vv[1] == 2);
+        CHECK(vv[2] == 3);
+        vv[1] = 42;
+        CHECK(arr[1] == 42);
+    }
+
+    SECTION("Strided view")
+    {
+        int arr[] = { 1, 2, 3, 4, 5, 6 };
+        VectorView<int, 3> const vv(arr + 1, 2);
+        CHECK(vv.to_vector() == Vector<int, 3>(2, 4, 6));
+        VectorView<int const, 2> const reverse(arr + 5, -5);
+        CHECK(reverse.to_vector() == Vector<int, 2>(6, 1));
+    }
+
+    SECTION("View of owning vector")
+    {
+        Vector<int, 3> v(1, 2, 3);
+        VectorView vv(v);
+        static_assert(std::same_as<decltype(vv), VectorView<int, 3>>);
+        vv[2] = 5;
+        CHECK(v == Vector<int, 3>(1, 2, 5));
+        Vector<int, 3> const& cv = v;
+        VectorView cvv(cv);
+        static_assert(std::same_as<decltype(cvv), VectorView<int const, 3>>);
+        VectorView<int const, 3> const converted = vv;
+        CHECK(converted == cvv);
+    }
+
+    SECTION("Assignment through the view")
+    {
+        int arr[] = { 0, 0, 0, 0 };
+        VectorView<int, 2> const vv(arr, 3);
+        vv.assign(Vector<int, 2>(7, 8));
+        CHECK(arr[0] == 7);
+        CHECK(arr[3] == 8);
+        vv += Vector<int, 2>(1, 1);
+        CHECK(vv.to_vector() == Vector<int, 2>(8, 9));
+        vv -= Vector<int, 2>(2, 3);
+        CHECK(vv.to_vector() == Vector<int, 2>(6, 6));
+        vv *= 2;
+        CHECK(vv.to_vector() == Vector<int, 2>(12, 12));
+        vv /= 3;
+        CHECK(vv.to_vector() == Vector<int, 2>(4, 4));
+        CHECK(arr[1] == 0);
+        CHECK(arr[2] == 0);
+    }
+
+    SECTION("Arithmetic")
+    {
+        int arr[] = { 1, 10, 2, 20, 3, 30 };
+        VectorView<int const, 3> const a(arr, 2);
+        VectorView<int const, 3> const b(arr + 1, 2);
+        CHECK(a + b == Vector<int, 3>(11, 22, 33));
+        CHECK(b - a == Vector<int, 3>(9, 18, 27));
+        CHECK(-a == Vector<int, 3>(-1, -2, -3));
+        CHECK(a * 2 == Vector<int, 3>(2, 4, 6));
+        CHECK(3 * a == Vector<int, 3>(3, 6, 9));
+        CHECK(b / 10 == Vector<int, 3>(1, 2, 3));
+        CHECK(dot(a, b) == 140);
+        CHECK(dot(a, Vector<int, 3>(1, 1, 1)) == 6);
+    }
+}